@@ -0,0 +1,103 @@
+#include <stdio.h>
+#include <time.h>
+#include "cstl.h"
+
+#define N 1000000
+
+static long sum = 0;
+static int insert_order[N];
+static int lookup_order[N];
+
+void Pair_sum(T pair) {
+    sum += Integer_get((Integer *)pair_get_value((pair_t *)pair));
+}
+
+double elapsed(clock_t start) {
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+void bench_tree_map() {
+    tree_map_t *map = tree_map_new(Integer_compare);
+    Integer *key = Integer_new(0);
+    clock_t start;
+
+    start = clock();
+    for (int i = 0; i < N; i++) {
+        tree_map_put(map, pair_new(Integer_new(insert_order[i]), Integer_new(i), Integer_delete, Integer_delete));
+    }
+    printf("tree_map_t  put     %8.3fs\n", elapsed(start));
+
+    start = clock();
+    for (int i = 0; i < N; i++) {
+        Integer_set(key, lookup_order[i]);
+        tree_map_get(map, key);
+    }
+    printf("tree_map_t  get     %8.3fs\n", elapsed(start));
+
+    start = clock();
+    sum = 0;
+    for (int i = 0; i < 10; i++) {
+        tree_map_foreach(map, Pair_sum);
+    }
+    printf("tree_map_t  scan    %8.3fs\n", elapsed(start));
+
+    start = clock();
+    for (int i = 0; i < N; i++) {
+        Integer_set(key, insert_order[i]);
+        tree_map_remove(map, key);
+    }
+    printf("tree_map_t  remove  %8.3fs\n", elapsed(start));
+
+    Integer_delete(key);
+    tree_map_delete(map);
+}
+
+void bench_btree_map() {
+    btree_map_t *map = btree_map_new(Integer_compare);
+    Integer *key = Integer_new(0);
+    clock_t start;
+
+    start = clock();
+    for (int i = 0; i < N; i++) {
+        btree_map_put(map, pair_new(Integer_new(insert_order[i]), Integer_new(i), Integer_delete, Integer_delete));
+    }
+    printf("btree_map_t put     %8.3fs\n", elapsed(start));
+
+    start = clock();
+    for (int i = 0; i < N; i++) {
+        Integer_set(key, lookup_order[i]);
+        btree_map_get(map, key);
+    }
+    printf("btree_map_t get     %8.3fs\n", elapsed(start));
+
+    start = clock();
+    sum = 0;
+    for (int i = 0; i < 10; i++) {
+        btree_map_foreach(map, Pair_sum);
+    }
+    printf("btree_map_t scan    %8.3fs\n", elapsed(start));
+
+    start = clock();
+    for (int i = 0; i < N; i++) {
+        Integer_set(key, insert_order[i]);
+        btree_map_remove(map, key);
+    }
+    printf("btree_map_t remove  %8.3fs\n", elapsed(start));
+
+    Integer_delete(key);
+    btree_map_delete(map);
+}
+
+int main() {
+    /* Independent random orders, so lookups do not follow the allocation order of the nodes */
+    for (int i = 0; i < N; i++) {
+        insert_order[i] = i;
+        lookup_order[i] = i;
+    }
+    shuffle(insert_order, N, int);
+    shuffle(lookup_order, N, int);
+
+    bench_tree_map();
+    bench_btree_map();
+    return 0;
+}
@@ -0,0 +1,59 @@
+#include <stdio.h>
+#include <time.h>
+#include "cstl.h"
+
+#define N 1000000
+#define M 1000
+
+double elapsed(clock_t start) {
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+int main() {
+    hash_set_t *large = hash_set_new(Integer_compare, Integer_delete, Integer_hash);
+    hash_set_t *small = hash_set_new(Integer_compare, Integer_delete, Integer_hash);
+    hash_set_t *result = NULL;
+    clock_t start;
+
+    for (int i = 0; i < N; i++) {
+        hash_set_add(large, Integer_new(i * 2));
+    }
+    for (int i = 0; i < M; i++) {
+        hash_set_add(small, Integer_new(i * 3));
+    }
+
+    start = clock();
+    result = hash_set_union(large, small);
+    printf("hash_set_t union (large, small)        %8.3fs\n", elapsed(start));
+    hash_set_delete(result);
+
+    start = clock();
+    for (int i = 0; i < 100; i++) {
+        result = hash_set_intersection(large, small);
+        hash_set_delete(result);
+    }
+    printf("hash_set_t intersection (large, small) %8.3fs\n", elapsed(start));
+
+    start = clock();
+    for (int i = 0; i < 100; i++) {
+        hash_set_is_disjoint(large, small);
+    }
+    printf("hash_set_t is_disjoint (large, small)  %8.3fs\n", elapsed(start));
+
+    start = clock();
+    result = hash_set_symmetric_difference(large, small);
+    printf("hash_set_t symmetric_difference        %8.3fs\n", elapsed(start));
+    hash_set_delete(result);
+
+    start = clock();
+    result = hash_set_new(Integer_compare, NULL, Integer_hash);
+    hash_set_union_into(result, large);
+    hash_set_union_into(result, small);
+    hash_set_remove_all(result, small);
+    printf("hash_set_t union_into + remove_all     %8.3fs\n", elapsed(start));
+    hash_set_delete(result);
+
+    hash_set_delete(large);
+    hash_set_delete(small);
+    return 0;
+}
@@ -0,0 +1,116 @@
+#include <stdio.h>
+#include <time.h>
+#include "cstl.h"
+
+#define N 1000000
+#define K 1000
+#define LARGE 4000000
+
+static int values[N];
+
+double elapsed(clock_t start) {
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+array_t *make_array(bool descending) {
+    array_t *array = array_new(NULL, NULL);
+    for (int i = 0; i < N; i++) {
+        array_append(array, Integer_new(descending ? N - i : values[i]));
+    }
+    return array;
+}
+
+void bench_build(bool descending) {
+    const char *order = descending ? "descending" : "shuffled  ";
+    heap_t *heap = NULL;
+    array_t *array = NULL;
+    clock_t start;
+
+    array = make_array(descending);
+    start = clock();
+    heap = heap_new(MIN_HEAP, Integer_compare, Integer_delete);
+    for (int i = 0; i < N; i++) {
+        heap_push(heap, array_get(array, i));
+    }
+    printf("heap_t build %s push       %8.3fs\n", order, elapsed(start));
+    array_delete(array);
+
+    start = clock();
+    while (!heap_is_empty(heap)) {
+        Integer_delete(heap_pop(heap));
+    }
+    printf("heap_t pop all                     %8.3fs\n", elapsed(start));
+    heap_delete(heap);
+
+    array = make_array(descending);
+    start = clock();
+    heap = heap_new_from_array(MIN_HEAP, Integer_compare, Integer_delete, array);
+    printf("heap_t build %s from_array %8.3fs\n", order, elapsed(start));
+    array_delete(array);
+    heap_delete(heap);
+}
+
+void bench_top_k() {
+    heap_t *heap = NULL;
+    clock_t start;
+
+    /* Keep the K largest values in a min heap */
+    start = clock();
+    heap = heap_new(MIN_HEAP, Integer_compare, Integer_delete);
+    for (int i = 0; i < N; i++) {
+        heap_push(heap, Integer_new(values[i]));
+        if (heap_size(heap) > K) {
+            Integer_delete(heap_pop(heap));
+        }
+    }
+    printf("heap_t top-k push + pop            %8.3fs\n", elapsed(start));
+    heap_delete(heap);
+
+    start = clock();
+    heap = heap_new(MIN_HEAP, Integer_compare, Integer_delete);
+    for (int i = 0; i < N; i++) {
+        if (heap_size(heap) < K) {
+            heap_push(heap, Integer_new(values[i]));
+        } else {
+            Integer_delete(heap_pushpop(heap, Integer_new(values[i])));
+        }
+    }
+    printf("heap_t top-k pushpop               %8.3fs\n", elapsed(start));
+    heap_delete(heap);
+}
+
+void bench_arity(size_t arity) {
+    heap_t *heap = heap_new_with_arity(MIN_HEAP, Integer_compare, Integer_delete, arity);
+    Integer *elem = NULL;
+    clock_t start;
+
+    for (int i = 0; i < LARGE; i++) {
+        heap_push(heap, Integer_new(values[i % N] + i / N * N));
+    }
+
+    /* Hold model on a heap far larger than L2: pop the earliest deadline, reschedule it later */
+    start = clock();
+    for (int i = 0; i < N; i++) {
+        elem = heap_pop(heap);
+        Integer_set(elem, Integer_get(elem) + values[i] % LARGE);
+        heap_push(heap, elem);
+    }
+    printf("heap_t %zu-ary pop + push (%dM)       %8.3fs\n", arity, LARGE / 1000000, elapsed(start));
+
+    heap_delete(heap);
+}
+
+int main() {
+    for (int i = 0; i < N; i++) {
+        values[i] = i;
+    }
+    shuffle(values, N, int);
+
+    bench_build(false);
+    bench_build(true);
+    bench_top_k();
+    bench_arity(2);
+    bench_arity(4);
+    bench_arity(8);
+    return 0;
+}
@@ -0,0 +1,136 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <time.h>
+#include "cstl.h"
+
+#define NODES 500000
+#define DEGREE 8
+
+typedef struct vertex_t {
+    int node;
+    int distance;
+} vertex_t;
+
+static int offsets[NODES + 1];
+static int targets[NODES * DEGREE];
+static int weights[NODES * DEGREE];
+static int distances[NODES];
+
+double elapsed(clock_t start) {
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+int vertex_compare(const T elem1, const T elem2) {
+    const vertex_t *vertex1 = (const vertex_t *)elem1;
+    const vertex_t *vertex2 = (const vertex_t *)elem2;
+    return (vertex1->distance > vertex2->distance) - (vertex1->distance < vertex2->distance);
+}
+
+vertex_t *vertex_new(int node, int distance) {
+    vertex_t *vertex = (vertex_t *)malloc(sizeof(vertex_t));
+    vertex->node = node;
+    vertex->distance = distance;
+    return vertex;
+}
+
+void make_graph() {
+    for (int i = 0; i < NODES; i++) {
+        offsets[i] = i * DEGREE;
+        for (int j = 0; j < DEGREE; j++) {
+            targets[i * DEGREE + j] = randint(0, NODES - 1);
+            weights[i * DEGREE + j] = randint(1, 1000);
+        }
+    }
+    offsets[NODES] = NODES * DEGREE;
+}
+
+long long checksum() {
+    long long sum = 0;
+    for (int i = 0; i < NODES; i++) {
+        if (distances[i] != INT_MAX) {
+            sum += distances[i];
+        }
+    }
+    return sum;
+}
+
+/* Lazy deletion: push a new entry on every relaxation and skip stale ones on pop */
+void bench_lazy_heap() {
+    heap_t *heap = heap_new(MIN_HEAP, vertex_compare, free);
+    vertex_t *vertex = NULL;
+    size_t pushes = 0;
+    clock_t start;
+
+    start = clock();
+    for (int i = 0; i < NODES; i++) {
+        distances[i] = INT_MAX;
+    }
+    distances[0] = 0;
+    heap_push(heap, vertex_new(0, 0));
+    pushes++;
+
+    while (!heap_is_empty(heap)) {
+        vertex = heap_pop(heap);
+        if (vertex->distance == distances[vertex->node]) {
+            for (int e = offsets[vertex->node]; e < offsets[vertex->node + 1]; e++) {
+                int distance = vertex->distance + weights[e];
+                if (distance < distances[targets[e]]) {
+                    distances[targets[e]] = distance;
+                    heap_push(heap, vertex_new(targets[e], distance));
+                    pushes++;
+                }
+            }
+        }
+        free(vertex);
+    }
+    printf("heap_t lazy deletion          %8.3fs (%zu pushes, checksum %lld)\n", elapsed(start), pushes, checksum());
+    heap_delete(heap);
+}
+
+/* Decrease-key: one entry per reached node, relaxed in place through its handle */
+void bench_indexed_heap() {
+    indexed_heap_t *heap = indexed_heap_new(MIN_HEAP, vertex_compare, free);
+    static size_t handles[NODES];
+    vertex_t *vertex = NULL;
+    size_t pushes = 0;
+    clock_t start;
+
+    start = clock();
+    for (int i = 0; i < NODES; i++) {
+        distances[i] = INT_MAX;
+        handles[i] = INDEXED_HEAP_INVALID_HANDLE;
+    }
+    distances[0] = 0;
+    handles[0] = indexed_heap_push(heap, vertex_new(0, 0));
+    pushes++;
+
+    while (!indexed_heap_is_empty(heap)) {
+        vertex = indexed_heap_pop(heap);
+        handles[vertex->node] = INDEXED_HEAP_INVALID_HANDLE;
+        for (int e = offsets[vertex->node]; e < offsets[vertex->node + 1]; e++) {
+            int target = targets[e];
+            int distance = vertex->distance + weights[e];
+            if (distance < distances[target]) {
+                distances[target] = distance;
+                if (handles[target] == INDEXED_HEAP_INVALID_HANDLE) {
+                    handles[target] = indexed_heap_push(heap, vertex_new(target, distance));
+                    pushes++;
+                } else {
+                    ((vertex_t *)indexed_heap_get(heap, handles[target]))->distance = distance;
+                    indexed_heap_decrease_key(heap, handles[target]);
+                }
+            }
+        }
+        free(vertex);
+    }
+    printf("indexed_heap_t decrease_key   %8.3fs (%zu pushes, checksum %lld)\n", elapsed(start), pushes, checksum());
+    indexed_heap_delete(heap);
+}
+
+int main() {
+    make_graph();
+    bench_lazy_heap();
+    bench_indexed_heap();
+    return 0;
+}
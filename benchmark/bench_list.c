@@ -0,0 +1,104 @@
+#include <stdio.h>
+#include <time.h>
+#include "cstl.h"
+
+#define N 1000000
+#define M 2000
+
+static long sum = 0;
+
+void Integer_sum(T elem) {
+    sum += Integer_get((Integer *)elem);
+}
+
+double elapsed(clock_t start) {
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+void bench_list() {
+    list_t *list = list_new(Integer_compare, Integer_delete);
+    Integer *target = Integer_new(-1);
+    clock_t start;
+
+    start = clock();
+    for (int i = 0; i < N; i++) {
+        list_push_back(list, Integer_new(i));
+    }
+    printf("list_t          push_back  %8.3fs\n", elapsed(start));
+
+    start = clock();
+    sum = 0;
+    for (int i = 0; i < 10; i++) {
+        list_foreach(list, Integer_sum);
+    }
+    printf("list_t          foreach    %8.3fs\n", elapsed(start));
+
+    start = clock();
+    for (int i = 0; i < 10; i++) {
+        list_index_of(list, target);
+        list_count(list, target);
+    }
+    printf("list_t          search     %8.3fs\n", elapsed(start));
+
+    start = clock();
+    for (int i = 0; i < M; i++) {
+        list_insert(list, (size_t)i * 37 % list_size(list), Integer_new(i));
+    }
+    printf("list_t          insert     %8.3fs\n", elapsed(start));
+
+    start = clock();
+    while (!list_is_empty(list)) {
+        Integer_delete(list_pop_front(list));
+    }
+    printf("list_t          pop_front  %8.3fs\n", elapsed(start));
+
+    Integer_delete(target);
+    list_delete(list);
+}
+
+void bench_unrolled_list() {
+    unrolled_list_t *list = unrolled_list_new(Integer_compare, Integer_delete);
+    Integer *target = Integer_new(-1);
+    clock_t start;
+
+    start = clock();
+    for (int i = 0; i < N; i++) {
+        unrolled_list_push_back(list, Integer_new(i));
+    }
+    printf("unrolled_list_t push_back  %8.3fs\n", elapsed(start));
+
+    start = clock();
+    sum = 0;
+    for (int i = 0; i < 10; i++) {
+        unrolled_list_foreach(list, Integer_sum);
+    }
+    printf("unrolled_list_t foreach    %8.3fs\n", elapsed(start));
+
+    start = clock();
+    for (int i = 0; i < 10; i++) {
+        unrolled_list_index_of(list, target);
+        unrolled_list_count(list, target);
+    }
+    printf("unrolled_list_t search     %8.3fs\n", elapsed(start));
+
+    start = clock();
+    for (int i = 0; i < M; i++) {
+        unrolled_list_insert(list, (size_t)i * 37 % unrolled_list_size(list), Integer_new(i));
+    }
+    printf("unrolled_list_t insert     %8.3fs\n", elapsed(start));
+
+    start = clock();
+    while (!unrolled_list_is_empty(list)) {
+        Integer_delete(unrolled_list_pop_front(list));
+    }
+    printf("unrolled_list_t pop_front  %8.3fs\n", elapsed(start));
+
+    Integer_delete(target);
+    unrolled_list_delete(list);
+}
+
+int main() {
+    bench_list();
+    bench_unrolled_list();
+    return 0;
+}
@@ -0,0 +1,96 @@
+#include <stdio.h>
+#include <time.h>
+#include "cstl.h"
+
+#define N 1000000
+#define K 1000
+#define SHARDS 64
+
+double elapsed(clock_t start) {
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+/* Insert heavy: push everything, then only take the first K */
+void bench_insert_heavy() {
+    heap_t *heap = heap_new(MIN_HEAP, Integer_compare, Integer_delete);
+    pairing_heap_t *pairing_heap = pairing_heap_new(MIN_HEAP, Integer_compare, Integer_delete);
+    clock_t start;
+
+    start = clock();
+    for (int i = 0; i < N; i++) {
+        heap_push(heap, Integer_new(randint(0, N)));
+    }
+    for (int i = 0; i < K; i++) {
+        Integer_delete(heap_pop(heap));
+    }
+    printf("heap_t push %d, pop %d         %8.3fs\n", N, K, elapsed(start));
+
+    start = clock();
+    for (int i = 0; i < N; i++) {
+        pairing_heap_push(pairing_heap, Integer_new(randint(0, N)));
+    }
+    for (int i = 0; i < K; i++) {
+        Integer_delete(pairing_heap_pop(pairing_heap));
+    }
+    printf("pairing_heap_t push %d, pop %d %8.3fs\n", N, K, elapsed(start));
+
+    heap_delete(heap);
+    pairing_heap_delete(pairing_heap);
+}
+
+/* Merge per-shard queues into one global queue */
+void bench_merge() {
+    heap_t *shards[SHARDS];
+    pairing_heap_t *pairing_shards[SHARDS];
+    heap_t *heap = NULL;
+    pairing_heap_t *pairing_heap = NULL;
+    clock_t start;
+
+    for (int s = 0; s < SHARDS; s++) {
+        shards[s] = heap_new(MIN_HEAP, Integer_compare, Integer_delete);
+        pairing_shards[s] = pairing_heap_new(MIN_HEAP, Integer_compare, Integer_delete);
+        for (int i = 0; i < N / SHARDS; i++) {
+            heap_push(shards[s], Integer_new(randint(0, N)));
+            pairing_heap_push(pairing_shards[s], Integer_new(randint(0, N)));
+        }
+    }
+
+    start = clock();
+    heap = heap_new(MIN_HEAP, Integer_compare, Integer_delete);
+    for (int s = 0; s < SHARDS; s++) {
+        while (!heap_is_empty(shards[s])) {
+            heap_push(heap, heap_pop(shards[s]));
+        }
+        heap_delete(shards[s]);
+    }
+    printf("heap_t merge %d shards by re-push     %8.3fs\n", SHARDS, elapsed(start));
+
+    start = clock();
+    pairing_heap = pairing_heap_new(MIN_HEAP, Integer_compare, Integer_delete);
+    for (int s = 0; s < SHARDS; s++) {
+        pairing_heap_meld(pairing_heap, pairing_shards[s]);
+        pairing_heap_delete(pairing_shards[s]);
+    }
+    printf("pairing_heap_t meld %d shards         %8.3fs\n", SHARDS, elapsed(start));
+
+    start = clock();
+    while (!heap_is_empty(heap)) {
+        Integer_delete(heap_pop(heap));
+    }
+    printf("heap_t pop all                        %8.3fs\n", elapsed(start));
+
+    start = clock();
+    while (!pairing_heap_is_empty(pairing_heap)) {
+        Integer_delete(pairing_heap_pop(pairing_heap));
+    }
+    printf("pairing_heap_t pop all                %8.3fs\n", elapsed(start));
+
+    heap_delete(heap);
+    pairing_heap_delete(pairing_heap);
+}
+
+int main() {
+    bench_insert_heavy();
+    bench_merge();
+    return 0;
+}
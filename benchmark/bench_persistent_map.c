@@ -0,0 +1,87 @@
+#include <stdio.h>
+#include <time.h>
+#include "cstl.h"
+
+#define N 100000
+#define SNAPSHOTS 100
+#define UPDATES 1000
+
+double elapsed(clock_t start) {
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+/**
+ * @brief Deep-copy a tree_map_t object, the way readers got a consistent view before.
+ */
+tree_map_t *tree_map_copy(const tree_map_t *map) {
+    array_t *pairs = array_new(NULL, NULL);
+    iterator_t *iterator = tree_map_iterator_new(map);
+    while (tree_map_iterator_has_next(iterator)) {
+        pair_t *pair = tree_map_iterator_next(iterator);
+        array_append(pairs, pair_new(Integer_new(Integer_get(pair_get_key(pair))), Integer_new(Integer_get(pair_get_value(pair))), Integer_delete, Integer_delete));
+    }
+    tree_map_iterator_delete(iterator);
+
+    tree_map_t *copy = tree_map_from_sorted(Integer_compare, pairs);
+    array_delete(pairs);
+    return copy;
+}
+
+void bench_tree_map() {
+    tree_map_t *map = tree_map_new(Integer_compare);
+    tree_map_t *snapshots[SNAPSHOTS];
+    clock_t start;
+
+    for (int i = 0; i < N; i++) {
+        tree_map_put(map, pair_new(Integer_new(i), Integer_new(i), Integer_delete, Integer_delete));
+    }
+
+    start = clock();
+    for (int s = 0; s < SNAPSHOTS; s++) {
+        for (int i = 0; i < UPDATES; i++) {
+            tree_map_put(map, pair_new(Integer_new((int)((long)(s * UPDATES + i) * 7919 % N)), Integer_new(s), Integer_delete, Integer_delete));
+        }
+        snapshots[s] = tree_map_copy(map);
+    }
+    printf("tree_map_t       update + deep copy  %8.3fs\n", elapsed(start));
+
+    for (int s = 0; s < SNAPSHOTS; s++) {
+        tree_map_delete(snapshots[s]);
+    }
+    tree_map_delete(map);
+}
+
+void bench_persistent_map() {
+    persistent_map_t *map = persistent_map_new(Integer_compare);
+    persistent_map_t *snapshots[SNAPSHOTS];
+    persistent_map_t *next = NULL;
+    clock_t start;
+
+    for (int i = 0; i < N; i++) {
+        next = persistent_map_put(map, pair_new(Integer_new(i), Integer_new(i), Integer_delete, Integer_delete));
+        persistent_map_delete(map);
+        map = next;
+    }
+
+    start = clock();
+    for (int s = 0; s < SNAPSHOTS; s++) {
+        for (int i = 0; i < UPDATES; i++) {
+            next = persistent_map_put(map, pair_new(Integer_new((int)((long)(s * UPDATES + i) * 7919 % N)), Integer_new(s), Integer_delete, Integer_delete));
+            persistent_map_delete(map);
+            map = next;
+        }
+        snapshots[s] = persistent_map_snapshot(map);
+    }
+    printf("persistent_map_t update + snapshot   %8.3fs\n", elapsed(start));
+
+    for (int s = 0; s < SNAPSHOTS; s++) {
+        persistent_map_delete(snapshots[s]);
+    }
+    persistent_map_delete(map);
+}
+
+int main() {
+    bench_tree_map();
+    bench_persistent_map();
+    return 0;
+}
@@ -0,0 +1,80 @@
+#include <stdio.h>
+#include <time.h>
+#include "cstl.h"
+
+#define N 1000000
+#define HOLDS 5000000
+#define DELAY 1000
+
+double elapsed(clock_t start) {
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+/* Event simulation hold model: pop the next event and schedule one at a later time */
+void bench_hold() {
+    heap_t *heap = heap_new(MIN_HEAP, Integer_compare, Integer_delete);
+    radix_heap_t *radix_heap = radix_heap_new(Integer_delete);
+    Integer *event = NULL;
+    clock_t start;
+
+    start = clock();
+    for (int i = 0; i < N; i++) {
+        heap_push(heap, Integer_new(randint(0, DELAY)));
+    }
+    for (int i = 0; i < HOLDS; i++) {
+        event = heap_pop(heap);
+        Integer_set(event, Integer_get(event) + randint(0, DELAY));
+        heap_push(heap, event);
+    }
+    printf("heap_t hold        %8.3fs\n", elapsed(start));
+
+    start = clock();
+    for (int i = 0; i < N; i++) {
+        int time = randint(0, DELAY);
+        radix_heap_push(radix_heap, (unsigned long)time, Integer_new(time));
+    }
+    for (int i = 0; i < HOLDS; i++) {
+        event = radix_heap_pop(radix_heap);
+        Integer_set(event, Integer_get(event) + randint(0, DELAY));
+        radix_heap_push(radix_heap, (unsigned long)Integer_get(event), event);
+    }
+    printf("radix_heap_t hold  %8.3fs\n", elapsed(start));
+
+    heap_delete(heap);
+    radix_heap_delete(radix_heap);
+}
+
+/* Drain: push everything, then pop everything in order */
+void bench_drain() {
+    heap_t *heap = heap_new(MIN_HEAP, Integer_compare, Integer_delete);
+    radix_heap_t *radix_heap = radix_heap_new(Integer_delete);
+    clock_t start;
+
+    start = clock();
+    for (int i = 0; i < N; i++) {
+        heap_push(heap, Integer_new(randint(0, N)));
+    }
+    while (!heap_is_empty(heap)) {
+        Integer_delete(heap_pop(heap));
+    }
+    printf("heap_t drain       %8.3fs\n", elapsed(start));
+
+    start = clock();
+    for (int i = 0; i < N; i++) {
+        int key = randint(0, N);
+        radix_heap_push(radix_heap, (unsigned long)key, Integer_new(key));
+    }
+    while (!radix_heap_is_empty(radix_heap)) {
+        Integer_delete(radix_heap_pop(radix_heap));
+    }
+    printf("radix_heap_t drain %8.3fs\n", elapsed(start));
+
+    heap_delete(heap);
+    radix_heap_delete(radix_heap);
+}
+
+int main() {
+    bench_hold();
+    bench_drain();
+    return 0;
+}
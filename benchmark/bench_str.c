@@ -0,0 +1,94 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "cstl.h"
+
+#define N 1000000
+
+double elapsed(clock_t start) {
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+int compare_string(const T a, const T b) {
+    return string_compare(a, b);
+}
+
+int main() {
+    char **keys = malloc(sizeof(char *) * N);
+    char **copies = malloc(sizeof(char *) * N);
+    string_t **strings = malloc(sizeof(string_t *) * N);
+    array_t *array = NULL;
+    string_t *builder = NULL;
+    char buffer[32];
+    size_t total = 0;
+    clock_t start;
+    int i;
+
+    /* Build a 1 MB payload character by character and in chunks */
+    builder = string_new("");
+    start = clock();
+    for (i = 0; i < N; i++) {
+        string_append_char(builder, (char)('a' + i % 26));
+    }
+    printf("string_t append_char  %8.3fs\n", elapsed(start));
+    string_delete(builder);
+
+    builder = string_new("");
+    start = clock();
+    for (i = 0; i < N / 64; i++) {
+        string_concat(builder, "0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef");
+    }
+    printf("string_t concat       %8.3fs\n", elapsed(start));
+    total += string_length(builder);
+    string_delete(builder);
+
+    /* Short keys such as ids and tags */
+    for (i = 0; i < N; i++) {
+        sprintf(buffer, "user:%d", (int)((long)i * 7919 % N));
+        keys[i] = malloc(strlen(buffer) + 1);
+        strcpy(keys[i], buffer);
+    }
+
+    start = clock();
+    for (i = 0; i < N; i++) {
+        copies[i] = malloc(strlen(keys[i]) + 1);
+        strcpy(copies[i], keys[i]);
+    }
+    for (i = 0; i < N; i++) {
+        free(copies[i]);
+    }
+    printf("char * new/delete     %8.3fs\n", elapsed(start));
+
+    start = clock();
+    for (i = 0; i < N; i++) {
+        strings[i] = string_new(keys[i]);
+    }
+    for (i = 0; i < N; i++) {
+        string_delete(strings[i]);
+    }
+    printf("string_t new/delete   %8.3fs\n", elapsed(start));
+
+    array = array_new(compare_string, (destroy_t)string_delete);
+    for (i = 0; i < N; i++) {
+        array_append(array, string_new(keys[i]));
+    }
+    start = clock();
+    array_sort(array);
+    printf("string_t sort         %8.3fs\n", elapsed(start));
+
+    start = clock();
+    for (i = 0; i < N; i++) {
+        total += string_hash(array_get(array, i));
+    }
+    printf("string_t hash         %8.3fs\n", elapsed(start));
+    array_delete(array);
+
+    for (i = 0; i < N; i++) {
+        free(keys[i]);
+    }
+    free(keys);
+    free(copies);
+    free(strings);
+    return total == 0;
+}
@@ -0,0 +1,91 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "cstl.h"
+
+#define N 200000
+#define MAPS 8
+
+double elapsed(clock_t start) {
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+int compare_string(const T a, const T b) {
+    return string_compare(a, b);
+}
+
+size_t hash_string(const T a) {
+    return string_hash(a);
+}
+
+int main() {
+    char **names = malloc(sizeof(char *) * N);
+    hash_map_t *maps[MAPS];
+    string_pool_t *pool = NULL;
+    string_t *query = NULL;
+    const char *handle = NULL;
+    char buffer[64];
+    size_t found = 0;
+    clock_t start;
+    int i, m;
+
+    /* The same metric names are keys of every map */
+    for (i = 0; i < N; i++) {
+        sprintf(buffer, "service.requests.latency.%d.p99", (int)((long)i * 7919 % N));
+        names[i] = malloc(strlen(buffer) + 1);
+        strcpy(names[i], buffer);
+    }
+
+    start = clock();
+    for (m = 0; m < MAPS; m++) {
+        maps[m] = hash_map_new(compare_string, hash_string);
+        for (i = 0; i < N; i++) {
+            hash_map_put(maps[m], pair_new(string_new(names[i]), Integer_new(i), (destroy_t)string_delete, Integer_delete));
+        }
+    }
+    printf("string_t keys put     %8.3fs\n", elapsed(start));
+
+    start = clock();
+    for (i = 0; i < N; i++) {
+        query = string_new(names[i]);
+        for (m = 0; m < MAPS; m++) {
+            found += hash_map_get(maps[m], query) != NULL;
+        }
+        string_delete(query);
+    }
+    printf("string_t keys get     %8.3fs\n", elapsed(start));
+
+    for (m = 0; m < MAPS; m++) {
+        hash_map_delete(maps[m]);
+    }
+
+    start = clock();
+    pool = string_pool_new();
+    for (m = 0; m < MAPS; m++) {
+        maps[m] = hash_map_new(string_pool_compare, string_pool_hash);
+        for (i = 0; i < N; i++) {
+            hash_map_put(maps[m], pair_new((T)string_pool_intern(pool, names[i]), Integer_new(i), NULL, Integer_delete));
+        }
+    }
+    printf("interned keys put     %8.3fs\n", elapsed(start));
+
+    start = clock();
+    for (i = 0; i < N; i++) {
+        handle = string_pool_lookup(pool, names[i]);
+        for (m = 0; m < MAPS; m++) {
+            found += hash_map_get(maps[m], (T)handle) != NULL;
+        }
+    }
+    printf("interned keys get     %8.3fs\n", elapsed(start));
+
+    for (m = 0; m < MAPS; m++) {
+        hash_map_delete(maps[m]);
+    }
+    string_pool_delete(pool);
+
+    for (i = 0; i < N; i++) {
+        free(names[i]);
+    }
+    free(names);
+    return found != 2 * MAPS * N;
+}
@@ -0,0 +1,112 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "cstl.h"
+
+#define N 1000000
+#define TIMEOUT 60000
+#define TICKS 120000
+#define RESETS 4000000
+
+typedef struct connection_t {
+    unsigned long expiry;
+    int id;
+    bool cancelled;
+} connection_t;
+
+static connection_t *armed[N];
+static timer_wheel_timer_t *timers[N];
+static size_t fired = 0;
+
+double elapsed(clock_t start) {
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+int connection_compare(const T elem1, const T elem2) {
+    const connection_t *connection1 = (const connection_t *)elem1;
+    const connection_t *connection2 = (const connection_t *)elem2;
+    return (connection1->expiry > connection2->expiry) - (connection1->expiry < connection2->expiry);
+}
+
+connection_t *connection_new(unsigned long expiry, int id) {
+    connection_t *connection = (connection_t *)malloc(sizeof(connection_t));
+    connection->expiry = expiry;
+    connection->id = id;
+    connection->cancelled = false;
+    return connection;
+}
+
+void connection_fire(T elem) {
+    free(elem);
+    fired++;
+}
+
+void connection_fire_wheel(T elem) {
+    timers[((connection_t *)elem)->id] = NULL;
+    connection_fire(elem);
+}
+
+/* A heap cannot remove a timer, so a reset marks the old entry cancelled and pushes a new one */
+void bench_heap() {
+    heap_t *heap = heap_new(MIN_HEAP, connection_compare, free);
+    connection_t *connection = NULL;
+    clock_t start;
+    int i;
+
+    fired = 0;
+    start = clock();
+    for (i = 0; i < N; i++) {
+        armed[i] = connection_new((unsigned long)randint(1, TIMEOUT), i);
+        heap_push(heap, armed[i]);
+    }
+    for (unsigned long now = 1; now <= TICKS; now++) {
+        for (int r = 0; r < RESETS / TICKS; r++) {
+            i = randint(0, N - 1);
+            if (armed[i] != NULL) {
+                armed[i]->cancelled = true;
+                armed[i] = connection_new(now + TIMEOUT, i);
+                heap_push(heap, armed[i]);
+            }
+        }
+        while (!heap_is_empty(heap) && ((connection_t *)heap_peek(heap))->expiry <= now) {
+            connection = heap_pop(heap);
+            if (!connection->cancelled) {
+                armed[connection->id] = NULL;
+                connection_fire(connection);
+            } else {
+                free(connection);
+            }
+        }
+    }
+    printf("heap_t lazy cancel   %8.3fs (%zu fired)\n", elapsed(start), fired);
+    heap_delete(heap);
+}
+
+void bench_timer_wheel() {
+    timer_wheel_t *wheel = timer_wheel_new(0, free);
+    clock_t start;
+    int i;
+
+    fired = 0;
+    start = clock();
+    for (i = 0; i < N; i++) {
+        timers[i] = timer_wheel_arm(wheel, (unsigned long)randint(1, TIMEOUT), connection_new(0, i));
+    }
+    for (unsigned long now = 1; now <= TICKS; now++) {
+        for (int r = 0; r < RESETS / TICKS; r++) {
+            i = randint(0, N - 1);
+            if (timers[i] != NULL) {
+                timer_wheel_rearm(wheel, timers[i], now + TIMEOUT);
+            }
+        }
+        timer_wheel_advance(wheel, now, connection_fire_wheel);
+    }
+    printf("timer_wheel_t rearm  %8.3fs (%zu fired)\n", elapsed(start), fired);
+    timer_wheel_delete(wheel);
+}
+
+int main() {
+    bench_heap();
+    bench_timer_wheel();
+    return 0;
+}
@@ -0,0 +1,74 @@
+#include <stdio.h>
+#include <time.h>
+#include "cstl.h"
+
+#define N 1000000
+
+double elapsed(clock_t start) {
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+int main() {
+    tree_map_t *map = tree_map_new(Integer_compare);
+    Integer *key = NULL;
+    clock_t start;
+    int i;
+
+    start = clock();
+    for (i = 0; i < N; i++) {
+        tree_map_put(map, pair_new(Integer_new((int)((long)i * 7919 % N)), Integer_new(i), Integer_delete, Integer_delete));
+    }
+    printf("tree_map_t put        %8.3fs\n", elapsed(start));
+
+    start = clock();
+    for (i = 0; i < N; i++) {
+        tree_map_put(map, pair_new(Integer_new(i), Integer_new(-i), Integer_delete, Integer_delete));
+    }
+    printf("tree_map_t overwrite  %8.3fs\n", elapsed(start));
+
+    key = Integer_new(0);
+    start = clock();
+    for (i = 0; i < N; i++) {
+        Integer_set(key, (int)((long)i * 7919 % N));
+        tree_map_get(map, key);
+    }
+    printf("tree_map_t get        %8.3fs\n", elapsed(start));
+
+    start = clock();
+    for (i = 0; i < N; i++) {
+        Integer_set(key, i);
+        tree_map_remove(map, key);
+    }
+    printf("tree_map_t remove     %8.3fs\n", elapsed(start));
+    Integer_delete(key);
+
+    tree_map_delete(map);
+
+    /* Load a sorted snapshot, pair by pair and in bulk */
+    array_t *snapshot = array_new(NULL, NULL);
+    for (i = 0; i < N; i++) {
+        array_append(snapshot, pair_new(Integer_new(i), Integer_new(i), Integer_delete, Integer_delete));
+    }
+
+    map = tree_map_new(Integer_compare);
+    start = clock();
+    for (i = 0; i < N; i++) {
+        tree_map_put(map, array_get(snapshot, i));
+    }
+    printf("tree_map_t sorted put %8.3fs\n", elapsed(start));
+    tree_map_clear(map);
+    tree_map_delete(map);
+    array_delete(snapshot);
+
+    snapshot = array_new(NULL, NULL);
+    for (i = 0; i < N; i++) {
+        array_append(snapshot, pair_new(Integer_new(i), Integer_new(i), Integer_delete, Integer_delete));
+    }
+
+    start = clock();
+    map = tree_map_from_sorted(Integer_compare, snapshot);
+    printf("tree_map_t from_sorted%8.3fs\n", elapsed(start));
+    tree_map_delete(map);
+    array_delete(snapshot);
+    return 0;
+}
@@ -0,0 +1,50 @@
+#include <stdio.h>
+#include <time.h>
+#include "cstl.h"
+
+#define N 1000000
+
+double elapsed(clock_t start) {
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+int main() {
+    tree_set_t *set1 = tree_set_new(Integer_compare, Integer_delete);
+    tree_set_t *set2 = tree_set_new(Integer_compare, Integer_delete);
+    tree_set_t *result = NULL;
+    clock_t start;
+
+    for (int i = 0; i < N; i++) {
+        tree_set_add(set1, Integer_new(i * 2));
+        tree_set_add(set2, Integer_new(i * 3));
+    }
+
+    start = clock();
+    result = tree_set_union(set1, set2);
+    printf("tree_set_t union                 %8.3fs\n", elapsed(start));
+    tree_set_delete(result);
+
+    start = clock();
+    result = tree_set_intersection(set1, set2);
+    printf("tree_set_t intersection          %8.3fs\n", elapsed(start));
+    tree_set_delete(result);
+
+    start = clock();
+    result = tree_set_difference(set1, set2);
+    printf("tree_set_t difference            %8.3fs\n", elapsed(start));
+    tree_set_delete(result);
+
+    start = clock();
+    result = tree_set_symmetric_difference(set1, set2);
+    printf("tree_set_t symmetric_difference  %8.3fs\n", elapsed(start));
+    tree_set_delete(result);
+
+    start = clock();
+    tree_set_is_disjoint(set1, set2);
+    tree_set_is_subset(set1, set2);
+    printf("tree_set_t is_disjoint/is_subset %8.3fs\n", elapsed(start));
+
+    tree_set_delete(set1);
+    tree_set_delete(set2);
+    return 0;
+}
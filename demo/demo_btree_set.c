@@ -0,0 +1,31 @@
+#include <stdio.h>
+#include "cstl.h"
+
+int main() {
+    btree_set_t *set1 = btree_set_new(Integer_compare, Integer_delete);
+    btree_set_t *set2 = btree_set_new(Integer_compare, Integer_delete);
+
+    for (int i = 0; i < 10; i++) {
+        btree_set_add(set1, Integer_new(i));
+    }
+
+    for (int i = 5; i < 15; i++) {
+        btree_set_add(set2, Integer_new(i));
+    }
+
+    btree_set_t *set3 = btree_set_intersection(set1, set2);
+
+    iterator_t *iterator = btree_set_iterator_new(set3);
+    while (btree_set_iterator_has_next(iterator)) {
+        Integer *integer = btree_set_iterator_next(iterator);
+        printf("%d ", Integer_get(integer));
+    }
+    printf("\n");
+
+    btree_set_iterator_delete(iterator);
+    btree_set_delete(set1);
+    btree_set_delete(set2);
+    btree_set_delete(set3);
+
+    return 0;
+}
@@ -0,0 +1,27 @@
+#include <stdio.h>
+#include "cstl.h"
+
+int main() {
+    indexed_heap_t *heap = indexed_heap_new(MIN_HEAP, Integer_compare, Integer_delete);
+    size_t handles[10];
+
+    for (int i = 0; i < 10; i++) {
+        handles[i] = indexed_heap_push(heap, Integer_new(randint(0, 100)));
+    }
+
+    /* Move the last element to the front and drop the first one */
+    Integer_set(indexed_heap_get(heap, handles[9]), -1);
+    indexed_heap_decrease_key(heap, handles[9]);
+    Integer_delete(indexed_heap_remove(heap, handles[0]));
+
+    while (!indexed_heap_is_empty(heap)) {
+        Integer *integer = indexed_heap_pop(heap);
+        printf("%d ", Integer_get(integer));
+        Integer_delete(integer);
+    }
+    printf("\n");
+
+    indexed_heap_delete(heap);
+
+    return 0;
+}
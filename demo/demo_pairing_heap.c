@@ -0,0 +1,27 @@
+#include <stdio.h>
+#include "cstl.h"
+
+int main() {
+    pairing_heap_t *heap = pairing_heap_new(MIN_HEAP, Integer_compare, Integer_delete);
+    pairing_heap_t *shard = NULL;
+
+    for (int s = 0; s < 3; s++) {
+        shard = pairing_heap_new(MIN_HEAP, Integer_compare, Integer_delete);
+        for (int i = 0; i < 4; i++) {
+            pairing_heap_push(shard, Integer_new(randint(0, 100)));
+        }
+        pairing_heap_meld(heap, shard);
+        pairing_heap_delete(shard);
+    }
+
+    while (!pairing_heap_is_empty(heap)) {
+        Integer *integer = pairing_heap_pop(heap);
+        printf("%d ", Integer_get(integer));
+        Integer_delete(integer);
+    }
+    printf("\n");
+
+    pairing_heap_delete(heap);
+
+    return 0;
+}
@@ -0,0 +1,47 @@
+#include <stdio.h>
+#include "cstl.h"
+
+#define VERSIONS 4
+
+/**
+ * @brief Account Balance History Demo
+ */
+int main() {
+    int accounts[] = {101, 102, 101, 103, 102, 101, 104, 103};
+    persistent_map_t *history[VERSIONS];
+    persistent_map_t *balances = persistent_map_new(Integer_compare);
+
+    /* Apply two deposits per day and keep a snapshot of every day */
+    for (int day = 0; day < VERSIONS; day++) {
+        for (int i = day * 2; i < day * 2 + 2; i++) {
+            Integer *account = Integer_new(accounts[i]);
+            Integer *balance = persistent_map_get(balances, account);
+            int amount = (balance == NULL ? 0 : Integer_get(balance)) + 10 * (i + 1);
+
+            pair_t *pair = pair_new(account, Integer_new(amount), Integer_delete, Integer_delete);
+            persistent_map_t *next = persistent_map_put(balances, pair);
+            persistent_map_delete(balances);
+            balances = next;
+        }
+        history[day] = persistent_map_snapshot(balances);
+    }
+
+    /* Old days stay readable, they share every unchanged node with the later ones */
+    for (int day = 0; day < VERSIONS; day++) {
+        printf("day %d:", day + 1);
+        iterator_t *iter = persistent_map_iterator_new(history[day]);
+        while (persistent_map_iterator_has_next(iter)) {
+            pair_t *pair = persistent_map_iterator_next(iter);
+            printf(" %d=%d", Integer_get(pair_get_key(pair)), Integer_get(pair_get_value(pair)));
+        }
+        persistent_map_iterator_delete(iter);
+        printf("\n");
+    }
+
+    for (int day = 0; day < VERSIONS; day++) {
+        persistent_map_delete(history[day]);
+    }
+    persistent_map_delete(balances);
+
+    return 0;
+}
@@ -0,0 +1,22 @@
+#include <stdio.h>
+#include "cstl.h"
+
+int main() {
+    radix_heap_t *heap = radix_heap_new(Integer_delete);
+
+    /* Each event schedules a follow-up at a later time */
+    for (int i = 0; i < 3; i++) {
+        radix_heap_push(heap, (unsigned long)randint(0, 10), Integer_new(i));
+    }
+
+    for (int i = 0; i < 10; i++) {
+        unsigned long time = radix_heap_peek_key(heap);
+        Integer *event = radix_heap_pop(heap);
+        printf("t=%lu event %d\n", time, Integer_get(event));
+        radix_heap_push(heap, time + (unsigned long)randint(1, 10), event);
+    }
+
+    radix_heap_delete(heap);
+
+    return 0;
+}
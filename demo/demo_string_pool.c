@@ -0,0 +1,32 @@
+#include <stdio.h>
+#include "cstl.h"
+
+void print_count(T pair) {
+    printf("%s: %d\n", (const char *)pair_get_key(pair), Integer_get(pair_get_value(pair)));
+}
+
+int main() {
+    const char *lines[] = {"cpu.load", "mem.free", "cpu.load", "disk.io", "cpu.load", "mem.free"};
+    string_pool_t *pool = string_pool_new();
+    hash_map_t *counts = hash_map_new(string_pool_compare, string_pool_hash);
+
+    // Count the metric names, each distinct name is stored once in the pool.
+    for (int i = 0; i < 6; i++) {
+        const char *name = string_pool_intern(pool, lines[i]);
+        Integer *count = hash_map_get(counts, (T)name);
+        if (count == NULL) {
+            hash_map_put(counts, pair_new((T)name, Integer_new(1), NULL, Integer_delete));
+        } else {
+            Integer_set(count, Integer_get(count) + 1);
+        }
+    }
+
+    hash_map_foreach(counts, print_count);
+    printf("%zu distinct names\n", string_pool_size(pool));
+
+    // The map refers to the interned names, so destroy it before the pool.
+    hash_map_delete(counts);
+    string_pool_delete(pool);
+
+    return 0;
+}
@@ -0,0 +1,28 @@
+#include <stdio.h>
+#include "cstl.h"
+
+void Integer_expire(T elem) {
+    printf("connection %d timed out\n", Integer_get(elem));
+    Integer_delete(elem);
+}
+
+int main() {
+    timer_wheel_t *wheel = timer_wheel_new(0, Integer_delete);
+    timer_wheel_timer_t *timers[5];
+
+    for (int i = 0; i < 5; i++) {
+        timers[i] = timer_wheel_arm(wheel, 1000, Integer_new(i));
+    }
+
+    /* Connection 1 stays active, connection 3 is closed by the peer */
+    timer_wheel_rearm(wheel, timers[1], 2500);
+    Integer_delete(timer_wheel_cancel(wheel, timers[3]));
+
+    for (unsigned long now = 500; now <= 3000; now += 500) {
+        printf("t=%lu fired %zu\n", now, timer_wheel_advance(wheel, now, Integer_expire));
+    }
+
+    timer_wheel_delete(wheel);
+
+    return 0;
+}
@@ -0,0 +1,32 @@
+#include <stdio.h>
+#include "cstl.h"
+
+void Integer_print(T elem) {
+    Integer *integer = (Integer *)elem;
+    printf("%d ", Integer_get(integer));
+}
+
+void Integer_triple(T elem) {
+    Integer *integer = (Integer *)elem;
+    Integer_set(integer, Integer_get(integer) * 3);
+}
+
+int main() {
+    unrolled_list_t *list = unrolled_list_new(Integer_compare, Integer_delete);
+
+    for (int i = 0; i < 10; i++) {
+        unrolled_list_push_back(list, Integer_new(i));
+    }
+
+    unrolled_list_foreach(list, Integer_print);
+    printf("\n");
+
+    unrolled_list_foreach(list, Integer_triple);
+
+    unrolled_list_foreach(list, Integer_print);
+    printf("\n");
+
+    unrolled_list_delete(list);
+
+    return 0;
+}
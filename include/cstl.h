@@ -8,20 +8,31 @@
 #include "utils/c_str.h"
 #include "utils/wrapper.h"
 #include "utils/generic.h"
+#include "utils/pool.h"
 
 #include "cstl/iterator.h"
 #include "cstl/str.h"
+#include "cstl/string_pool.h"
 #include "cstl/array.h"
 #include "cstl/list.h"
+#include "cstl/unrolled_list.h"
 #include "cstl/stack.h"
 #include "cstl/queue.h"
 #include "cstl/deque.h"
 #include "cstl/heap.h"
+#include "cstl/indexed_heap.h"
+#include "cstl/pairing_heap.h"
+#include "cstl/radix_heap.h"
+#include "cstl/timer_wheel.h"
 #include "cstl/red_black_tree.h"
+#include "cstl/btree.h"
 #include "cstl/hash_table.h"
 #include "cstl/tree_set.h"
+#include "cstl/btree_set.h"
 #include "cstl/hash_set.h"
 #include "cstl/tree_map.h"
+#include "cstl/btree_map.h"
 #include "cstl/hash_map.h"
+#include "cstl/persistent_map.h"
 
 #endif
@@ -136,6 +136,8 @@ array_t *array_reverse(array_t *array);
 
 /**
  * @brief Sort an array_t object in ascending order.
+ *        The sort is a stable bottom-up merge sort using the comparator of the array itself.
+ *        If the merge buffer cannot be allocated, it falls back to an in-place insertion sort.
  * @param array The array_t object.
  * @return Returns the modified array_t object.
  */
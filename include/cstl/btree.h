@@ -0,0 +1,241 @@
+#ifndef _BTREE_H_
+#define _BTREE_H_
+
+#include "utils/exception.h"
+#include "utils/types.h"
+#include "utils/generic.h"
+#include "array.h"
+#include "iterator.h"
+
+/**
+ * @brief B-tree with wide nodes.
+ *        Each node stores up to 31 keys contiguously, so a lookup touches a few
+ *        cache-friendly nodes instead of one malloc'd node per comparison.
+ */
+typedef struct btree_t btree_t;
+
+/**
+ * @brief Create a btree_t object.
+ * @param compare Callback function for comparing two data items.
+ * @param destroy Callback function for destroying a data item.
+ * @return Returns the btree_t object if create successfully, otherwise returns NULL.
+ */
+btree_t *btree_new(compare_t compare, destroy_t destroy);
+
+/**
+ * @brief Create a btree_t object which orders data items by an extracted key.
+ * @param compare Callback function for comparing two keys.
+ * @param key_of Callback function for extracting the key from a data item, or NULL to compare data items directly.
+ * @param destroy Callback function for destroying a data item.
+ * @return Returns the btree_t object if create successfully, otherwise returns NULL.
+ * @note The comparator and key extractor are stored per tree, so trees with different orderings can coexist.
+ *       Lookup and removal functions take the raw key rather than a whole data item.
+ */
+btree_t *btree_new_with_key(compare_t compare, key_of_t key_of, destroy_t destroy);
+
+/**
+ * @brief Create a btree_t object from the data items of an array_t object in strictly ascending order.
+ *        The nodes are filled level by level in O(n) without a single comparison-driven insert or split.
+ * @param compare Callback function for comparing two keys.
+ * @param key_of Callback function for extracting the key from a data item, or NULL to compare data items directly.
+ * @param destroy Callback function for destroying a data item.
+ * @param array The array_t object.
+ * @return Returns the btree_t object if create successfully, otherwise returns NULL,
+ *         including when the data items are not in strictly ascending order.
+ * @note The tree takes over the data items if successful. Caller MUST NOT destroy them through the array
+ *       afterwards (e.g. create the array with a NULL destroy callback).
+ */
+btree_t *btree_new_from_sorted(compare_t compare, key_of_t key_of, destroy_t destroy, const array_t *array);
+
+/**
+ * @brief Destroy a btree_t object.
+ * @param tree The btree_t object.
+ */
+void btree_delete(btree_t *tree);
+
+/**
+ * @brief Determine whether the btree_t object is empty.
+ * @param tree The btree_t object.
+ * @return Returns true if the btree_t object is empty, otherwise returns false.
+ */
+bool btree_is_empty(const btree_t *tree);
+
+/**
+ * @brief Get the number of keys in the btree_t object.
+ * @param tree The btree_t object.
+ * @return Returns the number of keys in the btree_t object.
+ */
+size_t btree_size(const btree_t *tree);
+
+/**
+ * @brief Clear the btree_t object.
+ * @param tree The btree_t object.
+ * @return Returns the modified btree_t object.
+ */
+btree_t *btree_clear(btree_t *tree);
+
+/**
+ * @brief Checks whether the btree_t object contains the key.
+ * @param tree The btree_t object.
+ * @param key The key.
+ * @return Returns true if the btree_t object contains the key, otherwise returns false.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+bool btree_contains(const btree_t *tree, T key);
+
+/**
+ * @brief Traverse the btree_t object.
+ * @param tree The btree_t object.
+ * @param visit Callback function for visiting a data item.
+ */
+void btree_foreach(btree_t *tree, visit_t visit);
+
+/**
+ * @brief Inserts a key into the B-tree.
+ *        If the tree already contains an equal key, the new key is destroyed (if applicable).
+ * @param tree The btree_t object.
+ * @param key The key.
+ * @return Returns the modified btree_t object.
+ */
+btree_t *btree_insert(btree_t *tree, T key);
+
+/**
+ * @brief Inserts a data item into the B-tree, or replaces the data item with an equal key in place.
+ *        The replaced data item is destroyed (if applicable).
+ * @param tree The btree_t object.
+ * @param data The data item.
+ * @return Returns the modified btree_t object.
+ */
+btree_t *btree_put(btree_t *tree, T data);
+
+/**
+ * @brief Removes a key from the btree_t object.
+ * @param tree The btree_t object.
+ * @param key The key.
+ * @return Returns the modified btree_t object.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+btree_t *btree_remove(btree_t *tree, T key);
+
+/**
+ * @brief Find the key in the btree_t object which is equal to the given key.
+ * @param tree The btree_t object.
+ * @param key The key.
+ * @return Returns the key stored in the tree if found, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+T btree_find(const btree_t *tree, T key);
+
+/**
+ * @brief Find the greatest key in the btree_t object which is less than or equal to the given key.
+ * @param tree The btree_t object.
+ * @param key The key.
+ * @return Returns the key stored in the tree if found, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+T btree_floor(const btree_t *tree, T key);
+
+/**
+ * @brief Find the least key in the btree_t object which is greater than or equal to the given key.
+ * @param tree The btree_t object.
+ * @param key The key.
+ * @return Returns the key stored in the tree if found, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+T btree_ceiling(const btree_t *tree, T key);
+
+/**
+ * @brief Find the greatest key in the btree_t object which is strictly less than the given key.
+ * @param tree The btree_t object.
+ * @param key The key.
+ * @return Returns the key stored in the tree if found, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+T btree_lower(const btree_t *tree, T key);
+
+/**
+ * @brief Find the least key in the btree_t object which is strictly greater than the given key.
+ * @param tree The btree_t object.
+ * @param key The key.
+ * @return Returns the key stored in the tree if found, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+T btree_higher(const btree_t *tree, T key);
+
+/**
+ * @brief Get the minimum key in the btree_t object.
+ * @param tree The btree_t object.
+ * @return Returns the minimum key if the tree is not empty, otherwise returns NULL.
+ */
+T btree_min(const btree_t *tree);
+
+/**
+ * @brief Get the maximum key in the btree_t object.
+ * @param tree The btree_t object.
+ * @return Returns the maximum key if the tree is not empty, otherwise returns NULL.
+ */
+T btree_max(const btree_t *tree);
+
+/**
+ * @brief Get the key with the specified rank in the btree_t object.
+ * @param tree The btree_t object.
+ * @param index The 0-based rank, i.e. the number of smaller keys.
+ * @return Returns the key if the index is valid, otherwise returns NULL.
+ */
+T btree_select(const btree_t *tree, size_t index);
+
+/**
+ * @brief Count the keys in the btree_t object which are strictly less than the given key.
+ * @param tree The btree_t object.
+ * @param key The key, which does not need to be in the tree.
+ * @return Returns the rank of the key.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+size_t btree_rank(const btree_t *tree, T key);
+
+/**
+ * @brief Create an iterator for a btree_t object.
+ * @param tree The btree_t object.
+ * @return Returns the iterator for container.
+ */
+iterator_t *btree_iterator_new(const btree_t *tree);
+
+/**
+ * @brief Create an iterator over the keys in [lo, hi) of a btree_t object in ascending order.
+ *        Seeking to the first key and locating the stop position both take O(log n).
+ * @param tree The btree_t object.
+ * @param lo The inclusive lower bound, or NULL for no lower bound.
+ * @param hi The exclusive upper bound, or NULL for no upper bound.
+ * @return Returns the iterator for container.
+ * @note Caller MUST free the parameters `lo` and `hi` (if applicable).
+ */
+iterator_t *btree_iterator_range(const btree_t *tree, T lo, T hi);
+
+/**
+ * @brief Create an iterator for a btree_t object in descending order.
+ * @param tree The btree_t object.
+ * @return Returns the iterator for container.
+ */
+iterator_t *btree_iterator_reverse(const btree_t *tree);
+
+/**
+ * @brief Destroy an iterator.
+ * @param iterator The iterator_t object.
+ */
+void btree_iterator_delete(iterator_t *iterator);
+
+/**
+ * @brief Determine whether an iterator has the next element.
+ * @param iterator The iterator_t object.
+ * @return Returns true if the iterator has the next element, otherwise returns false.
+ */
+bool btree_iterator_has_next(const iterator_t *iterator);
+
+/**
+ * @brief Get the next element of an iterator.
+ * @param iterator The iterator_t object.
+ * @return Returns the next element of the iterator.
+ */
+T btree_iterator_next(iterator_t *iterator);
+
+#endif
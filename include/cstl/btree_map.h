@@ -0,0 +1,202 @@
+#ifndef _BTREE_MAP_H_
+#define _BTREE_MAP_H_
+
+#include "utils/exception.h"
+#include "utils/types.h"
+#include "utils/generic.h"
+#include "cstl/pair.h"
+#include "iterator.h"
+
+typedef struct btree_map_t btree_map_t;
+
+/**
+ * @brief Create a btree_map_t object.
+ * @param compare Callback function for comparing two keys.
+ * @return Returns the created btree_map_t object if successful, otherwise returns NULL.
+ */
+btree_map_t *btree_map_new(compare_t compare);
+
+/**
+ * @brief Destroy a btree_map_t object.
+ * @param map The btree_map_t object.
+ */
+void btree_map_delete(btree_map_t *map);
+
+/**
+ * @brief Determine whether a btree_map_t object is empty.
+ * @param map The btree_map_t object.
+ * @return Returns true if the btree_map_t object is empty, otherwise returns false.
+ */
+bool btree_map_is_empty(btree_map_t *map);
+
+/**
+ * @brief Get the size of a btree_map_t object.
+ * @param map The btree_map_t object.
+ * @return Returns the size of the btree_map_t object.
+ */
+size_t btree_map_size(btree_map_t *map);
+
+/**
+ * @brief Traverse a btree_map_t object.
+ * @param map The btree_map_t object.
+ * @param visit Callback function for visiting a key-value pair.
+ */
+void btree_map_foreach(btree_map_t *map, visit_pair_t visit);
+
+/**
+ * @brief Clear a btree_map_t object.
+ * @param map The btree_map_t object.
+ * @return Returns the modified btree_map_t object.
+ */
+btree_map_t *btree_map_clear(btree_map_t *map);
+
+/**
+ * @brief Check if a btree_map_t object contains the specified key.
+ * @param map The btree_map_t object.
+ * @param key The key.
+ * @return Returns true if the btree_map_t object contains the specified key, otherwise returns false.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+bool btree_map_contains(const btree_map_t *map, T key);
+
+/**
+ * @brief Put a key-value pair into a btree_map_t object.
+ * @param map The btree_map_t object.
+ * @param pair The pair_t object.
+ * @return Returns the modified btree_map_t object.
+ */
+btree_map_t *btree_map_put(btree_map_t *map, pair_t *pair);
+
+/**
+ * @brief Remove a key-value pair from a btree_map_t object by given key.
+ * @param map The btree_map_t object.
+ * @param key The key.
+ * @return Returns the modified btree_map_t object.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+btree_map_t *btree_map_remove(btree_map_t *map, T key);
+
+/**
+ * @brief Get the value of a key-value pair by given key.
+ * @param map The btree_map_t object.
+ * @param key The key.
+ * @return Returns the value of the key-value pair if found, otherwise NULL.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+T btree_map_get(const btree_map_t *map, T key);
+
+/**
+ * @brief Get the key-value pair with the greatest key less than or equal to the given key.
+ * @param map The btree_map_t object.
+ * @param key The key.
+ * @return Returns the pair_t object if found, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable). The returned pair is owned by the map.
+ */
+pair_t *btree_map_floor(const btree_map_t *map, T key);
+
+/**
+ * @brief Get the key-value pair with the least key greater than or equal to the given key.
+ * @param map The btree_map_t object.
+ * @param key The key.
+ * @return Returns the pair_t object if found, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable). The returned pair is owned by the map.
+ */
+pair_t *btree_map_ceiling(const btree_map_t *map, T key);
+
+/**
+ * @brief Get the key-value pair with the greatest key strictly less than the given key.
+ * @param map The btree_map_t object.
+ * @param key The key.
+ * @return Returns the pair_t object if found, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable). The returned pair is owned by the map.
+ */
+pair_t *btree_map_lower(const btree_map_t *map, T key);
+
+/**
+ * @brief Get the key-value pair with the least key strictly greater than the given key.
+ * @param map The btree_map_t object.
+ * @param key The key.
+ * @return Returns the pair_t object if found, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable). The returned pair is owned by the map.
+ */
+pair_t *btree_map_higher(const btree_map_t *map, T key);
+
+/**
+ * @brief Get the key-value pair with the least key.
+ * @param map The btree_map_t object.
+ * @return Returns the pair_t object if the map is not empty, otherwise returns NULL.
+ * @note The returned pair is owned by the map.
+ */
+pair_t *btree_map_first(const btree_map_t *map);
+
+/**
+ * @brief Get the key-value pair with the greatest key.
+ * @param map The btree_map_t object.
+ * @return Returns the pair_t object if the map is not empty, otherwise returns NULL.
+ * @note The returned pair is owned by the map.
+ */
+pair_t *btree_map_last(const btree_map_t *map);
+
+/**
+ * @brief Get the key-value pair whose key has the specified rank in O(log n).
+ * @param map The btree_map_t object.
+ * @param index The 0-based rank, i.e. the number of smaller keys.
+ * @return Returns the pair_t object if the index is valid, otherwise returns NULL.
+ * @note The returned pair is owned by the map.
+ */
+pair_t *btree_map_select(const btree_map_t *map, size_t index);
+
+/**
+ * @brief Count the keys in the btree_map_t object which are less than the given key in O(log n).
+ * @param map The btree_map_t object.
+ * @param key The key, which does not need to be in the map.
+ * @return Returns the rank of the key.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+size_t btree_map_rank(const btree_map_t *map, T key);
+
+/**
+ * @brief Create an iterator for a btree_map_t object.
+ * @param map The btree_map_t object.
+ * @return Returns the iterator for container.
+ */
+iterator_t *btree_map_iterator_new(const btree_map_t *map);
+
+/**
+ * @brief Create an iterator over the pairs whose keys are in [lo, hi) of a btree_map_t object in ascending order.
+ * @param map The btree_map_t object.
+ * @param lo The inclusive lower bound, or NULL for no lower bound.
+ * @param hi The exclusive upper bound, or NULL for no upper bound.
+ * @return Returns the iterator for container.
+ * @note Caller MUST free the parameters `lo` and `hi` (if applicable).
+ */
+iterator_t *btree_map_iterator_range(const btree_map_t *map, T lo, T hi);
+
+/**
+ * @brief Create an iterator for a btree_map_t object in descending order of keys.
+ * @param map The btree_map_t object.
+ * @return Returns the iterator for container.
+ */
+iterator_t *btree_map_iterator_reverse(const btree_map_t *map);
+
+/**
+ * @brief Destroy an iterator.
+ * @param iterator The iterator_t object.
+ */
+void btree_map_iterator_delete(iterator_t *iterator);
+
+/**
+ * @brief Determine whether an iterator has the next element.
+ * @param iterator The iterator_t object.
+ * @return Returns true if the iterator has the next element, otherwise returns false.
+ */
+bool btree_map_iterator_has_next(const iterator_t *iterator);
+
+/**
+ * @brief Get the next pair of an iterator.
+ * @param iterator The iterator_t object.
+ * @return Returns the next pair of the iterator.
+ */
+T btree_map_iterator_next(iterator_t *iterator);
+
+#endif
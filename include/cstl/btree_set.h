@@ -0,0 +1,198 @@
+#ifndef _BTREE_SET_H_
+#define _BTREE_SET_H_
+
+#include "utils/exception.h"
+#include "utils/types.h"
+#include "utils/generic.h"
+#include "iterator.h"
+
+typedef struct btree_set_t btree_set_t;
+
+/**
+ * @brief Create a btree_set_t object.
+ * @param compare Callback function for comparing two data items.
+ * @param destroy Callback function for destroying a data item.
+ * @return Returns the created btree_set_t object if successful, otherwise returns NULL.
+ */
+btree_set_t *btree_set_new(compare_t compare, destroy_t destroy);
+
+/**
+ * @brief Destroy a btree_set_t object.
+ * @param set The btree_set_t object.
+ */
+void btree_set_delete(btree_set_t *set);
+
+/**
+ * @brief Determine whether a btree_set_t object is empty.
+ * @param set The btree_set_t object.
+ * @return Returns true if the btree_set_t object is empty, otherwise returns false.
+ */
+bool btree_set_is_empty(const btree_set_t *set);
+
+/**
+ * @brief Get the size of a btree_set_t object.
+ * @param set The btree_set_t object.
+ * @return Returns the size of the btree_set_t object.
+ */
+size_t btree_set_size(const btree_set_t *set);
+
+/**
+ * @brief Traverse a btree_set_t object.
+ * @param set The btree_set_t object.
+ * @param visit Callback function for visiting a data item.
+ */
+void btree_set_foreach(btree_set_t *set, visit_t visit);
+
+/**
+ * @brief Clear a btree_set_t object.
+ * @param set The btree_set_t object.
+ * @return Returns the modified btree_set_t object.
+ */
+btree_set_t *btree_set_clear(btree_set_t *set);
+
+/**
+ * @brief Check if a btree_set_t object contains the specified element.
+ * @param set The btree_set_t object.
+ * @param elem The element.
+ * @return Returns true if the btree_set_t object contains the specified element, otherwise returns false.
+ * @note Caller MUST free the parameter `elem` (if applicable).
+ */
+bool btree_set_contains(const btree_set_t *set, T elem);
+
+/**
+ * @brief Add an element to the btree_set_t object.
+ * @param set The btree_set_t object.
+ * @param elem The element.
+ * @return Returns the modified btree_set_t object.
+ */
+btree_set_t *btree_set_add(btree_set_t *set, T elem);
+
+/**
+ * @brief Remove the element from the btree_set_t object.
+ * @param set The btree_set_t object.
+ * @param elem The element.
+ * @return Returns the modified btree_set_t object.
+ * @note Caller MUST free the parameter `elem` (if applicable).
+ */
+btree_set_t *btree_set_remove(btree_set_t *set, T elem);
+
+/**
+ * @brief Get the element with the specified rank in the btree_set_t object in O(log n).
+ * @param set The btree_set_t object.
+ * @param index The 0-based rank, i.e. the number of smaller elements.
+ * @return Returns the element if the index is valid, otherwise returns NULL.
+ */
+T btree_set_select(const btree_set_t *set, size_t index);
+
+/**
+ * @brief Count the elements in the btree_set_t object which are less than the given element in O(log n).
+ * @param set The btree_set_t object.
+ * @param elem The element, which does not need to be in the set.
+ * @return Returns the rank of the element.
+ * @note Caller MUST free the parameter `elem` (if applicable).
+ */
+size_t btree_set_rank(const btree_set_t *set, T elem);
+
+/**
+ * @brief Get the union of two btree_set_t objects.
+ * @param set1 The first btree_set_t object.
+ * @param set2 The second btree_set_t object.
+ * @return Returns the union of two btree_set_t objects.
+ * @note Caller MUST destroy the returned union btree_set_t object.
+ */
+btree_set_t *btree_set_union(const btree_set_t *set1, const btree_set_t *set2);
+
+/**
+ * @brief Get the intersection of two btree_set_t objects.
+ * @param set1 The first btree_set_t object.
+ * @param set2 The second btree_set_t object.
+ * @return Returns the intersection of two btree_set_t objects.
+ * @note Caller MUST destroy the returned intersection btree_set_t object.
+ */
+btree_set_t *btree_set_intersection(const btree_set_t *set1, const btree_set_t *set2);
+
+/**
+ * @brief Get the difference of two btree_set_t objects.
+ *        A - B
+ * @param set1 The first btree_set_t object.
+ * @param set2 The second btree_set_t object.
+ * @return Returns the difference of two btree_set_t objects.
+ * @note Caller MUST destroy the returned difference btree_set_t object.
+ */
+btree_set_t *btree_set_difference(const btree_set_t *set1, const btree_set_t *set2);
+
+/**
+ * @brief Get the symmetric difference of two btree_set_t objects.
+ *        (A - B) U (B - A)
+ * @param set1 The first btree_set_t object.
+ * @param set2 The second btree_set_t object.
+ * @return Returns the symmetric difference of two btree_set_t objects.
+ * @note Caller MUST destroy the returned symmetric difference btree_set_t object.
+ */
+btree_set_t *btree_set_symmetric_difference(const btree_set_t *set1, const btree_set_t *set2);
+
+/**
+ * @brief Determine if two btree_set_t objects are disjoint.
+ *        Two sets are disjoint if their intersection is empty.
+ * @param set1 The first btree_set_t object.
+ * @param set2 The second btree_set_t object.
+ * @return Returns true if two btree_set_t objects are disjoint, otherwise returns false,
+ *         including when the iterators cannot be allocated.
+ */
+bool btree_set_is_disjoint(const btree_set_t *set1, const btree_set_t *set2);
+
+/**
+ * @brief Determine if set1 is a subset of set2.
+ *        A is a subset B if every element of A is also an element of B.
+ * @param set1 The first btree_set_t object.
+ * @param set2 The second btree_set_t object.
+ * @return Returns true if set1 is a subset of set2, otherwise returns false,
+ *         including when the iterator cannot be allocated.
+ */
+bool btree_set_is_subset(const btree_set_t *set1, const btree_set_t *set2);
+
+/**
+ * @brief Create an iterator for a btree_set_t object.
+ * @param set The btree_set_t object.
+ * @return Returns the iterator for container.
+ */
+iterator_t *btree_set_iterator_new(const btree_set_t *set);
+
+/**
+ * @brief Create an iterator over the elements in [lo, hi) of a btree_set_t object in ascending order.
+ * @param set The btree_set_t object.
+ * @param lo The inclusive lower bound, or NULL for no lower bound.
+ * @param hi The exclusive upper bound, or NULL for no upper bound.
+ * @return Returns the iterator for container.
+ * @note Caller MUST free the parameters `lo` and `hi` (if applicable).
+ */
+iterator_t *btree_set_iterator_range(const btree_set_t *set, T lo, T hi);
+
+/**
+ * @brief Create an iterator for a btree_set_t object in descending order.
+ * @param set The btree_set_t object.
+ * @return Returns the iterator for container.
+ */
+iterator_t *btree_set_iterator_reverse(const btree_set_t *set);
+
+/**
+ * @brief Destroy an iterator.
+ * @param iterator The iterator_t object.
+ */
+void btree_set_iterator_delete(iterator_t *iterator);
+
+/**
+ * @brief Determine whether an iterator has the next element.
+ * @param iterator The iterator_t object.
+ * @return Returns true if the iterator has the next element, otherwise returns false.
+ */
+bool btree_set_iterator_has_next(const iterator_t *iterator);
+
+/**
+ * @brief Get the next element of an iterator.
+ * @param iterator The iterator_t object.
+ * @return Returns the next element of the iterator.
+ */
+T btree_set_iterator_next(iterator_t *iterator);
+
+#endif
@@ -133,6 +133,32 @@ bool hash_set_is_disjoint(const hash_set_t *set1, const hash_set_t *set2);
  */
 bool hash_set_is_subset(const hash_set_t *set1, const hash_set_t *set2);
 
+/**
+ * @brief Add every element of another hash_set_t object to a hash_set_t object.
+ * @param set The hash_set_t object to modify.
+ * @param other The other hash_set_t object.
+ * @return Returns the modified hash_set_t object, or NULL if both sets destroy their elements
+ *         or the memory allocation fails. `set` is left unchanged in that case.
+ * @note The added elements are shared with `other`, so at most one of the two sets may destroy them.
+ */
+hash_set_t *hash_set_union_into(hash_set_t *set, const hash_set_t *other);
+
+/**
+ * @brief Remove from a hash_set_t object every element that is not in another one.
+ * @param set The hash_set_t object to modify.
+ * @param other The other hash_set_t object.
+ * @return Returns the modified hash_set_t object.
+ */
+hash_set_t *hash_set_retain_all(hash_set_t *set, const hash_set_t *other);
+
+/**
+ * @brief Remove from a hash_set_t object every element that is in another one.
+ * @param set The hash_set_t object to modify.
+ * @param other The other hash_set_t object.
+ * @return Returns the modified hash_set_t object.
+ */
+hash_set_t *hash_set_remove_all(hash_set_t *set, const hash_set_t *other);
+
 /**
  * @brief Create an iterator for a hash_set_t object.
  * @param set The hash_set_t object.
@@ -60,6 +60,15 @@ hash_table_t *hash_table_clear(hash_table_t *hash_table);
  */
 bool hash_table_contains(const hash_table_t *hash_table, T key);
 
+/**
+ * @brief Reserve buckets for at least `n` key-value pairs in a hash_table_t object.
+ *        Putting up to `n` pairs afterwards does not trigger any rehash.
+ * @param hash_table The hash_table_t object.
+ * @param n The number of key-value pairs.
+ * @return Returns the modified hash_table_t object, or NULL if the memory allocation fails.
+ */
+hash_table_t *hash_table_reserve(hash_table_t *hash_table, size_t n);
+
 /**
  * @brief Put a key-value pair into a hash_table_t object.
  * @param hash_table The hash_table_t object.
@@ -113,4 +122,14 @@ bool hash_table_iterator_has_next(const iterator_t *iterator);
  */
 pair_t *hash_table_iterator_next(iterator_t *iterator);
 
+/**
+ * @brief Remove the pair last returned by the iterator.
+ *        The iteration continues with the pair following the removed one.
+ *        A second removal before the next `hash_table_iterator_next()` fails.
+ * @param iterator The iterator_t object.
+ * @return Returns the removed pair if successful, otherwise returns NULL.
+ * @note Caller MUST destroy the returned pair.
+ */
+pair_t *hash_table_iterator_remove(iterator_t *iterator);
+
 #endif
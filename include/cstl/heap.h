@@ -4,6 +4,7 @@
 #include "utils/exception.h"
 #include "utils/types.h"
 #include "utils/generic.h"
+#include "cstl/array.h"
 
 typedef struct heap_t heap_t;
 
@@ -21,6 +22,30 @@ typedef enum heap_type_t {
  */
 heap_t *heap_new(heap_type_t heap_type, compare_t compare, destroy_t destroy);
 
+/**
+ * @brief Create a heap_t object in which every node has `arity` children.
+ *        The children of a node are adjacent in memory, so a wider heap is shallower and
+ *        touches fewer cache lines per sift at the cost of more comparisons per level.
+ * @param heap_type The type of the heap (MIN_HEAP/MAX_HEAP).
+ * @param compare Callback function for comparing two data items.
+ * @param destroy Callback function for destroying a data item.
+ * @param arity The number of children of every node (2, 4 or 8).
+ * @return Returns the created heap_t object if successful, otherwise returns NULL.
+ */
+heap_t *heap_new_with_arity(heap_type_t heap_type, compare_t compare, destroy_t destroy, size_t arity);
+
+/**
+ * @brief Create a heap_t object from the elements of an array_t object in O(n).
+ * @param heap_type The type of the heap (MIN_HEAP/MAX_HEAP).
+ * @param compare Callback function for comparing two data items.
+ * @param destroy Callback function for destroying a data item.
+ * @param array The array_t object.
+ * @return Returns the created heap_t object if successful, otherwise returns NULL.
+ * @note The heap takes over the elements if successful. Caller MUST NOT destroy them through the array
+ *       afterwards (e.g. create the array with a NULL destroy callback).
+ */
+heap_t *heap_new_from_array(heap_type_t heap_type, compare_t compare, destroy_t destroy, const array_t *array);
+
 /**
  * @brief Destroy a heap_t object.
  * @param heap The heap_t object.
@@ -71,4 +96,38 @@ T heap_pop(heap_t *heap);
  */
 T heap_peek(const heap_t *heap);
 
+/**
+ * @brief Push the elements of an array_t object into a heap_t object.
+ *        The batch is appended and the whole heap re-heapified in O(n + k) when that is cheaper
+ *        than k pushes of O(log(n + k)) each.
+ * @param heap The heap_t object.
+ * @param array The array_t object.
+ * @return Returns the modified heap_t object, or NULL if the memory allocation fails.
+ *         The heap is unchanged in that case and the caller keeps the elements.
+ * @note The heap takes over the elements. Caller MUST NOT destroy them through the array
+ *       afterwards (e.g. create the array with a NULL destroy callback).
+ */
+heap_t *heap_push_many(heap_t *heap, const array_t *array);
+
+/**
+ * @brief Push an element into a heap_t object, then pop the root, with a single sift down.
+ *        If the element would be the new root, it is returned right away and the heap is unchanged.
+ * @param heap The heap_t object.
+ * @param elem The element, which MUST NOT be NULL.
+ * @return Returns the popped element, or NULL if `elem` is NULL, in which case the heap is unchanged.
+ * @note Caller MUST free the returned element (if applicable).
+ */
+T heap_pushpop(heap_t *heap, T elem);
+
+/**
+ * @brief Pop the root of a heap_t object, then push an element, with a single sift down.
+ *        Unlike heap_pushpop, the returned element is the old root even if the new element would precede it.
+ * @param heap The heap_t object.
+ * @param elem The element, which MUST NOT be NULL.
+ * @return Returns the popped element, or NULL if the heap_t object was empty or `elem` is NULL.
+ *         If the heap was empty and `elem` cannot be pushed, `elem` itself is returned.
+ * @note Caller MUST free the returned element (if applicable).
+ */
+T heap_replace(heap_t *heap, T elem);
+
 #endif
@@ -0,0 +1,125 @@
+#ifndef _INDEXED_HEAP_H_
+#define _INDEXED_HEAP_H_
+
+#include "utils/exception.h"
+#include "utils/types.h"
+#include "utils/generic.h"
+#include "cstl/heap.h"
+
+/* The handle returned when an element cannot be pushed */
+#define INDEXED_HEAP_INVALID_HANDLE ((size_t)-1)
+
+typedef struct indexed_heap_t indexed_heap_t;
+
+/**
+ * @brief Create an indexed_heap_t object.
+ * @param heap_type The type of the heap (MIN_HEAP/MAX_HEAP).
+ * @param compare Callback function for comparing two data items.
+ * @param destroy Callback function for destroying a data item.
+ * @return Returns the created indexed_heap_t object if successful, otherwise returns NULL.
+ */
+indexed_heap_t *indexed_heap_new(heap_type_t heap_type, compare_t compare, destroy_t destroy);
+
+/**
+ * @brief Destroy an indexed_heap_t object.
+ * @param heap The indexed_heap_t object.
+ */
+void indexed_heap_delete(indexed_heap_t *heap);
+
+/**
+ * @brief Determine whether an indexed_heap_t object is empty.
+ * @param heap The indexed_heap_t object.
+ * @return Returns true if the indexed_heap_t object is empty, otherwise returns false.
+ */
+bool indexed_heap_is_empty(const indexed_heap_t *heap);
+
+/**
+ * @brief Get the size of an indexed_heap_t object.
+ * @param heap The indexed_heap_t object.
+ * @return Returns the size of the indexed_heap_t object.
+ */
+size_t indexed_heap_size(const indexed_heap_t *heap);
+
+/**
+ * @brief Clear an indexed_heap_t object.
+ *        All handles become invalid.
+ * @param heap The indexed_heap_t object.
+ * @return Returns the modified indexed_heap_t object.
+ */
+indexed_heap_t *indexed_heap_clear(indexed_heap_t *heap);
+
+/**
+ * @brief Push an element into an indexed_heap_t object.
+ * @param heap The indexed_heap_t object.
+ * @param elem The element.
+ * @return Returns the handle of the element, which stays valid until the element leaves the heap,
+ *         or INDEXED_HEAP_INVALID_HANDLE if the element cannot be pushed.
+ * @note The handle of an element that left the heap may be reused by a later push.
+ */
+size_t indexed_heap_push(indexed_heap_t *heap, T elem);
+
+/**
+ * @brief Pop the root element from an indexed_heap_t object.
+ * @param heap The indexed_heap_t object.
+ * @return Returns the popped element.
+ * @note Caller MUST free the returned element (if applicable).
+ */
+T indexed_heap_pop(indexed_heap_t *heap);
+
+/**
+ * @brief Peek the root element of an indexed_heap_t object.
+ * @param heap The indexed_heap_t object.
+ * @return Returns the root element.
+ */
+T indexed_heap_peek(const indexed_heap_t *heap);
+
+/**
+ * @brief Get the handle of the root element of an indexed_heap_t object.
+ * @param heap The indexed_heap_t object.
+ * @return Returns the handle of the root element, or INDEXED_HEAP_INVALID_HANDLE if the heap is empty.
+ */
+size_t indexed_heap_peek_handle(const indexed_heap_t *heap);
+
+/**
+ * @brief Determine whether a handle refers to an element in an indexed_heap_t object.
+ * @param heap The indexed_heap_t object.
+ * @param handle The handle.
+ * @return Returns true if the handle refers to an element in the heap, otherwise returns false.
+ */
+bool indexed_heap_contains(const indexed_heap_t *heap, size_t handle);
+
+/**
+ * @brief Get the element of a handle in an indexed_heap_t object.
+ * @param heap The indexed_heap_t object.
+ * @param handle The handle.
+ * @return Returns the element if the handle is valid, otherwise returns NULL.
+ */
+T indexed_heap_get(const indexed_heap_t *heap, size_t handle);
+
+/**
+ * @brief Restore the position of an element after its priority changed in either direction in O(log n).
+ * @param heap The indexed_heap_t object.
+ * @param handle The handle of the changed element.
+ * @return Returns the modified indexed_heap_t object.
+ */
+indexed_heap_t *indexed_heap_update(indexed_heap_t *heap, size_t handle);
+
+/**
+ * @brief Restore the position of an element after it moved towards the root in O(log n).
+ *        That is a smaller key for a MIN_HEAP and a larger key for a MAX_HEAP.
+ * @param heap The indexed_heap_t object.
+ * @param handle The handle of the changed element.
+ * @return Returns the modified indexed_heap_t object.
+ */
+indexed_heap_t *indexed_heap_decrease_key(indexed_heap_t *heap, size_t handle);
+
+/**
+ * @brief Remove an element from an indexed_heap_t object by its handle in O(log n).
+ * @param heap The indexed_heap_t object.
+ * @param handle The handle.
+ * @return Returns the removed element if the handle is valid, otherwise returns NULL.
+ * @note Caller MUST free the returned element (if applicable).
+ */
+T indexed_heap_remove(indexed_heap_t *heap, size_t handle);
+
+#endif
@@ -4,10 +4,18 @@
 #include "utils/exception.h"
 #include "utils/types.h"
 #include "utils/generic.h"
+#include "utils/pool.h"
 #include "iterator.h"
 
 typedef struct list_t list_t;
 
+/**
+ * @brief Create a pool_t object for allocating nodes of list_t objects.
+ * @return Returns the created pool_t object if successful, otherwise returns NULL.
+ * @note Caller MUST destroy the returned pool with `pool_delete()` after all lists using it are destroyed.
+ */
+pool_t *list_pool_new(void);
+
 /**
  * @brief Create a list_t object.
  * @param compare Callback function for comparing two data items.
@@ -16,6 +24,16 @@ typedef struct list_t list_t;
  */
 list_t *list_new(compare_t compare, destroy_t destroy);
 
+/**
+ * @brief Create a list_t object which allocates its nodes from a shared pool.
+ * @param compare Callback function for comparing two data items.
+ * @param destroy Callback function for destroying a data item.
+ * @param pool The pool_t object created by `list_pool_new()`.
+ * @return Returns the created list_t object if successful, otherwise returns NULL.
+ * @note The pool is not owned by the list and MUST outlive it.
+ */
+list_t *list_new_with_pool(compare_t compare, destroy_t destroy, pool_t *pool);
+
 /**
  * @brief Destroy a list_t object.
  * @param list The list_t object.
@@ -162,8 +180,38 @@ T list_remove(list_t *list, size_t index);
  */
 list_t *list_reverse(list_t *list);
 
+/**
+ * @brief Sort the list_t object in ascending order.
+ *        Stable bottom-up merge sort which relinks the nodes in place without allocating.
+ * @param list The list_t object.
+ * @return Returns the modified list_t object.
+ */
+list_t *list_sort(list_t *list);
+
+/**
+ * @brief Move all elements of `other` into the list_t object before the specified position.
+ * @param list The list_t object.
+ * @param index The index. Passing the size of `list` appends the elements.
+ * @param other The list_t object to be emptied.
+ * @return Returns the modified list_t object.
+ * @note The moved elements are owned by `list` afterwards.
+ */
+list_t *list_splice(list_t *list, size_t index, list_t *other);
+
+/**
+ * @brief Merge the sorted list `other` into the sorted list_t object.
+ *        The merge is stable: equal elements of `list` precede those of `other`.
+ * @param list The list_t object sorted in ascending order.
+ * @param other The list_t object sorted in ascending order, which is emptied.
+ * @return Returns the modified list_t object.
+ * @note The moved elements are owned by `list` afterwards.
+ */
+list_t *list_merge(list_t *list, list_t *other);
+
 /**
  * @brief Create an iterator for a list_t object.
+ *        The iterator is a cursor on the element last returned by `list_iterator_next()`,
+ *        which can be removed, replaced or used as an insert position in O(1).
  * @param list The list_t object.
  * @return Returns the iterator for container.
  */
@@ -189,4 +237,42 @@ bool list_iterator_has_next(const iterator_t *iterator);
  */
 T list_iterator_next(iterator_t *iterator);
 
+/**
+ * @brief Remove the element last returned by the iterator in O(1).
+ *        The iteration continues with the element following the removed one.
+ *        Until the next `list_iterator_next()`, there is no element to remove, replace or insert before.
+ * @param iterator The iterator_t object.
+ * @return Returns the removed element if successful, otherwise returns NULL.
+ * @note Caller MUST free the returned element (if applicable).
+ */
+T list_iterator_remove(iterator_t *iterator);
+
+/**
+ * @brief Replace the element last returned by the iterator in O(1).
+ * @param iterator The iterator_t object.
+ * @param elem The element.
+ * @return Returns the iterator_t object.
+ */
+iterator_t *list_iterator_set(iterator_t *iterator, T elem);
+
+/**
+ * @brief Insert an element before the element last returned by the iterator in O(1).
+ *        The inserted element is not returned by the following `list_iterator_next()`.
+ * @param iterator The iterator_t object.
+ * @param elem The element.
+ * @return Returns the iterator_t object.
+ */
+iterator_t *list_iterator_insert_before(iterator_t *iterator, T elem);
+
+/**
+ * @brief Insert an element after the element last returned by the iterator in O(1).
+ *        The inserted element is returned by the following `list_iterator_next()`.
+ *        If no element has been returned yet, the element is inserted at the beginning,
+ *        and after a removal it takes the place of the removed element.
+ * @param iterator The iterator_t object.
+ * @param elem The element.
+ * @return Returns the iterator_t object.
+ */
+iterator_t *list_iterator_insert_after(iterator_t *iterator, T elem);
+
 #endif
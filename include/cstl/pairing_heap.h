@@ -0,0 +1,115 @@
+#ifndef _PAIRING_HEAP_H_
+#define _PAIRING_HEAP_H_
+
+#include "utils/exception.h"
+#include "utils/types.h"
+#include "utils/generic.h"
+#include "cstl/heap.h"
+
+/**
+ * @brief Pairing heap.
+ *        A heap-ordered multiway tree whose roots are linked in O(1), so two heaps meld
+ *        in O(1) and the restructuring work is deferred to pop, which pairs up the
+ *        children of the old root in two passes in amortized O(log n).
+ */
+typedef struct pairing_heap_t pairing_heap_t;
+
+typedef struct pairing_heap_node_t pairing_heap_node_t;
+
+/**
+ * @brief Create a pairing_heap_t object.
+ * @param heap_type The type of the heap (MIN_HEAP/MAX_HEAP).
+ * @param compare Callback function for comparing two data items.
+ * @param destroy Callback function for destroying a data item.
+ * @return Returns the created pairing_heap_t object if successful, otherwise returns NULL.
+ */
+pairing_heap_t *pairing_heap_new(heap_type_t heap_type, compare_t compare, destroy_t destroy);
+
+/**
+ * @brief Destroy a pairing_heap_t object.
+ * @param heap The pairing_heap_t object.
+ */
+void pairing_heap_delete(pairing_heap_t *heap);
+
+/**
+ * @brief Determine whether a pairing_heap_t object is empty.
+ * @param heap The pairing_heap_t object.
+ * @return Returns true if the pairing_heap_t object is empty, otherwise returns false.
+ */
+bool pairing_heap_is_empty(const pairing_heap_t *heap);
+
+/**
+ * @brief Get the size of a pairing_heap_t object.
+ * @param heap The pairing_heap_t object.
+ * @return Returns the size of the pairing_heap_t object.
+ */
+size_t pairing_heap_size(const pairing_heap_t *heap);
+
+/**
+ * @brief Clear a pairing_heap_t object.
+ * @param heap The pairing_heap_t object.
+ * @return Returns the modified pairing_heap_t object.
+ */
+pairing_heap_t *pairing_heap_clear(pairing_heap_t *heap);
+
+/**
+ * @brief Push an element into a pairing_heap_t object in O(1).
+ * @param heap The pairing_heap_t object.
+ * @param elem The element.
+ * @return Returns the node holding the element, which stays valid until the element leaves the heap,
+ *         or NULL if the element cannot be pushed.
+ */
+pairing_heap_node_t *pairing_heap_push(pairing_heap_t *heap, T elem);
+
+/**
+ * @brief Pop the root element from a pairing_heap_t object in amortized O(log n).
+ * @param heap The pairing_heap_t object.
+ * @return Returns the popped element.
+ * @note Caller MUST free the returned element (if applicable).
+ */
+T pairing_heap_pop(pairing_heap_t *heap);
+
+/**
+ * @brief Peek the root element of a pairing_heap_t object.
+ * @param heap The pairing_heap_t object.
+ * @return Returns the root element.
+ */
+T pairing_heap_peek(const pairing_heap_t *heap);
+
+/**
+ * @brief Move all elements of another pairing_heap_t object into a pairing_heap_t object.
+ *        The two roots are linked in O(1) and the node slabs of `other` are handed over without
+ *        copying, so its nodes stay valid and now belong to `heap`, `other` is left empty.
+ * @param heap The pairing_heap_t object.
+ * @param other The pairing_heap_t object to be melded, with the same heap type and compare function.
+ * @return Returns the modified pairing_heap_t object, or NULL if the two heaps are not compatible.
+ * @note Caller MUST destroy the parameter `other`.
+ */
+pairing_heap_t *pairing_heap_meld(pairing_heap_t *heap, pairing_heap_t *other);
+
+/**
+ * @brief Get the element held by a node of a pairing_heap_t object.
+ * @param node The pairing_heap_node_t object.
+ * @return Returns the element.
+ */
+T pairing_heap_node_get(const pairing_heap_node_t *node);
+
+/**
+ * @brief Restore the position of a node after its element moved towards the root in amortized O(log n).
+ *        That is a smaller key for a MIN_HEAP and a larger key for a MAX_HEAP.
+ * @param heap The pairing_heap_t object.
+ * @param node The node of the changed element.
+ * @return Returns the modified pairing_heap_t object.
+ */
+pairing_heap_t *pairing_heap_decrease_key(pairing_heap_t *heap, pairing_heap_node_t *node);
+
+/**
+ * @brief Remove a node from a pairing_heap_t object in amortized O(log n).
+ * @param heap The pairing_heap_t object.
+ * @param node The node.
+ * @return Returns the element held by the removed node.
+ * @note Caller MUST free the returned element (if applicable).
+ */
+T pairing_heap_remove(pairing_heap_t *heap, pairing_heap_node_t *node);
+
+#endif
@@ -0,0 +1,123 @@
+#ifndef _PERSISTENT_MAP_H_
+#define _PERSISTENT_MAP_H_
+
+#include "utils/exception.h"
+#include "utils/types.h"
+#include "utils/generic.h"
+#include "cstl/pair.h"
+#include "iterator.h"
+
+typedef struct persistent_map_t persistent_map_t;
+
+/**
+ * @brief Create an empty persistent_map_t object.
+ * @param compare Callback function for comparing two keys.
+ * @return Returns the created persistent_map_t object if successful, otherwise returns NULL.
+ */
+persistent_map_t *persistent_map_new(compare_t compare);
+
+/**
+ * @brief Destroy a version of a persistent_map_t object.
+ *        The pairs are destroyed once no remaining version refers to them.
+ * @param map The persistent_map_t object.
+ */
+void persistent_map_delete(persistent_map_t *map);
+
+/**
+ * @brief Take a snapshot of a persistent_map_t object in O(1).
+ *        The snapshot shares every node with the original version.
+ * @param map The persistent_map_t object.
+ * @return Returns the snapshot if successful, otherwise returns NULL.
+ * @note Caller MUST destroy the returned persistent_map_t object.
+ */
+persistent_map_t *persistent_map_snapshot(const persistent_map_t *map);
+
+/**
+ * @brief Determine whether a persistent_map_t object is empty.
+ * @param map The persistent_map_t object.
+ * @return Returns true if the persistent_map_t object is empty, otherwise returns false.
+ */
+bool persistent_map_is_empty(const persistent_map_t *map);
+
+/**
+ * @brief Get the size of a persistent_map_t object.
+ * @param map The persistent_map_t object.
+ * @return Returns the size of the persistent_map_t object.
+ */
+size_t persistent_map_size(const persistent_map_t *map);
+
+/**
+ * @brief Traverse a persistent_map_t object in ascending order of keys.
+ * @param map The persistent_map_t object.
+ * @param visit Callback function for visiting a key-value pair.
+ */
+void persistent_map_foreach(const persistent_map_t *map, visit_pair_t visit);
+
+/**
+ * @brief Check if a persistent_map_t object contains the specified key.
+ * @param map The persistent_map_t object.
+ * @param key The key.
+ * @return Returns true if the persistent_map_t object contains the specified key, otherwise returns false.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+bool persistent_map_contains(const persistent_map_t *map, T key);
+
+/**
+ * @brief Get the value of a key-value pair by given key.
+ * @param map The persistent_map_t object.
+ * @param key The key.
+ * @return Returns the value of the key-value pair if found, otherwise NULL.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+T persistent_map_get(const persistent_map_t *map, T key);
+
+/**
+ * @brief Create a new version of a persistent_map_t object with a key-value pair put into it.
+ *        Only the O(log n) nodes on the path to the key are copied, the original version is unchanged.
+ * @param map The persistent_map_t object.
+ * @param pair The pair_t object.
+ * @return Returns the new version if successful, otherwise returns NULL.
+ * @note The new version takes ownership of the parameter `pair`.
+ * @note Caller MUST destroy the returned persistent_map_t object.
+ */
+persistent_map_t *persistent_map_put(const persistent_map_t *map, pair_t *pair);
+
+/**
+ * @brief Create a new version of a persistent_map_t object with a key-value pair removed by given key.
+ *        Only the O(log n) nodes on the path to the key are copied, the original version is unchanged.
+ * @param map The persistent_map_t object.
+ * @param key The key.
+ * @return Returns the new version if successful, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ * @note Caller MUST destroy the returned persistent_map_t object.
+ */
+persistent_map_t *persistent_map_remove(const persistent_map_t *map, T key);
+
+/**
+ * @brief Create an iterator for a persistent_map_t object in ascending order of keys.
+ * @param map The persistent_map_t object.
+ * @return Returns the iterator for container.
+ */
+iterator_t *persistent_map_iterator_new(const persistent_map_t *map);
+
+/**
+ * @brief Destroy an iterator.
+ * @param iterator The iterator_t object.
+ */
+void persistent_map_iterator_delete(iterator_t *iterator);
+
+/**
+ * @brief Determine whether an iterator has the next element.
+ * @param iterator The iterator_t object.
+ * @return Returns true if the iterator has the next element, otherwise returns false.
+ */
+bool persistent_map_iterator_has_next(const iterator_t *iterator);
+
+/**
+ * @brief Get the next element of an iterator.
+ * @param iterator The iterator_t object.
+ * @return Returns the next element of the iterator.
+ */
+T persistent_map_iterator_next(iterator_t *iterator);
+
+#endif
@@ -0,0 +1,104 @@
+#ifndef _RADIX_HEAP_H_
+#define _RADIX_HEAP_H_
+
+#include "utils/exception.h"
+#include "utils/types.h"
+#include "utils/generic.h"
+
+/**
+ * @brief Radix heap for monotone unsigned integer keys.
+ *        Elements are bucketed by the highest bit in which their key differs from the last
+ *        popped key, so no compare_t is called and every element moves down at most once per
+ *        key bit, which makes push and pop O(1) amortized for a fixed key width.
+ *        Keys pushed MUST NOT be smaller than the last popped key.
+ */
+typedef struct radix_heap_t radix_heap_t;
+
+/**
+ * @brief Create a radix_heap_t object.
+ * @param destroy Callback function for destroying a data item.
+ * @return Returns the created radix_heap_t object if successful, otherwise returns NULL.
+ */
+radix_heap_t *radix_heap_new(destroy_t destroy);
+
+/**
+ * @brief Destroy a radix_heap_t object.
+ * @param heap The radix_heap_t object.
+ */
+void radix_heap_delete(radix_heap_t *heap);
+
+/**
+ * @brief Determine whether a radix_heap_t object is empty.
+ * @param heap The radix_heap_t object.
+ * @return Returns true if the radix_heap_t object is empty, otherwise returns false.
+ */
+bool radix_heap_is_empty(const radix_heap_t *heap);
+
+/**
+ * @brief Get the size of a radix_heap_t object.
+ * @param heap The radix_heap_t object.
+ * @return Returns the size of the radix_heap_t object.
+ */
+size_t radix_heap_size(const radix_heap_t *heap);
+
+/**
+ * @brief Clear a radix_heap_t object and reset its last popped key to 0.
+ * @param heap The radix_heap_t object.
+ * @return Returns the modified radix_heap_t object.
+ */
+radix_heap_t *radix_heap_clear(radix_heap_t *heap);
+
+/**
+ * @brief Get the last popped key of a radix_heap_t object, the smallest key that can still be pushed.
+ * @param heap The radix_heap_t object.
+ * @return Returns the last popped key, or 0 if nothing has been popped yet.
+ */
+unsigned long radix_heap_last_key(const radix_heap_t *heap);
+
+/**
+ * @brief Push an element with a key into a radix_heap_t object in O(1).
+ * @param heap The radix_heap_t object.
+ * @param key The key, which MUST NOT be smaller than the last popped key.
+ * @param elem The element, which may be NULL if only the keys matter (see radix_heap_pop_key()).
+ * @return Returns the modified radix_heap_t object, or NULL if the key is smaller than the last popped key.
+ * @note The element is not taken over if the key is rejected.
+ */
+radix_heap_t *radix_heap_push(radix_heap_t *heap, unsigned long key, T elem);
+
+/**
+ * @brief Pop an element with the smallest key from a radix_heap_t object in O(1) amortized.
+ * @param heap The radix_heap_t object.
+ * @return Returns the popped element, or NULL if the radix_heap_t object is empty or out of memory.
+ * @note Caller MUST free the returned element (if applicable).
+ *       Use radix_heap_pop_key() to tell a NULL element from a failed pop.
+ */
+T radix_heap_pop(radix_heap_t *heap);
+
+/**
+ * @brief Pop an element with the smallest key and the key itself from a radix_heap_t object in O(1) amortized.
+ * @param heap The radix_heap_t object.
+ * @param key Output parameter for the popped key, or NULL if not needed.
+ * @param elem Output parameter for the popped element, or NULL if not needed.
+ * @return Returns true if an element was popped, otherwise returns false if the radix_heap_t object is empty
+ *         or out of memory, in which case the outputs are left untouched.
+ * @note Caller MUST free the popped element (if applicable).
+ */
+bool radix_heap_pop_key(radix_heap_t *heap, unsigned long *key, T *elem);
+
+/**
+ * @brief Peek an element with the smallest key of a radix_heap_t object.
+ *        Unless it is the last popped key, the smallest key is found by scanning the lowest non-empty bucket.
+ * @param heap The radix_heap_t object.
+ * @return Returns the element.
+ */
+T radix_heap_peek(const radix_heap_t *heap);
+
+/**
+ * @brief Peek the smallest key of a radix_heap_t object.
+ *        Unless it is the last popped key, the smallest key is found by scanning the lowest non-empty bucket.
+ * @param heap The radix_heap_t object.
+ * @return Returns the smallest key, or the last popped key if the radix_heap_t object is empty.
+ */
+unsigned long radix_heap_peek_key(const radix_heap_t *heap);
+
+#endif
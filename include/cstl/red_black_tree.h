@@ -4,6 +4,7 @@
 #include "utils/exception.h"
 #include "utils/types.h"
 #include "utils/generic.h"
+#include "array.h"
 #include "iterator.h"
 
 typedef struct red_black_tree_t red_black_tree_t;
@@ -16,6 +17,47 @@ typedef struct red_black_tree_t red_black_tree_t;
  */
 red_black_tree_t *red_black_tree_new(compare_t compare, destroy_t destroy);
 
+/**
+ * @brief Create a red_black_tree_t object which orders data items by an extracted key.
+ * @param compare Callback function for comparing two keys.
+ * @param key_of Callback function for extracting the key from a data item, or NULL to compare data items directly.
+ * @param destroy Callback function for destroying a data item.
+ * @return Returns the red_black_tree_t object if create successfully, otherwise returns NULL.
+ * @note The comparator and key extractor are stored per tree, so trees with different orderings can coexist.
+ *       Lookup and removal functions take the raw key rather than a whole data item.
+ */
+red_black_tree_t *red_black_tree_new_with_key(compare_t compare, key_of_t key_of, destroy_t destroy);
+
+/**
+ * @brief Create a red_black_tree_t object from the data items of an array_t object in strictly ascending order.
+ *        The tree is linked level by level in O(n) without a single comparison-driven insert or rotation.
+ * @param compare Callback function for comparing two keys.
+ * @param key_of Callback function for extracting the key from a data item, or NULL to compare data items directly.
+ * @param destroy Callback function for destroying a data item.
+ * @param array The array_t object.
+ * @return Returns the red_black_tree_t object if create successfully, otherwise returns NULL,
+ *         including when the data items are not in strictly ascending order.
+ * @note The tree takes over the data items if successful. Caller MUST NOT destroy them through the array
+ *       afterwards (e.g. create the array with a NULL destroy callback).
+ */
+red_black_tree_t *red_black_tree_new_from_sorted(compare_t compare, key_of_t key_of, destroy_t destroy, const array_t *array);
+
+/**
+ * @brief Create a red_black_tree_t object from the data items of an array_t object in any order.
+ *        The data items are merge sorted by key in O(n log n) and the tree is then linked in O(n).
+ * @param compare Callback function for comparing two keys.
+ * @param key_of Callback function for extracting the key from a data item, or NULL to compare data items directly.
+ * @param destroy Callback function for destroying a data item.
+ * @param array The array_t object.
+ * @param replace Whether a later data item replaces an earlier one with an equal key, like red_black_tree_put.
+ *                Otherwise later data items are discarded, like red_black_tree_insert.
+ * @return Returns the red_black_tree_t object if create successfully, otherwise returns NULL.
+ * @note The tree takes over the data items if successful, and destroys the discarded ones (if applicable).
+ *       Caller MUST NOT destroy them through the array afterwards (e.g. create the array with a NULL destroy callback).
+ *       On failure no data item is destroyed and the caller keeps all of them.
+ */
+red_black_tree_t *red_black_tree_new_from_array(compare_t compare, key_of_t key_of, destroy_t destroy, const array_t *array, bool replace);
+
 /**
  * @brief Destroy a red_black_tree_t object.
  * @param tree The red_black_tree_t object.
@@ -61,12 +103,22 @@ void red_black_tree_foreach(red_black_tree_t *tree, visit_t visit);
 
 /**
  * @brief Inserts a key into the red-black tree.
+ *        If the tree already contains an equal key, the new key is destroyed (if applicable).
  * @param tree The red_black_tree_t object.
  * @param key The key.
  * @return Returns the modified red_black_tree_t object.
  */
 red_black_tree_t *red_black_tree_insert(red_black_tree_t *tree, T key);
 
+/**
+ * @brief Inserts a data item into the red-black tree, or replaces the data item with an equal key in place.
+ *        The replaced data item is destroyed (if applicable).
+ * @param tree The red_black_tree_t object.
+ * @param data The data item.
+ * @return Returns the modified red_black_tree_t object.
+ */
+red_black_tree_t *red_black_tree_put(red_black_tree_t *tree, T data);
+
 /**
  * @brief Removes a key from the red_black_tree_t object.
  * @param tree The red_black_tree_t object.
@@ -76,6 +128,92 @@ red_black_tree_t *red_black_tree_insert(red_black_tree_t *tree, T key);
  */
 red_black_tree_t *red_black_tree_remove(red_black_tree_t *tree, T key);
 
+/**
+ * @brief Find the key in the red_black_tree_t object which is equal to the given key.
+ * @param tree The red_black_tree_t object.
+ * @param key The key.
+ * @return Returns the key stored in the tree if found, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+T red_black_tree_find(const red_black_tree_t *tree, T key);
+
+/**
+ * @brief Find the greatest key in the red_black_tree_t object which is less than or equal to the given key.
+ * @param tree The red_black_tree_t object.
+ * @param key The key.
+ * @return Returns the key stored in the tree if found, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+T red_black_tree_floor(const red_black_tree_t *tree, T key);
+
+/**
+ * @brief Find the least key in the red_black_tree_t object which is greater than or equal to the given key.
+ * @param tree The red_black_tree_t object.
+ * @param key The key.
+ * @return Returns the key stored in the tree if found, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+T red_black_tree_ceiling(const red_black_tree_t *tree, T key);
+
+/**
+ * @brief Find the greatest key in the red_black_tree_t object which is strictly less than the given key.
+ * @param tree The red_black_tree_t object.
+ * @param key The key.
+ * @return Returns the key stored in the tree if found, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+T red_black_tree_lower(const red_black_tree_t *tree, T key);
+
+/**
+ * @brief Find the least key in the red_black_tree_t object which is strictly greater than the given key.
+ * @param tree The red_black_tree_t object.
+ * @param key The key.
+ * @return Returns the key stored in the tree if found, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+T red_black_tree_higher(const red_black_tree_t *tree, T key);
+
+/**
+ * @brief Get the minimum key in the red_black_tree_t object.
+ * @param tree The red_black_tree_t object.
+ * @return Returns the minimum key if the tree is not empty, otherwise returns NULL.
+ */
+T red_black_tree_min(const red_black_tree_t *tree);
+
+/**
+ * @brief Get the maximum key in the red_black_tree_t object.
+ * @param tree The red_black_tree_t object.
+ * @return Returns the maximum key if the tree is not empty, otherwise returns NULL.
+ */
+T red_black_tree_max(const red_black_tree_t *tree);
+
+/**
+ * @brief Get the key with the specified rank in the red_black_tree_t object.
+ * @param tree The red_black_tree_t object.
+ * @param index The 0-based rank, i.e. the number of smaller keys.
+ * @return Returns the key if the index is valid, otherwise returns NULL.
+ */
+T red_black_tree_select(const red_black_tree_t *tree, size_t index);
+
+/**
+ * @brief Count the keys in the red_black_tree_t object which are strictly less than the given key.
+ * @param tree The red_black_tree_t object.
+ * @param key The key, which does not need to be in the tree.
+ * @return Returns the rank of the key.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+size_t red_black_tree_rank(const red_black_tree_t *tree, T key);
+
+/**
+ * @brief Check the invariants of a red_black_tree_t object in O(n).
+ *        The keys are in strictly ascending order, the root is black, no red node has a red child,
+ *        every path from a node down to NIL has the same number of black nodes, the parent links
+ *        and the subtree sizes are consistent, and the size of the tree matches its nodes.
+ * @param tree The red_black_tree_t object.
+ * @return Returns true if every invariant holds, otherwise returns false.
+ */
+bool red_black_tree_is_valid(const red_black_tree_t *tree);
+
 /**
  * @brief Create an iterator for an red_black_tree_t object.
  * @param tree The red_black_tree_t object.
@@ -83,6 +221,24 @@ red_black_tree_t *red_black_tree_remove(red_black_tree_t *tree, T key);
  */
 iterator_t *red_black_tree_iterator_new(const red_black_tree_t *tree);
 
+/**
+ * @brief Create an iterator over the keys in [lo, hi) of an red_black_tree_t object in ascending order.
+ *        Seeking to the first key and locating the stop node both take O(log n).
+ * @param tree The red_black_tree_t object.
+ * @param lo The inclusive lower bound, or NULL for no lower bound.
+ * @param hi The exclusive upper bound, or NULL for no upper bound.
+ * @return Returns the iterator for container.
+ * @note Caller MUST free the parameters `lo` and `hi` (if applicable).
+ */
+iterator_t *red_black_tree_iterator_range(const red_black_tree_t *tree, T lo, T hi);
+
+/**
+ * @brief Create an iterator for an red_black_tree_t object in descending order.
+ * @param tree The red_black_tree_t object.
+ * @return Returns the iterator for container.
+ */
+iterator_t *red_black_tree_iterator_reverse(const red_black_tree_t *tree);
+
 /**
  * @brief Destroy an iterator.
  * @param iterator The iterator_t object.
@@ -12,6 +12,7 @@ typedef struct string_t string_t;
  * @brief Create a string_t object.
  * @param str The primitive string.
  * @return Returns a string_t pointer if the memory allocation succeeds, otherwise returns NULL.
+ * @note Strings shorter than 24 characters are stored inside the object and take a single allocation.
  */
 string_t *string_new(const char *str);
 
@@ -42,6 +43,29 @@ size_t string_length(const string_t *string);
  */
 bool string_is_empty(const string_t *string);
 
+/**
+ * @brief Returns the number of characters the string_t object can hold without reallocation.
+ * @param string The string_t object.
+ * @return Returns the capacity of the string_t object.
+ */
+size_t string_capacity(const string_t *string);
+
+/**
+ * @brief Reserve room for at least `n` characters in the string_t object.
+ *        Growing the string up to `n` characters afterwards does not reallocate.
+ * @param string The string_t object.
+ * @param n The number of characters.
+ * @return Returns the modified string_t object.
+ */
+string_t *string_reserve(string_t *string, size_t n);
+
+/**
+ * @brief Release the unused capacity of the string_t object.
+ * @param string The string_t object.
+ * @return Returns the modified string_t object.
+ */
+string_t *string_shrink_to_fit(string_t *string);
+
 /**
  * @brief Get the primitive string.
  * @param string The string_t object.
@@ -217,6 +241,16 @@ string_t *string_insert_char(string_t *string, size_t index, char c);
  */
 string_t *string_concat(string_t *string, const char *str);
 
+/**
+ * @brief Append at most `n` characters of the specified string to the end of the string_t object.
+ *        The appended characters stop at the terminator of `str` if it comes first.
+ * @param string The string_t object.
+ * @param str The appended string.
+ * @param n The maximum number of appended characters.
+ * @return Returns the modified string_t object.
+ */
+string_t *string_append_n(string_t *string, const char *str, size_t n);
+
 /**
  * @brief Insert the specified substring to the specified index of the string_t object.
  * @param string The string_t object.
@@ -0,0 +1,95 @@
+#ifndef _STRING_POOL_H_
+#define _STRING_POOL_H_
+
+#include "utils/exception.h"
+#include "utils/types.h"
+#include "utils/generic.h"
+
+/**
+ * @brief String interning pool.
+ *        Every distinct string is copied once into an arena owned by the pool, together with its
+ *        length and hash. Interning equal strings returns the same canonical pointer, so interned
+ *        strings compare by address and hash without reading their characters.
+ */
+typedef struct string_pool_t string_pool_t;
+
+/**
+ * @brief Create a string_pool_t object.
+ * @return Returns the created string_pool_t object if successful, otherwise returns NULL.
+ */
+string_pool_t *string_pool_new(void);
+
+/**
+ * @brief Destroy a string_pool_t object.
+ * @param pool The string_pool_t object.
+ * @note All interned strings of the pool become invalid.
+ */
+void string_pool_delete(string_pool_t *pool);
+
+/**
+ * @brief Determine whether a string_pool_t object is empty.
+ * @param pool The string_pool_t object.
+ * @return Returns true if the string_pool_t object is empty, otherwise returns false.
+ */
+bool string_pool_is_empty(const string_pool_t *pool);
+
+/**
+ * @brief Get the number of distinct strings in a string_pool_t object.
+ * @param pool The string_pool_t object.
+ * @return Returns the number of distinct strings.
+ */
+size_t string_pool_size(const string_pool_t *pool);
+
+/**
+ * @brief Clear a string_pool_t object and release its arena.
+ * @param pool The string_pool_t object.
+ * @return Returns the modified string_pool_t object.
+ * @note All interned strings of the pool become invalid.
+ */
+string_pool_t *string_pool_clear(string_pool_t *pool);
+
+/**
+ * @brief Intern a string into a string_pool_t object.
+ * @param pool The string_pool_t object.
+ * @param str The string.
+ * @return Returns the canonical copy of the string, which stays valid until the pool is cleared or destroyed,
+ *         or NULL if the memory allocation fails.
+ * @note Caller MUST NOT modify or free the returned string.
+ */
+const char *string_pool_intern(string_pool_t *pool, const char *str);
+
+/**
+ * @brief Look up the canonical copy of a string in a string_pool_t object without interning it.
+ * @param pool The string_pool_t object.
+ * @param str The string.
+ * @return Returns the canonical copy of the string if it was interned, otherwise returns NULL.
+ */
+const char *string_pool_lookup(const string_pool_t *pool, const char *str);
+
+/**
+ * @brief Get the length of an interned string in O(1).
+ * @param str The interned string.
+ * @return Returns the length of the string.
+ */
+size_t string_pool_length(const char *str);
+
+/**
+ * @brief Get the precomputed hash of an interned string in O(1).
+ *        The value equals str_hash() of the same characters.
+ * @param str The interned string.
+ * @return Returns the hash of the string.
+ * @note Compatible with hash_t, for use as the hash callback of hash_map_t and hash_set_t.
+ */
+size_t string_pool_hash(const T str);
+
+/**
+ * @brief Compare two interned strings of the same pool by address in O(1).
+ *        Equal strings compare equal, the order of different strings is arbitrary but consistent.
+ * @param str1 The first interned string.
+ * @param str2 The second interned string.
+ * @return Returns 0 if the strings are equal, otherwise returns a negative or positive integer.
+ * @note Compatible with compare_t, for use as the compare callback of CSTL containers.
+ */
+int string_pool_compare(const T str1, const T str2);
+
+#endif
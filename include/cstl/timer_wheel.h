@@ -0,0 +1,113 @@
+#ifndef _TIMER_WHEEL_H_
+#define _TIMER_WHEEL_H_
+
+#include "utils/exception.h"
+#include "utils/types.h"
+#include "utils/generic.h"
+
+/**
+ * @brief Hierarchical timing wheel.
+ *        Four wheels of 256 slots each cover 2^8, 2^16, 2^24 and 2^32 ticks ahead. A timer is
+ *        linked into the slot of its expiry in O(1) and moved down one wheel whenever the wheel
+ *        below wraps around, so arming and cancelling never search or reorder other timers.
+ */
+typedef struct timer_wheel_t timer_wheel_t;
+
+typedef struct timer_wheel_timer_t timer_wheel_timer_t;
+
+/**
+ * @brief Create a timer_wheel_t object.
+ * @param now The current time in ticks.
+ * @param destroy Callback function for destroying a data item.
+ * @return Returns the created timer_wheel_t object if successful, otherwise returns NULL.
+ */
+timer_wheel_t *timer_wheel_new(unsigned long now, destroy_t destroy);
+
+/**
+ * @brief Destroy a timer_wheel_t object.
+ * @param wheel The timer_wheel_t object.
+ */
+void timer_wheel_delete(timer_wheel_t *wheel);
+
+/**
+ * @brief Determine whether a timer_wheel_t object has no armed timers.
+ * @param wheel The timer_wheel_t object.
+ * @return Returns true if the timer_wheel_t object is empty, otherwise returns false.
+ */
+bool timer_wheel_is_empty(const timer_wheel_t *wheel);
+
+/**
+ * @brief Get the number of armed timers of a timer_wheel_t object.
+ * @param wheel The timer_wheel_t object.
+ * @return Returns the number of armed timers.
+ */
+size_t timer_wheel_size(const timer_wheel_t *wheel);
+
+/**
+ * @brief Cancel all timers of a timer_wheel_t object without firing them.
+ * @param wheel The timer_wheel_t object.
+ * @return Returns the modified timer_wheel_t object.
+ */
+timer_wheel_t *timer_wheel_clear(timer_wheel_t *wheel);
+
+/**
+ * @brief Get the current time of a timer_wheel_t object.
+ * @param wheel The timer_wheel_t object.
+ * @return Returns the time passed to the last advance, or to the constructor.
+ */
+unsigned long timer_wheel_now(const timer_wheel_t *wheel);
+
+/**
+ * @brief Arm a timer in a timer_wheel_t object in O(1).
+ * @param wheel The timer_wheel_t object.
+ * @param expiry The time at which the timer fires. A time not after the current time fires on the next advance past it.
+ * @param elem The element.
+ * @return Returns the timer, which stays valid until it fires or is cancelled, or NULL if it cannot be armed.
+ */
+timer_wheel_timer_t *timer_wheel_arm(timer_wheel_t *wheel, unsigned long expiry, T elem);
+
+/**
+ * @brief Move an armed timer of a timer_wheel_t object to a new expiry in O(1).
+ * @param wheel The timer_wheel_t object.
+ * @param timer The armed timer.
+ * @param expiry The new time at which the timer fires.
+ * @return Returns the modified timer_wheel_t object.
+ */
+timer_wheel_t *timer_wheel_rearm(timer_wheel_t *wheel, timer_wheel_timer_t *timer, unsigned long expiry);
+
+/**
+ * @brief Cancel an armed timer of a timer_wheel_t object in O(1).
+ * @param wheel The timer_wheel_t object.
+ * @param timer The armed timer.
+ * @return Returns the element of the cancelled timer.
+ * @note Caller MUST free the returned element (if applicable).
+ */
+T timer_wheel_cancel(timer_wheel_t *wheel, timer_wheel_timer_t *timer);
+
+/**
+ * @brief Advance the time of a timer_wheel_t object and fire every timer that expired, slot by slot.
+ *        Timers fire tick by tick in order of expiry, those armed for a past time with the first tick.
+ *        The callback may arm, rearm and cancel other timers.
+ * @param wheel The timer_wheel_t object.
+ * @param now The new current time, earlier times are ignored.
+ * @param fire Callback function for the element of each fired timer.
+ * @return Returns the number of fired timers.
+ * @note The callback takes over the fired elements.
+ */
+size_t timer_wheel_advance(timer_wheel_t *wheel, unsigned long now, visit_t fire);
+
+/**
+ * @brief Get the element of an armed timer.
+ * @param timer The timer_wheel_timer_t object.
+ * @return Returns the element.
+ */
+T timer_wheel_timer_get(const timer_wheel_timer_t *timer);
+
+/**
+ * @brief Get the expiry of an armed timer.
+ * @param timer The timer_wheel_timer_t object.
+ * @return Returns the time at which the timer fires.
+ */
+unsigned long timer_wheel_timer_expiry(const timer_wheel_timer_t *timer);
+
+#endif
@@ -4,6 +4,7 @@
 #include "utils/exception.h"
 #include "utils/types.h"
 #include "utils/generic.h"
+#include "cstl/array.h"
 #include "cstl/pair.h"
 #include "iterator.h"
 
@@ -16,6 +17,28 @@ typedef struct tree_map_t tree_map_t;
  */
 tree_map_t *tree_map_new(compare_t compare);
 
+/**
+ * @brief Create a tree_map_t object from the pairs of an array_t object with keys in strictly ascending order in O(n).
+ * @param compare Callback function for comparing two keys.
+ * @param array The array_t object of pair_t objects.
+ * @return Returns the created tree_map_t object if successful, otherwise returns NULL,
+ *         including when the keys are not in strictly ascending order.
+ * @note The map takes over the pairs if successful. Caller MUST NOT destroy them through the array
+ *       afterwards (e.g. create the array with a NULL destroy callback).
+ */
+tree_map_t *tree_map_from_sorted(compare_t compare, const array_t *array);
+
+/**
+ * @brief Create a tree_map_t object from the pairs of an array_t object in any order in O(n log n).
+ *        Of several pairs with equal keys the last one is kept and the others are destroyed, like tree_map_put.
+ * @param compare Callback function for comparing two keys.
+ * @param array The array_t object of pair_t objects.
+ * @return Returns the created tree_map_t object if successful, otherwise returns NULL.
+ * @note The map takes over the pairs if successful. Caller MUST NOT destroy them through the array
+ *       afterwards (e.g. create the array with a NULL destroy callback).
+ */
+tree_map_t *tree_map_from_array(compare_t compare, const array_t *array);
+
 /**
  * @brief Destroy a tree_map_t object.
  * @param map The tree_map_t object.
@@ -85,6 +108,76 @@ tree_map_t *tree_map_remove(tree_map_t *map, T key);
  */
 T tree_map_get(const tree_map_t *map, T key);
 
+/**
+ * @brief Get the key-value pair with the greatest key less than or equal to the given key.
+ * @param map The tree_map_t object.
+ * @param key The key.
+ * @return Returns the pair_t object if found, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable). The returned pair is owned by the map.
+ */
+pair_t *tree_map_floor(const tree_map_t *map, T key);
+
+/**
+ * @brief Get the key-value pair with the least key greater than or equal to the given key.
+ * @param map The tree_map_t object.
+ * @param key The key.
+ * @return Returns the pair_t object if found, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable). The returned pair is owned by the map.
+ */
+pair_t *tree_map_ceiling(const tree_map_t *map, T key);
+
+/**
+ * @brief Get the key-value pair with the greatest key strictly less than the given key.
+ * @param map The tree_map_t object.
+ * @param key The key.
+ * @return Returns the pair_t object if found, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable). The returned pair is owned by the map.
+ */
+pair_t *tree_map_lower(const tree_map_t *map, T key);
+
+/**
+ * @brief Get the key-value pair with the least key strictly greater than the given key.
+ * @param map The tree_map_t object.
+ * @param key The key.
+ * @return Returns the pair_t object if found, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable). The returned pair is owned by the map.
+ */
+pair_t *tree_map_higher(const tree_map_t *map, T key);
+
+/**
+ * @brief Get the key-value pair with the least key.
+ * @param map The tree_map_t object.
+ * @return Returns the pair_t object if the map is not empty, otherwise returns NULL.
+ * @note The returned pair is owned by the map.
+ */
+pair_t *tree_map_first(const tree_map_t *map);
+
+/**
+ * @brief Get the key-value pair with the greatest key.
+ * @param map The tree_map_t object.
+ * @return Returns the pair_t object if the map is not empty, otherwise returns NULL.
+ * @note The returned pair is owned by the map.
+ */
+pair_t *tree_map_last(const tree_map_t *map);
+
+/**
+ * @brief Get the key-value pair whose key has the specified rank in O(log n).
+ * @param map The tree_map_t object.
+ * @param index The 0-based rank, i.e. the number of smaller keys.
+ * @return Returns the pair_t object if the index is valid, otherwise returns NULL.
+ * @note The returned pair is owned by the map.
+ */
+pair_t *tree_map_select(const tree_map_t *map, size_t index);
+
+/**
+ * @brief Count the keys in the tree_map_t object which are less than the given key in O(log n).
+ * @param map The tree_map_t object.
+ * @param key The key, which does not need to be in the map.
+ * @return Returns the rank of the key.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+size_t tree_map_rank(const tree_map_t *map, T key);
+
 /**
  * @brief Create an iterator for an tree_map_t object.
  * @param map The tree_map_t object.
@@ -92,6 +185,23 @@ T tree_map_get(const tree_map_t *map, T key);
  */
 iterator_t *tree_map_iterator_new(const tree_map_t *map);
 
+/**
+ * @brief Create an iterator over the pairs whose keys are in [lo, hi) of a tree_map_t object in ascending order.
+ * @param map The tree_map_t object.
+ * @param lo The inclusive lower bound, or NULL for no lower bound.
+ * @param hi The exclusive upper bound, or NULL for no upper bound.
+ * @return Returns the iterator for container.
+ * @note Caller MUST free the parameters `lo` and `hi` (if applicable).
+ */
+iterator_t *tree_map_iterator_range(const tree_map_t *map, T lo, T hi);
+
+/**
+ * @brief Create an iterator for a tree_map_t object in descending order of keys.
+ * @param map The tree_map_t object.
+ * @return Returns the iterator for container.
+ */
+iterator_t *tree_map_iterator_reverse(const tree_map_t *map);
+
 /**
  * @brief Destroy an iterator.
  * @param iterator The iterator_t object.
@@ -4,6 +4,7 @@
 #include "utils/exception.h"
 #include "utils/types.h"
 #include "utils/generic.h"
+#include "array.h"
 #include "iterator.h"
 
 typedef struct tree_set_t tree_set_t;
@@ -16,6 +17,30 @@ typedef struct tree_set_t tree_set_t;
  */
 tree_set_t *tree_set_new(compare_t compare, destroy_t destroy);
 
+/**
+ * @brief Create a tree_set_t object from the elements of an array_t object in strictly ascending order in O(n).
+ * @param compare Callback function for comparing two data items.
+ * @param destroy Callback function for destroying a data item.
+ * @param array The array_t object.
+ * @return Returns the created tree_set_t object if successful, otherwise returns NULL,
+ *         including when the elements are not in strictly ascending order.
+ * @note The set takes over the elements if successful. Caller MUST NOT destroy them through the array
+ *       afterwards (e.g. create the array with a NULL destroy callback).
+ */
+tree_set_t *tree_set_from_sorted(compare_t compare, destroy_t destroy, const array_t *array);
+
+/**
+ * @brief Create a tree_set_t object from the elements of an array_t object in any order in O(n log n).
+ *        Of several equal elements the first one is kept and the others are destroyed (if applicable), like tree_set_add.
+ * @param compare Callback function for comparing two data items.
+ * @param destroy Callback function for destroying a data item.
+ * @param array The array_t object.
+ * @return Returns the created tree_set_t object if successful, otherwise returns NULL.
+ * @note The set takes over the elements if successful. Caller MUST NOT destroy them through the array
+ *       afterwards (e.g. create the array with a NULL destroy callback).
+ */
+tree_set_t *tree_set_from_array(compare_t compare, destroy_t destroy, const array_t *array);
+
 /**
  * @brief Destroy a tree_set_t object.
  * @param set The tree_set_t object.
@@ -76,6 +101,23 @@ tree_set_t *tree_set_add(tree_set_t *set, T elem);
  */
 tree_set_t *tree_set_remove(tree_set_t *set, T elem);
 
+/**
+ * @brief Get the element with the specified rank in the tree_set_t object in O(log n).
+ * @param set The tree_set_t object.
+ * @param index The 0-based rank, i.e. the number of smaller elements.
+ * @return Returns the element if the index is valid, otherwise returns NULL.
+ */
+T tree_set_select(const tree_set_t *set, size_t index);
+
+/**
+ * @brief Count the elements in the tree_set_t object which are less than the given element in O(log n).
+ * @param set The tree_set_t object.
+ * @param elem The element, which does not need to be in the set.
+ * @return Returns the rank of the element.
+ * @note Caller MUST free the parameter `elem` (if applicable).
+ */
+size_t tree_set_rank(const tree_set_t *set, T elem);
+
 /**
  * @brief Get the union of two tree_set_t objects.
  * @param set1 The first tree_set_t object.
@@ -119,7 +161,8 @@ tree_set_t *tree_set_symmetric_difference(const tree_set_t *set1, const tree_set
  *        Two sets are disjoint if their intersection is empty.
  * @param set1 The first tree_set_t object.
  * @param set2 The second tree_set_t object.
- * @return Returns true if two tree_set_t objects are disjoint, otherwise returns false.
+ * @return Returns true if two tree_set_t objects are disjoint, otherwise returns false,
+ *         including when the iterators cannot be allocated.
  */
 bool tree_set_is_disjoint(const tree_set_t *set1, const tree_set_t *set2);
 
@@ -128,7 +171,8 @@ bool tree_set_is_disjoint(const tree_set_t *set1, const tree_set_t *set2);
  *        A is a subset B if every element of A is also an element of B.
  * @param set1 The first tree_set_t object.
  * @param set2 The second tree_set_t object.
- * @return Returns true if set1 is a subset of set2, otherwise returns false.
+ * @return Returns true if set1 is a subset of set2, otherwise returns false,
+ *         including when the iterators cannot be allocated.
  */
 bool tree_set_is_subset(const tree_set_t *set1, const tree_set_t *set2);
 
@@ -139,6 +183,23 @@ bool tree_set_is_subset(const tree_set_t *set1, const tree_set_t *set2);
  */
 iterator_t *tree_set_iterator_new(const tree_set_t *set);
 
+/**
+ * @brief Create an iterator over the elements in [lo, hi) of a tree_set_t object in ascending order.
+ * @param set The tree_set_t object.
+ * @param lo The inclusive lower bound, or NULL for no lower bound.
+ * @param hi The exclusive upper bound, or NULL for no upper bound.
+ * @return Returns the iterator for container.
+ * @note Caller MUST free the parameters `lo` and `hi` (if applicable).
+ */
+iterator_t *tree_set_iterator_range(const tree_set_t *set, T lo, T hi);
+
+/**
+ * @brief Create an iterator for a tree_set_t object in descending order.
+ * @param set The tree_set_t object.
+ * @return Returns the iterator for container.
+ */
+iterator_t *tree_set_iterator_reverse(const tree_set_t *set);
+
 /**
  * @brief Destroy an iterator.
  * @param iterator The iterator_t object.
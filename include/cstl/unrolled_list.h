@@ -0,0 +1,198 @@
+#ifndef _UNROLLED_LIST_H_
+#define _UNROLLED_LIST_H_
+
+#include "utils/exception.h"
+#include "utils/types.h"
+#include "utils/generic.h"
+#include "utils/pool.h"
+#include "iterator.h"
+
+/**
+ * @brief Unrolled doubly linked list.
+ *        Each node stores a small array of elements, so sequential traversal
+ *        follows far fewer pointers than `list_t` while both ends stay O(1).
+ */
+typedef struct unrolled_list_t unrolled_list_t;
+
+/**
+ * @brief Create an unrolled_list_t object.
+ * @param compare Callback function for comparing two data items.
+ * @param destroy Callback function for destroying a data item.
+ * @return Returns the created unrolled_list_t object if successful, otherwise returns NULL.
+ */
+unrolled_list_t *unrolled_list_new(compare_t compare, destroy_t destroy);
+
+/**
+ * @brief Destroy an unrolled_list_t object.
+ * @param list The unrolled_list_t object.
+ */
+void unrolled_list_delete(unrolled_list_t *list);
+
+/**
+ * @brief Determine whether the unrolled_list_t object is empty.
+ * @param list The unrolled_list_t object.
+ * @return Returns true if the unrolled_list_t object is empty, otherwise returns false.
+ */
+bool unrolled_list_is_empty(const unrolled_list_t *list);
+
+/**
+ * @brief Get the size of the unrolled_list_t object.
+ * @param list The unrolled_list_t object.
+ * @return Returns the size of the unrolled_list_t object.
+ */
+size_t unrolled_list_size(const unrolled_list_t *list);
+
+/**
+ * @brief Traverse the unrolled_list_t object.
+ * @param list The unrolled_list_t object.
+ * @param visit Callback function for visiting a data item.
+ */
+void unrolled_list_foreach(unrolled_list_t *list, visit_t visit);
+
+/**
+ * @brief Clear the unrolled_list_t object.
+ * @param list The unrolled_list_t object.
+ * @return Returns the modified unrolled_list_t object.
+ */
+unrolled_list_t *unrolled_list_clear(unrolled_list_t *list);
+
+/**
+ * @brief Get the element at the specified position in the unrolled_list_t object.
+ * @param list The unrolled_list_t object.
+ * @param index The index.
+ * @return Returns the element at the specified position if successful, otherwise returns NULL.
+ */
+T unrolled_list_get(const unrolled_list_t *list, size_t index);
+
+/**
+ * @brief Set the element at the specified position in the unrolled_list_t object.
+ * @param list The unrolled_list_t object.
+ * @param index The index.
+ * @param elem The element.
+ * @return Returns the modified unrolled_list_t object.
+ */
+unrolled_list_t *unrolled_list_set(unrolled_list_t *list, size_t index, T elem);
+
+/**
+ * @brief Get the index of the specified element in the unrolled_list_t object.
+ * @param list The unrolled_list_t object.
+ * @param elem The element.
+ * @return Returns the index of the specified element if found, otherwise returns -1.
+ */
+int unrolled_list_index_of(const unrolled_list_t *list, T elem);
+
+/**
+ * @brief Determine whether the unrolled_list_t object contains the specified element.
+ * @param list The unrolled_list_t object.
+ * @param elem The element.
+ * @return Returns true if the unrolled_list_t object contains the specified element, otherwise returns false.
+ */
+bool unrolled_list_contains(const unrolled_list_t *list, T elem);
+
+/**
+ * @brief Count the number of occurrences of the specified element in the unrolled_list_t object.
+ * @param list The unrolled_list_t object.
+ * @param elem The element.
+ * @return Returns the number of occurrences of the specified element.
+ */
+size_t unrolled_list_count(const unrolled_list_t *list, T elem);
+
+/**
+ * @brief Get the first element of the unrolled_list_t object.
+ * @param list The unrolled_list_t object.
+ * @return Returns the first element if successful, otherwise returns NULL.
+ */
+T unrolled_list_get_front(const unrolled_list_t *list);
+
+/**
+ * @brief Get the last element of the unrolled_list_t object.
+ * @param list The unrolled_list_t object.
+ * @return Returns the last element if successful, otherwise returns NULL.
+ */
+T unrolled_list_get_back(const unrolled_list_t *list);
+
+/**
+ * @brief Insert the specified element at the beginning of the unrolled_list_t object.
+ * @param list The unrolled_list_t object.
+ * @param elem The element.
+ * @return Returns the modified unrolled_list_t object.
+ */
+unrolled_list_t *unrolled_list_push_front(unrolled_list_t *list, T elem);
+
+/**
+ * @brief Insert the specified element at the end of the unrolled_list_t object.
+ * @param list The unrolled_list_t object.
+ * @param elem The element.
+ * @return Returns the modified unrolled_list_t object.
+ */
+unrolled_list_t *unrolled_list_push_back(unrolled_list_t *list, T elem);
+
+/**
+ * @brief Remove the first element of the unrolled_list_t object.
+ * @param list The unrolled_list_t object.
+ * @return Returns the removed element if successful, otherwise returns NULL.
+ * @note Caller MUST free the returned element (if applicable).
+ */
+T unrolled_list_pop_front(unrolled_list_t *list);
+
+/**
+ * @brief Remove the last element of the unrolled_list_t object.
+ * @param list The unrolled_list_t object.
+ * @return Returns the removed element if successful, otherwise returns NULL.
+ * @note Caller MUST free the returned element (if applicable).
+ */
+T unrolled_list_pop_back(unrolled_list_t *list);
+
+/**
+ * @brief Insert the specified element at the specified position in the unrolled_list_t object.
+ * @param list The unrolled_list_t object.
+ * @param index The index.
+ * @param elem The element.
+ * @return Returns the modified unrolled_list_t object.
+ */
+unrolled_list_t *unrolled_list_insert(unrolled_list_t *list, size_t index, T elem);
+
+/**
+ * @brief Removes the element at the specified position in the unrolled_list_t object.
+ * @param list The unrolled_list_t object.
+ * @param index The index.
+ * @return Returns the removed element if successful, otherwise returns NULL.
+ * @note Caller MUST free the returned element (if applicable).
+ */
+T unrolled_list_remove(unrolled_list_t *list, size_t index);
+
+/**
+ * @brief Reverse the unrolled_list_t object.
+ * @param list The unrolled_list_t object.
+ * @return Returns the modified unrolled_list_t object.
+ */
+unrolled_list_t *unrolled_list_reverse(unrolled_list_t *list);
+
+/**
+ * @brief Create an iterator for an unrolled_list_t object.
+ * @param list The unrolled_list_t object.
+ * @return Returns the iterator for container.
+ */
+iterator_t *unrolled_list_iterator_new(const unrolled_list_t *list);
+
+/**
+ * @brief Destroy an iterator.
+ * @param iterator The iterator_t object.
+ */
+void unrolled_list_iterator_delete(iterator_t *iterator);
+
+/**
+ * @brief Determine whether an iterator has the next element.
+ * @param iterator The iterator_t object.
+ * @return Returns true if the iterator has the next element, otherwise returns false.
+ */
+bool unrolled_list_iterator_has_next(const iterator_t *iterator);
+
+/**
+ * @brief Get the next element of an iterator.
+ * @param iterator The iterator_t object.
+ * @return Returns the next element of the iterator.
+ */
+T unrolled_list_iterator_next(iterator_t *iterator);
+
+#endif
@@ -21,6 +21,13 @@ typedef int (*compare_t)(const T data1, const T data2);
  */
 typedef void (*destroy_t)(T data);
 
+/**
+ * @brief A generic function pointer type for extracting the ordering key from a data item.
+ * @param data The data item.
+ * @return Returns the key of the data item.
+ */
+typedef T (*key_of_t)(const T data);
+
 /**
  * @brief A generic function pointer type for visiting a data item.
  * @param data The data item to be visited.
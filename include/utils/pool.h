@@ -0,0 +1,66 @@
+#ifndef _POOL_H_
+#define _POOL_H_
+
+#include "types.h"
+#include <stddef.h>
+
+/**
+ * @brief A slab allocator for fixed-size blocks.
+ *        Blocks are carved out of large slabs and recycled through a free list,
+ *        so frequent allocations of the same size do not hit the system allocator.
+ */
+typedef struct pool_t pool_t;
+
+/**
+ * @brief Create a pool_t object.
+ * @param block_size The size of each block in bytes.
+ * @return Returns the created pool_t object if successful, otherwise returns NULL.
+ */
+pool_t *pool_new(size_t block_size);
+
+/**
+ * @brief Destroy a pool_t object and release all of its slabs.
+ * @param pool The pool_t object.
+ * @note All blocks allocated from the pool become invalid.
+ */
+void pool_delete(pool_t *pool);
+
+/**
+ * @brief Get the size of each block of a pool_t object.
+ * @param pool The pool_t object.
+ * @return Returns the block size in bytes.
+ */
+size_t pool_block_size(const pool_t *pool);
+
+/**
+ * @brief Allocate a block from a pool_t object.
+ * @param pool The pool_t object.
+ * @return Returns the allocated block if successful, otherwise returns NULL.
+ */
+void *pool_alloc(pool_t *pool);
+
+/**
+ * @brief Return a block to a pool_t object.
+ * @param pool The pool_t object.
+ * @param block The block previously allocated from the same pool.
+ */
+void pool_free(pool_t *pool, void *block);
+
+/**
+ * @brief Release all slabs of a pool_t object at once.
+ * @param pool The pool_t object.
+ * @return Returns the modified pool_t object.
+ * @note All blocks allocated from the pool become invalid.
+ */
+pool_t *pool_clear(pool_t *pool);
+
+/**
+ * @brief Move all slabs and free blocks of `other` into `pool`.
+ *        Blocks allocated from `other` stay valid and are owned by `pool` afterwards.
+ * @param pool The pool_t object.
+ * @param other The pool_t object to be drained. It MUST have the same block size.
+ * @return Returns the modified pool_t object.
+ */
+pool_t *pool_merge(pool_t *pool, pool_t *other);
+
+#endif
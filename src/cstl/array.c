@@ -1,4 +1,5 @@
 #include "cstl/array.h"
+#include <string.h>
 
 #define DEFAULT_CAPACITY 16
 #define SHRINK_FACTOR 2
@@ -295,32 +296,95 @@ array_t *array_reverse(array_t *array) {
     return array;
 }
 
-static compare_t __compare = NULL;
+/**
+ * @brief Merge two adjacent sorted runs `src[left, mid)` and `src[mid, right)` into `dst[left, right)`.
+ * @param compare Callback function for comparing two data items.
+ * @param src The source buffer.
+ * @param dst The destination buffer.
+ * @param left The beginning of the first run.
+ * @param mid The beginning of the second run.
+ * @param right The end of the second run.
+ */
+static void __merge(compare_t compare, T *src, T *dst, size_t left, size_t mid, size_t right) {
+    size_t i = left;
+    size_t j = mid;
+    size_t k = left;
+
+    while (i < mid && j < right) {
+        /* Take from the first run on ties to keep the sort stable */
+        if (compare(src[j], src[i]) < 0) {
+            dst[k++] = src[j++];
+        } else {
+            dst[k++] = src[i++];
+        }
+    }
+    while (i < mid) {
+        dst[k++] = src[i++];
+    }
+    while (j < right) {
+        dst[k++] = src[j++];
+    }
+}
 
 /**
- * @brief Private function for comparing elements.
- * @param a The first element.
- * @param b The second element.
- * @return Returns negative value if the first element is less than the second element.
- *         Returns 0 if the first element is equal to the second element.
- *         Returns positive value if the first element is greater than the second element.
+ * @brief Sort `data[0, n)` in place with a stable insertion sort.
+ *        Used when there is no memory for the merge buffer.
+ * @param compare Callback function for comparing two data items.
+ * @param data The data to sort.
+ * @param n The number of data items.
  */
-static int __T_compare(const T a, const T b) {
-    exit_if_fail(a != NULL && b != NULL && __compare != NULL);
-    return __compare(*(const T *)a, *(const T *)b);
+static void __insertion_sort(compare_t compare, T *data, size_t n) {
+    size_t i = 0;
+    size_t j = 0;
+    T elem = NULL;
+
+    for (i = 1; i < n; i++) {
+        elem = data[i];
+        for (j = i; j > 0 && compare(elem, data[j - 1]) < 0; j--) {
+            data[j] = data[j - 1];
+        }
+        data[j] = elem;
+    }
 }
 
 /**
  * @brief Sort an array_t object in ascending order.
+ *        The sort is a stable bottom-up merge sort using the comparator of the array itself.
+ *        If the merge buffer cannot be allocated, it falls back to an in-place insertion sort.
  * @param array The array_t object.
  * @return Returns the modified array_t object.
  */
 array_t *array_sort(array_t *array) {
+    T *buffer = NULL;
+    T *src = NULL;
+    T *dst = NULL;
+    size_t width = 0;
+    size_t left = 0;
+
     return_value_if_fail(array != NULL, array);
     return_value_if_fail(array->compare != NULL, array);
+    return_value_if(array->size < 2, array);
+
+    buffer = (T *)malloc(sizeof(T) * array->size);
+    if (buffer == NULL) {
+        __insertion_sort(array->compare, array->data, array->size);
+        return array;
+    }
+
+    src = array->data;
+    dst = buffer;
+    for (width = 1; width < array->size; width *= 2) {
+        for (left = 0; left < array->size; left += 2 * width) {
+            __merge(array->compare, src, dst, left, min(left + width, array->size), min(left + 2 * width, array->size));
+        }
+        swap(src, dst, T *);
+    }
+
+    if (src != array->data) {
+        memcpy(array->data, src, sizeof(T) * array->size);
+    }
 
-    __compare = array->compare;
-    qsort(array->data, array->size, sizeof(T), __T_compare);
+    free(buffer);
     return array;
 }
 
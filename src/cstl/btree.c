@@ -0,0 +1,1186 @@
+#include <stddef.h>
+#include <string.h>
+#include "cstl/btree.h"
+#include "utils/numeric.h"
+#include "utils/pool.h"
+
+/* Minimum degree: every node except the root holds MIN_DEGREE - 1 to 2 * MIN_DEGREE - 1 keys */
+#define MIN_DEGREE 16
+#define MIN_KEYS (MIN_DEGREE - 1)
+#define MAX_KEYS (2 * MIN_DEGREE - 1)
+
+/* Enough for any tree addressable in memory, since each level multiplies the size by MIN_DEGREE */
+#define MAX_DEPTH 32
+
+typedef struct node_t {
+    size_t count;
+    size_t size;
+    bool leaf;
+    T keys[MAX_KEYS];
+    struct node_t *children[MAX_KEYS + 1];
+} node_t;
+
+struct btree_t {
+    node_t *root;
+    size_t size;
+    compare_t compare;
+    key_of_t key_of;
+    destroy_t destroy;
+    pool_t *leaves;
+    pool_t *branches;
+};
+
+typedef struct btree_iterator_t {
+    iterator_t iterator;
+    node_t *path[MAX_DEPTH];
+    size_t index[MAX_DEPTH];
+    size_t depth;
+    node_t *end_node;
+    size_t end_index;
+    bool reverse;
+} btree_iterator_t;
+
+/**
+ * @brief Create an empty node_t object.
+ *        Leaves never use the children array, so they come from a pool with smaller blocks.
+ * @param tree The btree_t object which owns the node.
+ * @param leaf Whether the node is a leaf.
+ * @return Returns the node_t object if create successfully, otherwise returns NULL.
+ */
+static node_t *__node_new(btree_t *tree, bool leaf) {
+    node_t *node = NULL;
+
+    node = (node_t *)pool_alloc(leaf ? tree->leaves : tree->branches);
+    return_value_if_fail(node != NULL, NULL);
+
+    node->count = 0;
+    node->size = 0;
+    node->leaf = leaf;
+    return node;
+}
+
+/**
+ * @brief Return a node_t object to the pool of its tree.
+ * @param tree The btree_t object which owns the node.
+ * @param node The node_t object.
+ */
+static void __node_delete(btree_t *tree, node_t *node) {
+    return_if_fail(node != NULL);
+    pool_free(node->leaf ? tree->leaves : tree->branches, node);
+}
+
+/**
+ * @brief Get the ordering key of a data item.
+ * @param tree The btree_t object.
+ * @param data The data item.
+ * @return Returns the key of the data item.
+ */
+static T __key(const btree_t *tree, T data) {
+    if (tree->key_of == NULL) {
+        return data;
+    }
+    return tree->key_of(data);
+}
+
+/**
+ * @brief Binary search a node for the first key which is greater than or equal to the given key.
+ * @param tree The btree_t object.
+ * @param node The node_t object.
+ * @param key The key.
+ * @param found Set to whether the key at the returned index is equal to the given key.
+ * @return Returns the index in [0, node->count].
+ */
+static size_t __search(const btree_t *tree, const node_t *node, T key, bool *found) {
+    size_t low = 0;
+    size_t high = node->count;
+    size_t mid = 0;
+    int cmp;
+
+    *found = false;
+    while (low < high) {
+        mid = low + (high - low) / 2;
+        cmp = tree->compare(key, __key(tree, node->keys[mid]));
+        if (cmp > 0) {
+            low = mid + 1;
+        } else {
+            high = mid;
+            if (cmp == 0) {
+                *found = true;
+                break;
+            }
+        }
+    }
+    return high;
+}
+
+/**
+ * @brief Recompute the number of keys in the subtree of a node from its children.
+ * @param node The node_t object.
+ */
+static void __update_size(node_t *node) {
+    size_t i = 0;
+
+    node->size = node->count;
+    if (!node->leaf) {
+        for (i = 0; i <= node->count; i++) {
+            node->size += node->children[i]->size;
+        }
+    }
+}
+
+/**
+ * @brief Create a btree_t object.
+ * @param compare Callback function for comparing two data items.
+ * @param destroy Callback function for destroying a data item.
+ * @return Returns the btree_t object if create successfully, otherwise returns NULL.
+ */
+btree_t *btree_new(compare_t compare, destroy_t destroy) {
+    return btree_new_with_key(compare, NULL, destroy);
+}
+
+/**
+ * @brief Create a btree_t object which orders data items by an extracted key.
+ * @param compare Callback function for comparing two keys.
+ * @param key_of Callback function for extracting the key from a data item, or NULL to compare data items directly.
+ * @param destroy Callback function for destroying a data item.
+ * @return Returns the btree_t object if create successfully, otherwise returns NULL.
+ * @note The comparator and key extractor are stored per tree, so trees with different orderings can coexist.
+ *       Lookup and removal functions take the raw key rather than a whole data item.
+ */
+btree_t *btree_new_with_key(compare_t compare, key_of_t key_of, destroy_t destroy) {
+    btree_t *tree = NULL;
+
+    return_value_if_fail(compare != NULL, NULL);
+
+    tree = (btree_t *)malloc(sizeof(btree_t));
+    return_value_if_fail(tree != NULL, NULL);
+
+    tree->leaves = pool_new(offsetof(node_t, children));
+    tree->branches = pool_new(sizeof(node_t));
+    if (tree->leaves == NULL || tree->branches == NULL) {
+        pool_delete(tree->leaves);
+        pool_delete(tree->branches);
+        free(tree);
+        return NULL;
+    }
+
+    tree->root = NULL;
+    tree->size = 0;
+    tree->compare = compare;
+    tree->key_of = key_of;
+    tree->destroy = destroy;
+    return tree;
+}
+
+/**
+ * @brief Link `n` data items in ascending order into a subtree of the given height.
+ *        The children share the items evenly, and a branch has at least MIN_DEGREE children unless it is
+ *        the root, so every node ends up within the key bounds.
+ * @param tree The btree_t object which owns the nodes.
+ * @param data The data items.
+ * @param n The number of data items.
+ * @param capacity The most keys a subtree of this height holds, (2 * MIN_DEGREE)^height - 1.
+ * @param root Whether the subtree is the whole tree.
+ * @return Returns the root of the subtree if successful, otherwise returns NULL.
+ */
+static node_t *__build(btree_t *tree, T *data, size_t n, size_t capacity, bool root) {
+    node_t *node = NULL;
+    size_t child_capacity = 0;
+    size_t children = 0;
+    size_t share = 0;
+    size_t i = 0;
+
+    node = __node_new(tree, capacity == MAX_KEYS);
+    return_value_if_fail(node != NULL, NULL);
+
+    if (node->leaf) {
+        memcpy(node->keys, data, n * sizeof(T));
+        node->count = n;
+        node->size = n;
+        return node;
+    }
+
+    /* The fewest children that can hold the items, each of them at least half full */
+    child_capacity = (capacity + 1) / (2 * MIN_DEGREE) - 1;
+    children = (n + 1 + child_capacity) / (child_capacity + 1);
+    if (!root) {
+        children = max(children, MIN_DEGREE);
+    }
+
+    n -= children - 1;
+    for (i = 0; i < children; i++) {
+        share = n / children + (i < n % children ? 1 : 0);
+        node->children[i] = __build(tree, data, share, child_capacity, false);
+        return_value_if_fail(node->children[i] != NULL, NULL);
+        data += share;
+        if (i + 1 < children) {
+            node->keys[i] = *data++;
+            node->count++;
+        }
+    }
+    __update_size(node);
+    return node;
+}
+
+/**
+ * @brief Create a btree_t object from the data items of an array_t object in strictly ascending order.
+ *        The nodes are filled level by level in O(n) without a single comparison-driven insert or split.
+ * @param compare Callback function for comparing two keys.
+ * @param key_of Callback function for extracting the key from a data item, or NULL to compare data items directly.
+ * @param destroy Callback function for destroying a data item.
+ * @param array The array_t object.
+ * @return Returns the btree_t object if create successfully, otherwise returns NULL,
+ *         including when the data items are not in strictly ascending order.
+ * @note The tree takes over the data items if successful. Caller MUST NOT destroy them through the array
+ *       afterwards (e.g. create the array with a NULL destroy callback).
+ */
+btree_t *btree_new_from_sorted(compare_t compare, key_of_t key_of, destroy_t destroy, const array_t *array) {
+    btree_t *tree = NULL;
+    T *data = NULL;
+    size_t capacity = MAX_KEYS;
+    size_t n = 0;
+    size_t i = 0;
+
+    return_value_if_fail(compare != NULL && array != NULL, NULL);
+
+    tree = btree_new_with_key(compare, key_of, destroy);
+    return_value_if_fail(tree != NULL, NULL);
+
+    n = array_size(array);
+    return_value_if(n == 0, tree);
+
+    data = (T *)malloc(n * sizeof(T));
+    if (data == NULL) {
+        btree_delete(tree);
+        return NULL;
+    }
+    for (i = 0; i < n; i++) {
+        data[i] = array_get(array, i);
+        if (i > 0 && compare(__key(tree, data[i - 1]), __key(tree, data[i])) >= 0) {
+            free(data);
+            btree_delete(tree);
+            return NULL;
+        }
+    }
+
+    while (n > capacity) {
+        capacity = (capacity + 1) * (2 * MIN_DEGREE) - 1;
+    }
+    tree->root = __build(tree, data, n, capacity, true);
+    free(data);
+
+    /* out of memory, hand the data items back untouched */
+    if (tree->root == NULL) {
+        tree->destroy = NULL;
+        btree_delete(tree);
+        return NULL;
+    }
+    tree->size = n;
+    return tree;
+}
+
+/**
+ * @brief Destroy a btree_t object.
+ * @param tree The btree_t object.
+ */
+void btree_delete(btree_t *tree) {
+    return_if_fail(tree != NULL);
+    btree_clear(tree);
+    pool_delete(tree->leaves);
+    pool_delete(tree->branches);
+    free(tree);
+}
+
+/**
+ * @brief Determine whether the btree_t object is empty.
+ * @param tree The btree_t object.
+ * @return Returns true if the btree_t object is empty, otherwise returns false.
+ */
+bool btree_is_empty(const btree_t *tree) {
+    return_value_if_fail(tree != NULL, true);
+    return tree->size == 0;
+}
+
+/**
+ * @brief Get the number of keys in the btree_t object.
+ * @param tree The btree_t object.
+ * @return Returns the number of keys in the btree_t object.
+ */
+size_t btree_size(const btree_t *tree) {
+    return_value_if_fail(tree != NULL, 0);
+    return tree->size;
+}
+
+/**
+ * @brief Destroy all data items in the subtree of a node.
+ * @param tree The btree_t object.
+ * @param node The node_t object.
+ */
+static void __destroy_keys(btree_t *tree, node_t *node) {
+    size_t i = 0;
+
+    for (i = 0; i < node->count; i++) {
+        tree->destroy(node->keys[i]);
+    }
+    if (!node->leaf) {
+        for (i = 0; i <= node->count; i++) {
+            __destroy_keys(tree, node->children[i]);
+        }
+    }
+}
+
+/**
+ * @brief Clear the btree_t object.
+ * @param tree The btree_t object.
+ * @return Returns the modified btree_t object.
+ */
+btree_t *btree_clear(btree_t *tree) {
+    return_value_if_fail(tree != NULL, NULL);
+
+    /* Nodes are released in bulk with their slabs, so only the keys need a visit */
+    if (tree->destroy != NULL && tree->root != NULL) {
+        __destroy_keys(tree, tree->root);
+    }
+    pool_clear(tree->leaves);
+    pool_clear(tree->branches);
+
+    tree->root = NULL;
+    tree->size = 0;
+    return tree;
+}
+
+/**
+ * @brief Checks whether the btree_t object contains the key.
+ * @param tree The btree_t object.
+ * @param key The key.
+ * @return Returns true if the btree_t object contains the key, otherwise returns false.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+bool btree_contains(const btree_t *tree, T key) {
+    return_value_if_fail(tree != NULL, false);
+    return btree_find(tree, key) != NULL;
+}
+
+/**
+ * @brief Traverse the btree_t object.
+ * @param tree The btree_t object.
+ * @param visit Callback function for visiting a data item.
+ */
+void btree_foreach(btree_t *tree, visit_t visit) {
+    iterator_t *iterator = NULL;
+    T key = NULL;
+
+    return_if_fail(tree != NULL && visit != NULL);
+
+    iterator = btree_iterator_new(tree);
+    while (btree_iterator_has_next(iterator)) {
+        key = btree_iterator_next(iterator);
+        visit(key);
+    }
+    btree_iterator_delete(iterator);
+}
+
+/**
+ * @brief Split the full child at the specified position of a node in two halves
+ *        and move the median key up into the node.
+ * @param tree The btree_t object.
+ * @param parent The node_t object, which MUST NOT be full.
+ * @param i The index of the full child.
+ * @return Returns true if memory allocation is successful, otherwise returns false.
+ */
+static bool __split_child(btree_t *tree, node_t *parent, size_t i) {
+    node_t *left = parent->children[i];
+    node_t *right = NULL;
+
+    right = __node_new(tree, left->leaf);
+    return_value_if_fail(right != NULL, false);
+
+    right->count = MIN_KEYS;
+    memcpy(right->keys, left->keys + MIN_DEGREE, MIN_KEYS * sizeof(T));
+    if (!left->leaf) {
+        memcpy(right->children, left->children + MIN_DEGREE, MIN_DEGREE * sizeof(node_t *));
+    }
+    __update_size(right);
+
+    left->count = MIN_KEYS;
+    left->size -= right->size + 1;
+
+    memmove(parent->keys + i + 1, parent->keys + i, (parent->count - i) * sizeof(T));
+    memmove(parent->children + i + 2, parent->children + i + 1, (parent->count - i) * sizeof(node_t *));
+    parent->keys[i] = left->keys[MIN_KEYS];
+    parent->children[i + 1] = right;
+    parent->count++;
+    return true;
+}
+
+/**
+ * @brief Keep one of two data items with equal keys.
+ * @param tree The btree_t object.
+ * @param slot The slot in the tree which holds the existing data item.
+ * @param data The new data item.
+ * @param replace Whether the new data item replaces the existing one.
+ */
+static void __keep_one(btree_t *tree, T *slot, T data, bool replace) {
+    if (replace) {
+        swap(*slot, data, T);
+    }
+    if (tree->destroy != NULL) {
+        tree->destroy(data);
+    }
+}
+
+/**
+ * @brief Insert a data item into the subtree of a node which is not full.
+ *        Full children are split on the way down, so a split never has to propagate upwards.
+ * @param tree The btree_t object.
+ * @param node The node_t object.
+ * @param key The key of the data item.
+ * @param data The data item.
+ * @param replace Whether an existing data item with an equal key is replaced by the new one.
+ * @return Returns true if the number of keys grows, otherwise returns false.
+ */
+static bool __insert_nonfull(btree_t *tree, node_t *node, T key, T data, bool replace) {
+    size_t i = 0;
+    bool found = false;
+    int cmp;
+
+    i = __search(tree, node, key, &found);
+    if (found) {
+        __keep_one(tree, &node->keys[i], data, replace);
+        return false;
+    }
+
+    if (node->leaf) {
+        memmove(node->keys + i + 1, node->keys + i, (node->count - i) * sizeof(T));
+        node->keys[i] = data;
+        node->count++;
+        node->size++;
+        return true;
+    }
+
+    if (node->children[i]->count == MAX_KEYS) {
+        return_value_if_fail(__split_child(tree, node, i), false);
+
+        cmp = tree->compare(key, __key(tree, node->keys[i]));
+        if (cmp == 0) {
+            __keep_one(tree, &node->keys[i], data, replace);
+            return false;
+        } else if (cmp > 0) {
+            i++;
+        }
+    }
+
+    if (__insert_nonfull(tree, node->children[i], key, data, replace)) {
+        node->size++;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Insert a data item, or handle an existing data item with an equal key.
+ *        The tree is walked only once in both cases.
+ * @param tree The btree_t object.
+ * @param data The data item.
+ * @param replace Whether an existing data item with an equal key is replaced by the new one.
+ *                Otherwise the new data item is discarded.
+ * @return Returns the modified btree_t object.
+ */
+static btree_t *__insert(btree_t *tree, T data, bool replace) {
+    node_t *root = NULL;
+
+    return_value_if_fail(tree != NULL && data != NULL, tree);
+
+    if (tree->root == NULL) {
+        tree->root = __node_new(tree, true);
+        return_value_if_fail(tree->root != NULL, tree);
+    }
+
+    if (tree->root->count == MAX_KEYS) {
+        root = __node_new(tree, false);
+        return_value_if_fail(root != NULL, tree);
+
+        root->children[0] = tree->root;
+        root->size = tree->root->size;
+        if (!__split_child(tree, root, 0)) {
+            __node_delete(tree, root);
+            return tree;
+        }
+        tree->root = root;
+    }
+
+    if (__insert_nonfull(tree, tree->root, __key(tree, data), data, replace)) {
+        tree->size++;
+    }
+    return tree;
+}
+
+/**
+ * @brief Inserts a key into the B-tree.
+ *        If the tree already contains an equal key, the new key is destroyed (if applicable).
+ * @param tree The btree_t object.
+ * @param key The key.
+ * @return Returns the modified btree_t object.
+ */
+btree_t *btree_insert(btree_t *tree, T key) {
+    return __insert(tree, key, false);
+}
+
+/**
+ * @brief Inserts a data item into the B-tree, or replaces the data item with an equal key in place.
+ *        The replaced data item is destroyed (if applicable).
+ * @param tree The btree_t object.
+ * @param data The data item.
+ * @return Returns the modified btree_t object.
+ */
+btree_t *btree_put(btree_t *tree, T data) {
+    return __insert(tree, data, true);
+}
+
+/**
+ * @brief Move the last key of the left sibling through the parent into the child at the specified position.
+ * @param node The parent node_t object.
+ * @param i The index of the child.
+ */
+static void __borrow_left(node_t *node, size_t i) {
+    node_t *child = node->children[i];
+    node_t *left = node->children[i - 1];
+    size_t moved = 0;
+
+    memmove(child->keys + 1, child->keys, child->count * sizeof(T));
+    child->keys[0] = node->keys[i - 1];
+    node->keys[i - 1] = left->keys[left->count - 1];
+
+    if (!child->leaf) {
+        memmove(child->children + 1, child->children, (child->count + 1) * sizeof(node_t *));
+        child->children[0] = left->children[left->count];
+        moved = child->children[0]->size;
+    }
+
+    child->count++;
+    left->count--;
+    child->size += moved + 1;
+    left->size -= moved + 1;
+}
+
+/**
+ * @brief Move the first key of the right sibling through the parent into the child at the specified position.
+ * @param node The parent node_t object.
+ * @param i The index of the child.
+ */
+static void __borrow_right(node_t *node, size_t i) {
+    node_t *child = node->children[i];
+    node_t *right = node->children[i + 1];
+    size_t moved = 0;
+
+    child->keys[child->count] = node->keys[i];
+    node->keys[i] = right->keys[0];
+    memmove(right->keys, right->keys + 1, (right->count - 1) * sizeof(T));
+
+    if (!child->leaf) {
+        child->children[child->count + 1] = right->children[0];
+        moved = right->children[0]->size;
+        memmove(right->children, right->children + 1, right->count * sizeof(node_t *));
+    }
+
+    child->count++;
+    right->count--;
+    child->size += moved + 1;
+    right->size -= moved + 1;
+}
+
+/**
+ * @brief Merge the child at the specified position, the separating key and the right sibling into one node.
+ * @param tree The btree_t object.
+ * @param node The parent node_t object.
+ * @param i The index of the left child.
+ */
+static void __merge(btree_t *tree, node_t *node, size_t i) {
+    node_t *left = node->children[i];
+    node_t *right = node->children[i + 1];
+
+    left->keys[left->count] = node->keys[i];
+    memcpy(left->keys + left->count + 1, right->keys, right->count * sizeof(T));
+    if (!left->leaf) {
+        memcpy(left->children + left->count + 1, right->children, (right->count + 1) * sizeof(node_t *));
+    }
+    left->count += right->count + 1;
+    left->size += right->size + 1;
+
+    memmove(node->keys + i, node->keys + i + 1, (node->count - i - 1) * sizeof(T));
+    memmove(node->children + i + 1, node->children + i + 2, (node->count - i - 1) * sizeof(node_t *));
+    node->count--;
+
+    __node_delete(tree, right);
+}
+
+/**
+ * @brief Restore the minimum occupancy of the child at the specified position after a removal below it.
+ * @param tree The btree_t object.
+ * @param node The parent node_t object.
+ * @param i The index of the child.
+ */
+static void __rebalance(btree_t *tree, node_t *node, size_t i) {
+    return_if(node->children[i]->count >= MIN_KEYS);
+
+    if (i > 0 && node->children[i - 1]->count > MIN_KEYS) {
+        __borrow_left(node, i);
+    } else if (i < node->count && node->children[i + 1]->count > MIN_KEYS) {
+        __borrow_right(node, i);
+    } else if (i < node->count) {
+        __merge(tree, node, i);
+    } else {
+        __merge(tree, node, i - 1);
+    }
+}
+
+/**
+ * @brief Remove the maximum data item from the subtree of a node.
+ * @param tree The btree_t object.
+ * @param node The node_t object.
+ * @return Returns the removed data item.
+ */
+static T __remove_max(btree_t *tree, node_t *node) {
+    T data = NULL;
+
+    node->size--;
+    if (node->leaf) {
+        node->count--;
+        return node->keys[node->count];
+    }
+
+    data = __remove_max(tree, node->children[node->count]);
+    __rebalance(tree, node, node->count);
+    return data;
+}
+
+/**
+ * @brief Remove the data item with the given key from the subtree of a node.
+ * @param tree The btree_t object.
+ * @param node The node_t object.
+ * @param key The key.
+ * @return Returns the removed data item if found, otherwise returns NULL.
+ */
+static T __remove(btree_t *tree, node_t *node, T key) {
+    T data = NULL;
+    size_t i = 0;
+    bool found = false;
+
+    i = __search(tree, node, key, &found);
+
+    if (node->leaf) {
+        return_value_if_fail(found, NULL);
+        data = node->keys[i];
+        memmove(node->keys + i, node->keys + i + 1, (node->count - i - 1) * sizeof(T));
+        node->count--;
+        node->size--;
+        return data;
+    }
+
+    if (found) {
+        /* Replace the key with its predecessor, which always lives in a leaf */
+        data = node->keys[i];
+        node->keys[i] = __remove_max(tree, node->children[i]);
+    } else {
+        data = __remove(tree, node->children[i], key);
+        return_value_if_fail(data != NULL, NULL);
+    }
+
+    node->size--;
+    __rebalance(tree, node, i);
+    return data;
+}
+
+/**
+ * @brief Removes a key from the btree_t object.
+ * @param tree The btree_t object.
+ * @param key The key.
+ * @return Returns the modified btree_t object.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+btree_t *btree_remove(btree_t *tree, T key) {
+    node_t *root = NULL;
+    T data = NULL;
+
+    return_value_if_fail(tree != NULL && key != NULL, tree);
+    return_value_if_fail(tree->root != NULL, tree);
+
+    data = __remove(tree, tree->root, key);
+
+    /* key not found */
+    return_value_if_fail(data != NULL, tree);
+
+    root = tree->root;
+    if (root->count == 0) {
+        tree->root = root->leaf ? NULL : root->children[0];
+        __node_delete(tree, root);
+    }
+
+    if (tree->destroy != NULL) {
+        tree->destroy(data);
+    }
+
+    tree->size--;
+    return tree;
+}
+
+/**
+ * @brief Get the greatest data item whose key is less than (or equal to) the given key.
+ * @param tree The btree_t object.
+ * @param key The key.
+ * @param inclusive Whether a data item with an equal key matches.
+ * @return Returns the data item if exists, otherwise returns NULL.
+ */
+static T __floor(const btree_t *tree, T key, bool inclusive) {
+    node_t *node = tree->root;
+    T floor = NULL;
+    size_t i = 0;
+    bool found = false;
+
+    while (node != NULL) {
+        i = __search(tree, node, key, &found);
+        if (found && inclusive) {
+            return node->keys[i];
+        }
+        if (i > 0) {
+            floor = node->keys[i - 1];
+        }
+        node = node->leaf ? NULL : node->children[i];
+    }
+    return floor;
+}
+
+/**
+ * @brief Get the least data item whose key is greater than (or equal to) the given key.
+ * @param tree The btree_t object.
+ * @param key The key.
+ * @param inclusive Whether a data item with an equal key matches.
+ * @return Returns the data item if exists, otherwise returns NULL.
+ */
+static T __ceiling(const btree_t *tree, T key, bool inclusive) {
+    node_t *node = tree->root;
+    T ceiling = NULL;
+    size_t i = 0;
+    bool found = false;
+
+    while (node != NULL) {
+        i = __search(tree, node, key, &found);
+        if (found) {
+            if (inclusive) {
+                return node->keys[i];
+            }
+            i++;
+        }
+        if (i < node->count) {
+            ceiling = node->keys[i];
+        }
+        node = node->leaf ? NULL : node->children[i];
+    }
+    return ceiling;
+}
+
+/**
+ * @brief Find the key in the btree_t object which is equal to the given key.
+ * @param tree The btree_t object.
+ * @param key The key.
+ * @return Returns the key stored in the tree if found, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+T btree_find(const btree_t *tree, T key) {
+    node_t *node = NULL;
+    size_t i = 0;
+    bool found = false;
+
+    return_value_if_fail(tree != NULL && key != NULL, NULL);
+
+    node = tree->root;
+    while (node != NULL) {
+        i = __search(tree, node, key, &found);
+        if (found) {
+            return node->keys[i];
+        }
+        node = node->leaf ? NULL : node->children[i];
+    }
+    return NULL;
+}
+
+/**
+ * @brief Find the greatest key in the btree_t object which is less than or equal to the given key.
+ * @param tree The btree_t object.
+ * @param key The key.
+ * @return Returns the key stored in the tree if found, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+T btree_floor(const btree_t *tree, T key) {
+    return_value_if_fail(tree != NULL && key != NULL, NULL);
+    return __floor(tree, key, true);
+}
+
+/**
+ * @brief Find the least key in the btree_t object which is greater than or equal to the given key.
+ * @param tree The btree_t object.
+ * @param key The key.
+ * @return Returns the key stored in the tree if found, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+T btree_ceiling(const btree_t *tree, T key) {
+    return_value_if_fail(tree != NULL && key != NULL, NULL);
+    return __ceiling(tree, key, true);
+}
+
+/**
+ * @brief Find the greatest key in the btree_t object which is strictly less than the given key.
+ * @param tree The btree_t object.
+ * @param key The key.
+ * @return Returns the key stored in the tree if found, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+T btree_lower(const btree_t *tree, T key) {
+    return_value_if_fail(tree != NULL && key != NULL, NULL);
+    return __floor(tree, key, false);
+}
+
+/**
+ * @brief Find the least key in the btree_t object which is strictly greater than the given key.
+ * @param tree The btree_t object.
+ * @param key The key.
+ * @return Returns the key stored in the tree if found, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+T btree_higher(const btree_t *tree, T key) {
+    return_value_if_fail(tree != NULL && key != NULL, NULL);
+    return __ceiling(tree, key, false);
+}
+
+/**
+ * @brief Get the minimum key in the btree_t object.
+ * @param tree The btree_t object.
+ * @return Returns the minimum key if the tree is not empty, otherwise returns NULL.
+ */
+T btree_min(const btree_t *tree) {
+    node_t *node = NULL;
+
+    return_value_if_fail(tree != NULL && tree->root != NULL, NULL);
+
+    node = tree->root;
+    while (!node->leaf) {
+        node = node->children[0];
+    }
+    return node->keys[0];
+}
+
+/**
+ * @brief Get the maximum key in the btree_t object.
+ * @param tree The btree_t object.
+ * @return Returns the maximum key if the tree is not empty, otherwise returns NULL.
+ */
+T btree_max(const btree_t *tree) {
+    node_t *node = NULL;
+
+    return_value_if_fail(tree != NULL && tree->root != NULL, NULL);
+
+    node = tree->root;
+    while (!node->leaf) {
+        node = node->children[node->count];
+    }
+    return node->keys[node->count - 1];
+}
+
+/**
+ * @brief Get the key with the specified rank in the btree_t object.
+ * @param tree The btree_t object.
+ * @param index The 0-based rank, i.e. the number of smaller keys.
+ * @return Returns the key if the index is valid, otherwise returns NULL.
+ */
+T btree_select(const btree_t *tree, size_t index) {
+    node_t *node = NULL;
+    size_t i = 0;
+    size_t child_size = 0;
+
+    return_value_if_fail(tree != NULL, NULL);
+    return_value_if_fail(index < tree->size, NULL);
+
+    node = tree->root;
+    while (!node->leaf) {
+        for (i = 0; i < node->count; i++) {
+            child_size = node->children[i]->size;
+            if (index < child_size) {
+                break;
+            } else if (index == child_size) {
+                return node->keys[i];
+            }
+            index -= child_size + 1;
+        }
+        node = node->children[i];
+    }
+    return node->keys[index];
+}
+
+/**
+ * @brief Count the keys in the btree_t object which are strictly less than the given key.
+ * @param tree The btree_t object.
+ * @param key The key, which does not need to be in the tree.
+ * @return Returns the rank of the key.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+size_t btree_rank(const btree_t *tree, T key) {
+    node_t *node = NULL;
+    size_t rank = 0;
+    size_t i = 0;
+    size_t j = 0;
+    bool found = false;
+
+    return_value_if_fail(tree != NULL && key != NULL, 0);
+
+    node = tree->root;
+    while (node != NULL) {
+        i = __search(tree, node, key, &found);
+        rank += i;
+        if (node->leaf) {
+            break;
+        }
+        for (j = 0; j < i; j++) {
+            rank += node->children[j]->size;
+        }
+        if (found) {
+            rank += node->children[i]->size;
+            break;
+        }
+        node = node->children[i];
+    }
+    return rank;
+}
+
+/**
+ * @brief Push a node and a position within it onto the path of an iterator.
+ * @param iterator The btree_iterator_t object.
+ * @param node The node_t object.
+ * @param index The position within the node.
+ */
+static void __push(btree_iterator_t *iterator, node_t *node, size_t index) {
+    iterator->path[iterator->depth] = node;
+    iterator->index[iterator->depth] = index;
+    iterator->depth++;
+}
+
+/**
+ * @brief Descend from a node to the leaf holding the first key (or the last key in reverse order).
+ * @param iterator The btree_iterator_t object.
+ * @param node The node_t object.
+ * @note In reverse order, the position i refers to the key at index i - 1.
+ */
+static void __descend(btree_iterator_t *iterator, node_t *node) {
+    while (node != NULL) {
+        if (iterator->reverse) {
+            __push(iterator, node, node->count);
+            node = node->leaf ? NULL : node->children[node->count];
+        } else {
+            __push(iterator, node, 0);
+            node = node->leaf ? NULL : node->children[0];
+        }
+    }
+}
+
+/**
+ * @brief Pop exhausted nodes off the path of an iterator and check the stop position.
+ * @param iterator The btree_iterator_t object.
+ */
+static void __settle(btree_iterator_t *iterator) {
+    size_t top = 0;
+
+    while (iterator->depth > 0) {
+        top = iterator->depth - 1;
+        if (iterator->reverse ? iterator->index[top] > 0 : iterator->index[top] < iterator->path[top]->count) {
+            break;
+        }
+        iterator->depth--;
+    }
+
+    if (iterator->depth == 0) {
+        iterator->iterator.current = NULL;
+        return;
+    }
+
+    top = iterator->depth - 1;
+    if (iterator->path[top] == iterator->end_node && iterator->index[top] == iterator->end_index) {
+        iterator->iterator.current = NULL;
+    } else {
+        iterator->iterator.current = iterator->path[top];
+    }
+}
+
+/**
+ * @brief Position an iterator at the first key which is greater than or equal to the given key.
+ * @param tree The btree_t object.
+ * @param iterator The btree_iterator_t object.
+ * @param key The key.
+ */
+static void __seek(const btree_t *tree, btree_iterator_t *iterator, T key) {
+    node_t *node = tree->root;
+    size_t i = 0;
+    bool found = false;
+
+    iterator->depth = 0;
+    while (node != NULL) {
+        i = __search(tree, node, key, &found);
+        __push(iterator, node, i);
+        if (found) {
+            break;
+        }
+        node = node->leaf ? NULL : node->children[i];
+    }
+    __settle(iterator);
+}
+
+/**
+ * @brief Allocate an iterator with an empty path.
+ * @param tree The btree_t object.
+ * @param reverse Whether to walk the keys in descending order.
+ * @return Returns the iterator if successful, otherwise returns NULL.
+ */
+static btree_iterator_t *__iterator_new(const btree_t *tree, bool reverse) {
+    btree_iterator_t *iterator = NULL;
+
+    iterator = (btree_iterator_t *)malloc(sizeof(btree_iterator_t));
+    return_value_if_fail(iterator != NULL, NULL);
+
+    iterator->iterator.container = (void *)tree;
+    iterator->iterator.current = NULL;
+    iterator->depth = 0;
+    iterator->end_node = NULL;
+    iterator->end_index = 0;
+    iterator->reverse = reverse;
+    return iterator;
+}
+
+/**
+ * @brief Create an iterator for a btree_t object.
+ * @param tree The btree_t object.
+ * @return Returns the iterator for container.
+ */
+iterator_t *btree_iterator_new(const btree_t *tree) {
+    btree_iterator_t *iterator = NULL;
+
+    return_value_if_fail(tree != NULL, NULL);
+
+    iterator = __iterator_new(tree, false);
+    return_value_if_fail(iterator != NULL, NULL);
+
+    __descend(iterator, tree->root);
+    __settle(iterator);
+    return (iterator_t *)iterator;
+}
+
+/**
+ * @brief Create an iterator over the keys in [lo, hi) of a btree_t object in ascending order.
+ *        Seeking to the first key and locating the stop position both take O(log n).
+ * @param tree The btree_t object.
+ * @param lo The inclusive lower bound, or NULL for no lower bound.
+ * @param hi The exclusive upper bound, or NULL for no upper bound.
+ * @return Returns the iterator for container.
+ * @note Caller MUST free the parameters `lo` and `hi` (if applicable).
+ */
+iterator_t *btree_iterator_range(const btree_t *tree, T lo, T hi) {
+    btree_iterator_t *iterator = NULL;
+
+    return_value_if_fail(tree != NULL, NULL);
+
+    iterator = __iterator_new(tree, false);
+    return_value_if_fail(iterator != NULL, NULL);
+
+    if (lo != NULL && hi != NULL && tree->compare(lo, hi) >= 0) {
+        return (iterator_t *)iterator;
+    }
+
+    if (hi != NULL) {
+        __seek(tree, iterator, hi);
+        if (iterator->iterator.current != NULL) {
+            iterator->end_node = iterator->path[iterator->depth - 1];
+            iterator->end_index = iterator->index[iterator->depth - 1];
+        }
+    }
+
+    if (lo != NULL) {
+        __seek(tree, iterator, lo);
+    } else {
+        iterator->depth = 0;
+        __descend(iterator, tree->root);
+        __settle(iterator);
+    }
+    return (iterator_t *)iterator;
+}
+
+/**
+ * @brief Create an iterator for a btree_t object in descending order.
+ * @param tree The btree_t object.
+ * @return Returns the iterator for container.
+ */
+iterator_t *btree_iterator_reverse(const btree_t *tree) {
+    btree_iterator_t *iterator = NULL;
+
+    return_value_if_fail(tree != NULL, NULL);
+
+    iterator = __iterator_new(tree, true);
+    return_value_if_fail(iterator != NULL, NULL);
+
+    __descend(iterator, tree->root);
+    __settle(iterator);
+    return (iterator_t *)iterator;
+}
+
+/**
+ * @brief Destroy an iterator.
+ * @param iterator The iterator_t object.
+ */
+void btree_iterator_delete(iterator_t *iterator) {
+    return_if_fail(iterator != NULL);
+    free(iterator);
+}
+
+/**
+ * @brief Determine whether an iterator has the next element.
+ * @param iterator The iterator_t object.
+ * @return Returns true if the iterator has the next element, otherwise returns false.
+ */
+bool btree_iterator_has_next(const iterator_t *iterator) {
+    return_value_if_fail(iterator != NULL, false);
+    return iterator->current != NULL;
+}
+
+/**
+ * @brief Get the next element of an iterator.
+ * @param iterator The iterator_t object.
+ * @return Returns the next element of the iterator.
+ */
+T btree_iterator_next(iterator_t *iterator) {
+    btree_iterator_t *tree_iterator = NULL;
+    node_t *node = NULL;
+    size_t top = 0;
+    size_t i = 0;
+    T elem = NULL;
+
+    return_value_if_fail(iterator != NULL, NULL);
+    return_value_if_fail(btree_iterator_has_next(iterator), NULL);
+
+    tree_iterator = (btree_iterator_t *)iterator;
+    top = tree_iterator->depth - 1;
+    node = tree_iterator->path[top];
+    i = tree_iterator->index[top];
+
+    /* Step past the key, then into the subtree between it and its neighbour */
+    if (tree_iterator->reverse) {
+        elem = node->keys[i - 1];
+        tree_iterator->index[top] = i - 1;
+        if (!node->leaf) {
+            __descend(tree_iterator, node->children[i - 1]);
+        }
+    } else {
+        elem = node->keys[i];
+        tree_iterator->index[top] = i + 1;
+        if (!node->leaf) {
+            __descend(tree_iterator, node->children[i + 1]);
+        }
+    }
+    __settle(tree_iterator);
+    return elem;
+}
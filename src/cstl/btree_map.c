@@ -0,0 +1,307 @@
+#include "cstl/btree_map.h"
+#include "cstl/btree.h"
+
+struct btree_map_t {
+    btree_t *tree;
+    compare_t compare;
+};
+
+/**
+ * @brief Private function for extracting the key of a pair_t object.
+ * @param data The pair_t object.
+ * @return Returns the key of the pair_t object.
+ */
+static T __pair_key(const T data) {
+    return pair_get_key((pair_t *)data);
+}
+
+/**
+ * @brief Create a btree_map_t object.
+ * @param compare Callback function for comparing two keys.
+ * @return Returns the created btree_map_t object if successful, otherwise returns NULL.
+ */
+btree_map_t *btree_map_new(compare_t compare) {
+    btree_map_t *map = NULL;
+
+    return_value_if_fail(compare != NULL, NULL);
+
+    map = (btree_map_t *)malloc(sizeof(btree_map_t));
+    return_value_if_fail(map != NULL, NULL);
+
+    map->tree = btree_new_with_key(compare, __pair_key, (destroy_t)pair_delete);
+    if (map->tree == NULL) {
+        free(map);
+        return NULL;
+    }
+
+    map->compare = compare;
+    return map;
+}
+
+/**
+ * @brief Destroy a btree_map_t object.
+ * @param map The btree_map_t object.
+ */
+void btree_map_delete(btree_map_t *map) {
+    return_if_fail(map != NULL);
+    btree_delete(map->tree);
+    free(map);
+}
+
+/**
+ * @brief Determine whether a btree_map_t object is empty.
+ * @param map The btree_map_t object.
+ * @return Returns true if the btree_map_t object is empty, otherwise returns false.
+ */
+bool btree_map_is_empty(btree_map_t *map) {
+    return_value_if_fail(map != NULL, true);
+    return btree_is_empty(map->tree);
+}
+
+/**
+ * @brief Get the size of a btree_map_t object.
+ * @param map The btree_map_t object.
+ * @return Returns the size of the btree_map_t object.
+ */
+size_t btree_map_size(btree_map_t *map) {
+    return_value_if_fail(map != NULL, 0);
+    return btree_size(map->tree);
+}
+
+/**
+ * @brief Traverse a btree_map_t object.
+ * @param map The btree_map_t object.
+ * @param visit Callback function for visiting a key-value pair.
+ */
+void btree_map_foreach(btree_map_t *map, visit_pair_t visit) {
+    iterator_t *iterator = NULL;
+
+    return_if_fail(map != NULL && visit != NULL);
+
+    /* Walk the tree directly, calling the visitor through a cast function pointer is undefined */
+    iterator = btree_iterator_new(map->tree);
+    while (btree_iterator_has_next(iterator)) {
+        visit(btree_iterator_next(iterator));
+    }
+    btree_iterator_delete(iterator);
+}
+
+/**
+ * @brief Clear a btree_map_t object.
+ * @param map The btree_map_t object.
+ * @return Returns the modified btree_map_t object.
+ */
+btree_map_t *btree_map_clear(btree_map_t *map) {
+    return_value_if_fail(map != NULL, NULL);
+    btree_clear(map->tree);
+    return map;
+}
+
+/**
+ * @brief Check if a btree_map_t object contains the specified key.
+ * @param map The btree_map_t object.
+ * @param key The key.
+ * @return Returns true if the btree_map_t object contains the specified key, otherwise returns false.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+bool btree_map_contains(const btree_map_t *map, T key) {
+    return_value_if_fail(map != NULL && key != NULL, false);
+    return btree_contains(map->tree, key);
+}
+
+/**
+ * @brief Put a key-value pair into a btree_map_t object.
+ * @param map The btree_map_t object.
+ * @param pair The pair_t object.
+ * @return Returns the modified btree_map_t object.
+ */
+btree_map_t *btree_map_put(btree_map_t *map, pair_t *pair) {
+    return_value_if_fail(map != NULL && pair != NULL, map);
+    btree_put(map->tree, pair);
+    return map;
+}
+
+/**
+ * @brief Remove a key-value pair from a btree_map_t object by given key.
+ * @param map The btree_map_t object.
+ * @param key The key.
+ * @return Returns the modified btree_map_t object.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+btree_map_t *btree_map_remove(btree_map_t *map, T key) {
+    return_value_if_fail(map != NULL && key != NULL, map);
+    btree_remove(map->tree, key);
+    return map;
+}
+
+/**
+ * @brief Get the value of a key-value pair by given key.
+ * @param map The btree_map_t object.
+ * @param key The key.
+ * @return Returns the value of the key-value pair if found, otherwise NULL.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+T btree_map_get(const btree_map_t *map, T key) {
+    pair_t *pair = NULL;
+
+    return_value_if_fail(map != NULL && key != NULL, NULL);
+
+    pair = (pair_t *)btree_find(map->tree, key);
+    return pair == NULL ? NULL : pair_get_value(pair);
+}
+
+/**
+ * @brief Get the key-value pair with the greatest key less than or equal to the given key.
+ * @param map The btree_map_t object.
+ * @param key The key.
+ * @return Returns the pair_t object if found, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable). The returned pair is owned by the map.
+ */
+pair_t *btree_map_floor(const btree_map_t *map, T key) {
+    return_value_if_fail(map != NULL && key != NULL, NULL);
+    return (pair_t *)btree_floor(map->tree, key);
+}
+
+/**
+ * @brief Get the key-value pair with the least key greater than or equal to the given key.
+ * @param map The btree_map_t object.
+ * @param key The key.
+ * @return Returns the pair_t object if found, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable). The returned pair is owned by the map.
+ */
+pair_t *btree_map_ceiling(const btree_map_t *map, T key) {
+    return_value_if_fail(map != NULL && key != NULL, NULL);
+    return (pair_t *)btree_ceiling(map->tree, key);
+}
+
+/**
+ * @brief Get the key-value pair with the greatest key strictly less than the given key.
+ * @param map The btree_map_t object.
+ * @param key The key.
+ * @return Returns the pair_t object if found, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable). The returned pair is owned by the map.
+ */
+pair_t *btree_map_lower(const btree_map_t *map, T key) {
+    return_value_if_fail(map != NULL && key != NULL, NULL);
+    return (pair_t *)btree_lower(map->tree, key);
+}
+
+/**
+ * @brief Get the key-value pair with the least key strictly greater than the given key.
+ * @param map The btree_map_t object.
+ * @param key The key.
+ * @return Returns the pair_t object if found, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable). The returned pair is owned by the map.
+ */
+pair_t *btree_map_higher(const btree_map_t *map, T key) {
+    return_value_if_fail(map != NULL && key != NULL, NULL);
+    return (pair_t *)btree_higher(map->tree, key);
+}
+
+/**
+ * @brief Get the key-value pair with the least key.
+ * @param map The btree_map_t object.
+ * @return Returns the pair_t object if the map is not empty, otherwise returns NULL.
+ * @note The returned pair is owned by the map.
+ */
+pair_t *btree_map_first(const btree_map_t *map) {
+    return_value_if_fail(map != NULL, NULL);
+    return (pair_t *)btree_min(map->tree);
+}
+
+/**
+ * @brief Get the key-value pair with the greatest key.
+ * @param map The btree_map_t object.
+ * @return Returns the pair_t object if the map is not empty, otherwise returns NULL.
+ * @note The returned pair is owned by the map.
+ */
+pair_t *btree_map_last(const btree_map_t *map) {
+    return_value_if_fail(map != NULL, NULL);
+    return (pair_t *)btree_max(map->tree);
+}
+
+/**
+ * @brief Get the key-value pair whose key has the specified rank in O(log n).
+ * @param map The btree_map_t object.
+ * @param index The 0-based rank, i.e. the number of smaller keys.
+ * @return Returns the pair_t object if the index is valid, otherwise returns NULL.
+ * @note The returned pair is owned by the map.
+ */
+pair_t *btree_map_select(const btree_map_t *map, size_t index) {
+    return_value_if_fail(map != NULL, NULL);
+    return (pair_t *)btree_select(map->tree, index);
+}
+
+/**
+ * @brief Count the keys in the btree_map_t object which are less than the given key in O(log n).
+ * @param map The btree_map_t object.
+ * @param key The key, which does not need to be in the map.
+ * @return Returns the rank of the key.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+size_t btree_map_rank(const btree_map_t *map, T key) {
+    return_value_if_fail(map != NULL && key != NULL, 0);
+    return btree_rank(map->tree, key);
+}
+
+/**
+ * @brief Create an iterator for a btree_map_t object.
+ * @param map The btree_map_t object.
+ * @return Returns the iterator for container.
+ */
+iterator_t *btree_map_iterator_new(const btree_map_t *map) {
+    return_value_if_fail(map != NULL, NULL);
+    return btree_iterator_new(map->tree);
+}
+
+/**
+ * @brief Create an iterator over the pairs whose keys are in [lo, hi) of a btree_map_t object in ascending order.
+ * @param map The btree_map_t object.
+ * @param lo The inclusive lower bound, or NULL for no lower bound.
+ * @param hi The exclusive upper bound, or NULL for no upper bound.
+ * @return Returns the iterator for container.
+ * @note Caller MUST free the parameters `lo` and `hi` (if applicable).
+ */
+iterator_t *btree_map_iterator_range(const btree_map_t *map, T lo, T hi) {
+    return_value_if_fail(map != NULL, NULL);
+    return btree_iterator_range(map->tree, lo, hi);
+}
+
+/**
+ * @brief Create an iterator for a btree_map_t object in descending order of keys.
+ * @param map The btree_map_t object.
+ * @return Returns the iterator for container.
+ */
+iterator_t *btree_map_iterator_reverse(const btree_map_t *map) {
+    return_value_if_fail(map != NULL, NULL);
+    return btree_iterator_reverse(map->tree);
+}
+
+/**
+ * @brief Destroy an iterator.
+ * @param iterator The iterator_t object.
+ */
+void btree_map_iterator_delete(iterator_t *iterator) {
+    return_if_fail(iterator != NULL);
+    btree_iterator_delete(iterator);
+}
+
+/**
+ * @brief Determine whether an iterator has the next element.
+ * @param iterator The iterator_t object.
+ * @return Returns true if the iterator has the next element, otherwise returns false.
+ */
+bool btree_map_iterator_has_next(const iterator_t *iterator) {
+    return_value_if_fail(iterator != NULL, false);
+    return btree_iterator_has_next(iterator);
+}
+
+/**
+ * @brief Get the next pair of an iterator.
+ * @param iterator The iterator_t object.
+ * @return Returns the next pair of the iterator.
+ */
+T btree_map_iterator_next(iterator_t *iterator) {
+    return_value_if_fail(iterator != NULL, NULL);
+    return btree_iterator_next(iterator);
+}
@@ -0,0 +1,451 @@
+#include "cstl/btree_set.h"
+#include "cstl/btree.h"
+
+struct btree_set_t {
+    btree_t *tree;
+    compare_t compare;
+};
+
+/**
+ * @brief Wrap a btree_t object into a btree_set_t object.
+ * @param tree The btree_t object, or NULL if its creation failed.
+ * @param compare Callback function for comparing two data items.
+ * @return Returns the created btree_set_t object if successful, otherwise returns NULL.
+ */
+static btree_set_t *__btree_set_new(btree_t *tree, compare_t compare) {
+    btree_set_t *set = NULL;
+
+    return_value_if_fail(tree != NULL, NULL);
+
+    set = (btree_set_t *)malloc(sizeof(btree_set_t));
+    if (set == NULL) {
+        btree_delete(tree);
+        return NULL;
+    }
+
+    set->tree = tree;
+    set->compare = compare;
+    return set;
+}
+
+/**
+ * @brief Create a btree_set_t object.
+ * @param compare Callback function for comparing two data items.
+ * @param destroy Callback function for destroying a data item.
+ * @return Returns the created btree_set_t object if successful, otherwise returns NULL.
+ */
+btree_set_t *btree_set_new(compare_t compare, destroy_t destroy) {
+    return_value_if_fail(compare != NULL, NULL);
+    return __btree_set_new(btree_new(compare, destroy), compare);
+}
+
+/**
+ * @brief Destroy a btree_set_t object.
+ * @param set The btree_set_t object.
+ */
+void btree_set_delete(btree_set_t *set) {
+    return_if_fail(set != NULL);
+    btree_delete(set->tree);
+    free(set);
+}
+
+/**
+ * @brief Determine whether a btree_set_t object is empty.
+ * @param set The btree_set_t object.
+ * @return Returns true if the btree_set_t object is empty, otherwise returns false.
+ */
+bool btree_set_is_empty(const btree_set_t *set) {
+    return_value_if_fail(set != NULL, true);
+    return btree_is_empty(set->tree);
+}
+
+/**
+ * @brief Get the size of a btree_set_t object.
+ * @param set The btree_set_t object.
+ * @return Returns the size of the btree_set_t object.
+ */
+size_t btree_set_size(const btree_set_t *set) {
+    return_value_if_fail(set != NULL, 0);
+    return btree_size(set->tree);
+}
+
+/**
+ * @brief Traverse a btree_set_t object.
+ * @param set The btree_set_t object.
+ * @param visit Callback function for visiting a data item.
+ */
+void btree_set_foreach(btree_set_t *set, visit_t visit) {
+    return_if_fail(set != NULL && visit != NULL);
+    btree_foreach(set->tree, visit);
+}
+
+/**
+ * @brief Clear a btree_set_t object.
+ * @param set The btree_set_t object.
+ * @return Returns the modified btree_set_t object.
+ */
+btree_set_t *btree_set_clear(btree_set_t *set) {
+    return_value_if_fail(set != NULL, NULL);
+    btree_clear(set->tree);
+    return set;
+}
+
+/**
+ * @brief Check if a btree_set_t object contains the specified element.
+ * @param set The btree_set_t object.
+ * @param elem The element.
+ * @return Returns true if the btree_set_t object contains the specified element, otherwise returns false.
+ * @note Caller MUST free the parameter `elem` (if applicable).
+ */
+bool btree_set_contains(const btree_set_t *set, T elem) {
+    return_value_if_fail(set != NULL && elem != NULL, false);
+    return btree_contains(set->tree, elem);
+}
+
+/**
+ * @brief Add an element to the btree_set_t object.
+ * @param set The btree_set_t object.
+ * @param elem The element.
+ * @return Returns the modified btree_set_t object.
+ */
+btree_set_t *btree_set_add(btree_set_t *set, T elem) {
+    return_value_if_fail(set != NULL && elem != NULL, set);
+    btree_insert(set->tree, elem);
+    return set;
+}
+
+/**
+ * @brief Remove the element from the btree_set_t object.
+ * @param set The btree_set_t object.
+ * @param elem The element.
+ * @return Returns the modified btree_set_t object.
+ * @note Caller MUST free the parameter `elem` (if applicable).
+ */
+btree_set_t *btree_set_remove(btree_set_t *set, T elem) {
+    return_value_if_fail(set != NULL && elem != NULL, set);
+    btree_remove(set->tree, elem);
+    return set;
+}
+
+/**
+ * @brief Get the element with the specified rank in the btree_set_t object in O(log n).
+ * @param set The btree_set_t object.
+ * @param index The 0-based rank, i.e. the number of smaller elements.
+ * @return Returns the element if the index is valid, otherwise returns NULL.
+ */
+T btree_set_select(const btree_set_t *set, size_t index) {
+    return_value_if_fail(set != NULL, NULL);
+    return btree_select(set->tree, index);
+}
+
+/**
+ * @brief Count the elements in the btree_set_t object which are less than the given element in O(log n).
+ * @param set The btree_set_t object.
+ * @param elem The element, which does not need to be in the set.
+ * @return Returns the rank of the element.
+ * @note Caller MUST free the parameter `elem` (if applicable).
+ */
+size_t btree_set_rank(const btree_set_t *set, T elem) {
+    return_value_if_fail(set != NULL && elem != NULL, 0);
+    return btree_rank(set->tree, elem);
+}
+
+/**
+ * @brief Which elements of a merge of two btree_set_t objects end up in the result.
+ */
+typedef enum {
+    ONLY_FIRST = 1,
+    ONLY_SECOND = 2,
+    IN_BOTH = 4
+} merge_t;
+
+/**
+ * @brief Create an iterator for a btree_set_t object which may be NULL.
+ * @param set The btree_set_t object, or NULL for an empty set.
+ * @param iterator Output parameter for the iterator, or NULL for an empty set.
+ * @return Returns true if successful, otherwise returns false.
+ */
+static bool __iterator_new(const btree_set_t *set, iterator_t **iterator) {
+    *iterator = NULL;
+    return_value_if(set == NULL, true);
+    *iterator = btree_iterator_new(set->tree);
+    return *iterator != NULL;
+}
+
+/**
+ * @brief Get the next element of an iterator, or NULL once it is exhausted.
+ * @param iterator The iterator_t object, or NULL.
+ * @return Returns the next element if exists, otherwise returns NULL.
+ */
+static T __next(iterator_t *iterator) {
+    return_value_if_fail(btree_iterator_has_next(iterator), NULL);
+    return btree_iterator_next(iterator);
+}
+
+/**
+ * @brief Append an element to an array_t object.
+ * @param array The array_t object.
+ * @param elem The element.
+ * @return Returns true if the element was appended, otherwise returns false.
+ */
+static bool __append(array_t *array, T elem) {
+    size_t size = array_size(array);
+
+    array_append(array, elem);
+    return array_size(array) == size + 1;
+}
+
+/**
+ * @brief Merge two btree_set_t objects with two cursors over their in-order iterators.
+ *        The selected elements come out in ascending order, so the result is built in bulk.
+ *        The whole operation is O(m + n).
+ * @param set1 The first btree_set_t object, or NULL for an empty set.
+ * @param set2 The second btree_set_t object, or NULL for an empty set.
+ * @param keep A combination of merge_t flags selecting the elements to keep.
+ * @return Returns the result btree_set_t object, which shares elements with the inputs, or NULL if out of memory.
+ */
+static btree_set_t *__merge(const btree_set_t *set1, const btree_set_t *set2, int keep) {
+    btree_set_t *result = NULL;
+    compare_t compare = NULL;
+    array_t *elems = NULL;
+    iterator_t *iterator1 = NULL;
+    iterator_t *iterator2 = NULL;
+    T elem1 = NULL;
+    T elem2 = NULL;
+    bool appended = true;
+    int cmp;
+
+    compare = set1 != NULL ? set1->compare : set2->compare;
+    elems = array_new(NULL, NULL);
+    return_value_if_fail(elems != NULL, NULL);
+
+    if (!__iterator_new(set1, &iterator1) || !__iterator_new(set2, &iterator2)) {
+        btree_iterator_delete(iterator1);
+        array_delete(elems);
+        return NULL;
+    }
+
+    elem1 = __next(iterator1);
+    elem2 = __next(iterator2);
+    while (appended && (elem1 != NULL || elem2 != NULL)) {
+        if (elem1 == NULL) {
+            cmp = 1;
+        } else if (elem2 == NULL) {
+            cmp = -1;
+        } else {
+            cmp = compare(elem1, elem2);
+        }
+
+        if (cmp < 0) {
+            if (keep & ONLY_FIRST) {
+                appended = __append(elems, elem1);
+            }
+            elem1 = __next(iterator1);
+        } else if (cmp > 0) {
+            if (keep & ONLY_SECOND) {
+                appended = __append(elems, elem2);
+            }
+            elem2 = __next(iterator2);
+        } else {
+            if (keep & IN_BOTH) {
+                appended = __append(elems, elem1);
+            }
+            elem1 = __next(iterator1);
+            elem2 = __next(iterator2);
+        }
+    }
+    btree_iterator_delete(iterator1);
+    btree_iterator_delete(iterator2);
+
+    if (!appended) {
+        array_delete(elems);
+        return NULL;
+    }
+
+    result = __btree_set_new(btree_new_from_sorted(compare, NULL, NULL, elems), compare);
+    array_delete(elems);
+    return result;
+}
+
+/**
+ * @brief Get the union of two btree_set_t objects.
+ * @param set1 The first btree_set_t object.
+ * @param set2 The second btree_set_t object.
+ * @return Returns the union of two btree_set_t objects.
+ * @note Caller MUST destroy the returned union btree_set_t object.
+ */
+btree_set_t *btree_set_union(const btree_set_t *set1, const btree_set_t *set2) {
+    return_value_if(set1 == NULL && set2 == NULL, NULL);
+    return __merge(set1, set2, ONLY_FIRST | ONLY_SECOND | IN_BOTH);
+}
+
+/**
+ * @brief Get the intersection of two btree_set_t objects.
+ * @param set1 The first btree_set_t object.
+ * @param set2 The second btree_set_t object.
+ * @return Returns the intersection of two btree_set_t objects.
+ * @note Caller MUST destroy the returned intersection btree_set_t object.
+ */
+btree_set_t *btree_set_intersection(const btree_set_t *set1, const btree_set_t *set2) {
+    return_value_if(set1 == NULL && set2 == NULL, NULL);
+    return __merge(set1, set2, IN_BOTH);
+}
+
+/**
+ * @brief Get the difference of two btree_set_t objects.
+ *        A - B
+ * @param set1 The first btree_set_t object.
+ * @param set2 The second btree_set_t object.
+ * @return Returns the difference of two btree_set_t objects.
+ * @note Caller MUST destroy the returned difference btree_set_t object.
+ */
+btree_set_t *btree_set_difference(const btree_set_t *set1, const btree_set_t *set2) {
+    return_value_if_fail(set1 != NULL, NULL);
+    return __merge(set1, set2, ONLY_FIRST);
+}
+
+/**
+ * @brief Get the symmetric difference of two btree_set_t objects.
+ *        (A - B) U (B - A)
+ * @param set1 The first btree_set_t object.
+ * @param set2 The second btree_set_t object.
+ * @return Returns the symmetric difference of two btree_set_t objects.
+ * @note Caller MUST destroy the returned symmetric difference btree_set_t object.
+ */
+btree_set_t *btree_set_symmetric_difference(const btree_set_t *set1, const btree_set_t *set2) {
+    return_value_if(set1 == NULL && set2 == NULL, NULL);
+    return __merge(set1, set2, ONLY_FIRST | ONLY_SECOND);
+}
+
+/**
+ * @brief Determine if two btree_set_t objects are disjoint.
+ *        Two sets are disjoint if their intersection is empty.
+ * @param set1 The first btree_set_t object.
+ * @param set2 The second btree_set_t object.
+ * @return Returns true if two btree_set_t objects are disjoint, otherwise returns false,
+ *         including when the iterators cannot be allocated.
+ */
+bool btree_set_is_disjoint(const btree_set_t *set1, const btree_set_t *set2) {
+    iterator_t *iterator1 = NULL;
+    iterator_t *iterator2 = NULL;
+    T elem1 = NULL;
+    T elem2 = NULL;
+    bool is_disjoint = true;
+    int cmp;
+
+    return_value_if_fail(set1 != NULL && set2 != NULL, true);
+
+    if (!__iterator_new(set1, &iterator1) || !__iterator_new(set2, &iterator2)) {
+        btree_iterator_delete(iterator1);
+        return false;
+    }
+    elem1 = __next(iterator1);
+    elem2 = __next(iterator2);
+    while (elem1 != NULL && elem2 != NULL) {
+        cmp = set1->compare(elem1, elem2);
+        if (cmp < 0) {
+            elem1 = __next(iterator1);
+        } else if (cmp > 0) {
+            elem2 = __next(iterator2);
+        } else {
+            is_disjoint = false;
+            break;
+        }
+    }
+    btree_iterator_delete(iterator1);
+    btree_iterator_delete(iterator2);
+
+    return is_disjoint;
+}
+
+/**
+ * @brief Determine if set1 is a subset of set2.
+ *        A is a subset B if every element of A is also an element of B.
+ * @param set1 The first btree_set_t object.
+ * @param set2 The second btree_set_t object.
+ * @return Returns true if set1 is a subset of set2, otherwise returns false,
+ *         including when the iterator cannot be allocated.
+ */
+bool btree_set_is_subset(const btree_set_t *set1, const btree_set_t *set2) {
+    iterator_t *iterator = NULL;
+    T elem = NULL;
+    bool is_subset = true;
+
+    return_value_if(set1 == NULL, true);
+    return_value_if(set2 == NULL, false);
+
+    return_value_if_fail(__iterator_new(set1, &iterator), false);
+    while (btree_iterator_has_next(iterator)) {
+        elem = btree_iterator_next(iterator);
+        if (!btree_set_contains(set2, elem)) {
+            is_subset = false;
+            break;
+        }
+    }
+    btree_iterator_delete(iterator);
+    
+    return is_subset;
+}
+
+/**
+ * @brief Create an iterator for a btree_set_t object.
+ * @param set The btree_set_t object.
+ * @return Returns the iterator for container.
+ */
+iterator_t *btree_set_iterator_new(const btree_set_t *set) {
+    return_value_if_fail(set != NULL, NULL);
+    return btree_iterator_new(set->tree);
+}
+
+/**
+ * @brief Create an iterator over the elements in [lo, hi) of a btree_set_t object in ascending order.
+ * @param set The btree_set_t object.
+ * @param lo The inclusive lower bound, or NULL for no lower bound.
+ * @param hi The exclusive upper bound, or NULL for no upper bound.
+ * @return Returns the iterator for container.
+ * @note Caller MUST free the parameters `lo` and `hi` (if applicable).
+ */
+iterator_t *btree_set_iterator_range(const btree_set_t *set, T lo, T hi) {
+    return_value_if_fail(set != NULL, NULL);
+    return btree_iterator_range(set->tree, lo, hi);
+}
+
+/**
+ * @brief Create an iterator for a btree_set_t object in descending order.
+ * @param set The btree_set_t object.
+ * @return Returns the iterator for container.
+ */
+iterator_t *btree_set_iterator_reverse(const btree_set_t *set) {
+    return_value_if_fail(set != NULL, NULL);
+    return btree_iterator_reverse(set->tree);
+}
+
+/**
+ * @brief Destroy an iterator.
+ * @param iterator The iterator_t object.
+ */
+void btree_set_iterator_delete(iterator_t *iterator) {
+    return_if_fail(iterator != NULL);
+    btree_iterator_delete(iterator);
+}
+
+/**
+ * @brief Determine whether an iterator has the next element.
+ * @param iterator The iterator_t object.
+ * @return Returns true if the iterator has the next element, otherwise returns false.
+ */
+bool btree_set_iterator_has_next(const iterator_t *iterator) {
+    return_value_if_fail(iterator != NULL, false);
+    return btree_iterator_has_next(iterator);
+}
+
+/**
+ * @brief Get the next element of an iterator.
+ * @param iterator The iterator_t object.
+ * @return Returns the next element of the iterator.
+ */
+T btree_set_iterator_next(iterator_t *iterator) {
+    return_value_if_fail(iterator != NULL, NULL);
+    return_value_if_fail(btree_set_iterator_has_next(iterator), NULL);
+    return btree_iterator_next(iterator);
+}
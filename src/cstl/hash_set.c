@@ -1,5 +1,6 @@
 #include "cstl/hash_set.h"
 #include "cstl/hash_table.h"
+#include "utils/numeric.h"
 
 struct hash_set_t {
     hash_table_t *hash_table;
@@ -65,27 +66,21 @@ size_t hash_set_size(const hash_set_t *set) {
     return hash_table_size(set->hash_table);
 }
 
-static visit_t __visit = NULL;
-
-/**
- * @brief Pirvate function for visiting a pair_t object.
- * @param pair The pair_t object.
- */
-static void __visit_pair(T pair) {
-    return_if_fail(pair != NULL);
-    pair = (pair_t *)pair;
-    __visit(pair_get_key(pair));
-}
-
 /**
  * @brief Traverse a hash_set_t object.
  * @param set The hash_set_t object.
  * @param visit Callback function for visiting a data item.
  */
 void hash_set_foreach(hash_set_t *set, visit_t visit) {
-    return_if_fail(set != NULL);
-    __visit = visit;
-    hash_table_foreach(set->hash_table, __visit_pair);
+    iterator_t *iterator = NULL;
+
+    return_if_fail(set != NULL && visit != NULL);
+
+    iterator = hash_table_iterator_new(set->hash_table);
+    while (hash_table_iterator_has_next(iterator)) {
+        visit(pair_get_key(hash_table_iterator_next(iterator)));
+    }
+    hash_table_iterator_delete(iterator);
 }
 
 /**
@@ -138,6 +133,47 @@ hash_set_t *hash_set_remove(hash_set_t *set, T elem) {
     return set;
 }
 
+/**
+ * @brief Create an empty hash_set_t object sharing the callbacks of another one.
+ *        The created set does not own its elements and has room for `n` elements.
+ * @param set The hash_set_t object to take the callbacks from.
+ * @param n The number of elements to reserve.
+ * @return Returns the created hash_set_t object if successful, otherwise returns NULL.
+ */
+static hash_set_t *__hash_set_new_like(const hash_set_t *set, size_t n) {
+    hash_set_t *new_set = NULL;
+
+    new_set = hash_set_new(set->compare, NULL, set->hash);
+    return_value_if_fail(new_set != NULL, NULL);
+
+    if (hash_table_reserve(new_set->hash_table, n) == NULL) {
+        hash_set_delete(new_set);
+        return NULL;
+    }
+    return new_set;
+}
+
+/**
+ * @brief Add to `dest` every element of `src` whose membership in `probe` equals `member`.
+ * @param dest The hash_set_t object to add to.
+ * @param src The hash_set_t object to iterate.
+ * @param probe The hash_set_t object to probe, or NULL for none.
+ * @param member Whether an element must be in `probe` to be added.
+ */
+static void __hash_set_add_if(hash_set_t *dest, const hash_set_t *src, const hash_set_t *probe, bool member) {
+    iterator_t *iterator = NULL;
+    T key;
+
+    iterator = hash_table_iterator_new(src->hash_table);
+    while (hash_table_iterator_has_next(iterator)) {
+        key = pair_get_key(hash_table_iterator_next(iterator));
+        if (hash_set_contains(probe, key) == member) {
+            hash_set_add(dest, key);
+        }
+    }
+    hash_table_iterator_delete(iterator);
+}
+
 /**
  * @brief Get the union of two hash_set_t objects.
  * @param set1 The first hash_set_t object.
@@ -147,41 +183,21 @@ hash_set_t *hash_set_remove(hash_set_t *set, T elem) {
  */
 hash_set_t *hash_set_union(const hash_set_t *set1, const hash_set_t *set2) {
     hash_set_t *union_set = NULL;
-    iterator_t *iterator = NULL;
-    pair_t *pair;
-    T key;
 
     return_value_if(set1 == NULL && set2 == NULL, NULL);
 
-    if (set1 != NULL) {
-        union_set = hash_set_new(set1->compare, NULL, set1->hash);
-    } else {
-        union_set = hash_set_new(set2->compare, NULL, set2->hash);
+    /* Copy the larger set, then add what the smaller one has on top */
+    if (set1 == NULL || hash_set_size(set1) < hash_set_size(set2)) {
+        swap(set1, set2, const hash_set_t *);
     }
-    return_value_if_fail(union_set != NULL, NULL);
 
-    if (set1 != NULL) {
-        iterator = hash_table_iterator_new(set1->hash_table);
-        while (hash_table_iterator_has_next(iterator)) {
-            pair = hash_table_iterator_next(iterator);
-            key = pair_get_key(pair);
-            hash_set_add(union_set, key);
-        }
-        hash_table_iterator_delete(iterator);
-    }
+    union_set = __hash_set_new_like(set1, hash_set_size(set1) + hash_set_size(set2));
+    return_value_if_fail(union_set != NULL, NULL);
 
+    __hash_set_add_if(union_set, set1, NULL, false);
     if (set2 != NULL) {
-        iterator = hash_table_iterator_new(set2->hash_table);
-        while (hash_table_iterator_has_next(iterator)) {
-            pair = hash_table_iterator_next(iterator);
-            key = pair_get_key(pair);
-            if (!hash_set_contains(union_set, key)) {
-                hash_set_add(union_set, key);
-            }
-        }
-        hash_table_iterator_delete(iterator);
+        __hash_set_add_if(union_set, set2, set1, false);
     }
-
     return union_set;
 }
 
@@ -194,31 +210,20 @@ hash_set_t *hash_set_union(const hash_set_t *set1, const hash_set_t *set2) {
  */
 hash_set_t *hash_set_intersection(const hash_set_t *set1, const hash_set_t *set2) {
     hash_set_t *intersection_set = NULL;
-    iterator_t *iterator = NULL;
-    pair_t *pair;
-    T key;
 
     return_value_if(set1 == NULL && set2 == NULL, NULL);
 
-    if (set1 == NULL) {
-        intersection_set = hash_set_new(set2->compare, NULL, set2->hash);
-    } else {
-        intersection_set = hash_set_new(set1->compare, NULL, set1->hash);
+    /* Iterate the smaller set and probe the larger one */
+    if (set1 == NULL || (set2 != NULL && hash_set_size(set2) < hash_set_size(set1))) {
+        swap(set1, set2, const hash_set_t *);
     }
-    return_value_if_fail(intersection_set != NULL, NULL);
 
-    return_value_if(set1 == NULL || set2 == NULL, intersection_set);
+    intersection_set = __hash_set_new_like(set1, hash_set_size(set1));
+    return_value_if_fail(intersection_set != NULL, NULL);
 
-    iterator = hash_table_iterator_new(set1->hash_table);
-    while (hash_table_iterator_has_next(iterator)) {
-        pair = hash_table_iterator_next(iterator);
-        key = pair_get_key(pair);
-        if (hash_set_contains(set2, key)) {
-            hash_set_add(intersection_set, key);
-        }
+    if (set2 != NULL) {
+        __hash_set_add_if(intersection_set, set1, set2, true);
     }
-    hash_table_iterator_delete(iterator);
-
     return intersection_set;
 }
 
@@ -232,25 +237,13 @@ hash_set_t *hash_set_intersection(const hash_set_t *set1, const hash_set_t *set2
  */
 hash_set_t *hash_set_difference(const hash_set_t *set1, const hash_set_t *set2) {
     hash_set_t *difference_set = NULL;
-    iterator_t *iterator = NULL;
-    pair_t *pair;
-    T key;
 
     return_value_if_fail(set1 != NULL, NULL);
 
-    difference_set = hash_set_new(set1->compare, NULL, set1->hash);
+    difference_set = __hash_set_new_like(set1, hash_set_size(set1));
     return_value_if_fail(difference_set != NULL, NULL);
 
-    iterator = hash_table_iterator_new(set1->hash_table);
-    while (hash_table_iterator_has_next(iterator)) {
-        pair = hash_table_iterator_next(iterator);
-        key = pair_get_key(pair);
-        if (!hash_set_contains(set2, key)) {
-            hash_set_add(difference_set, key);
-        }
-    }
-    hash_table_iterator_delete(iterator);
-
+    __hash_set_add_if(difference_set, set1, set2, false);
     return difference_set;
 }
 
@@ -263,18 +256,21 @@ hash_set_t *hash_set_difference(const hash_set_t *set1, const hash_set_t *set2)
  * @note Caller MUST destroy the returned symmetric difference hash_set_t object.
  */
 hash_set_t *hash_set_symmetric_difference(const hash_set_t *set1, const hash_set_t *set2) {
-    hash_set_t *union_set = NULL;
-    hash_set_t *intersection_set = NULL;
     hash_set_t *symmetric_difference_set = NULL;
 
     return_value_if(set1 == NULL && set2 == NULL, NULL);
 
-    union_set = hash_set_union(set1, set2);
-    intersection_set = hash_set_intersection(set1, set2);
-    symmetric_difference_set = hash_set_difference(union_set, intersection_set);
+    if (set1 == NULL) {
+        swap(set1, set2, const hash_set_t *);
+    }
 
-    hash_set_delete(union_set);
-    hash_set_delete(intersection_set);
+    symmetric_difference_set = __hash_set_new_like(set1, hash_set_size(set1) + hash_set_size(set2));
+    return_value_if_fail(symmetric_difference_set != NULL, NULL);
+
+    __hash_set_add_if(symmetric_difference_set, set1, set2, false);
+    if (set2 != NULL) {
+        __hash_set_add_if(symmetric_difference_set, set2, set1, false);
+    }
     return symmetric_difference_set;
 }
 
@@ -286,14 +282,25 @@ hash_set_t *hash_set_symmetric_difference(const hash_set_t *set1, const hash_set
  * @return Returns true if two hash_set_t objects are disjoint, otherwise returns false.
  */
 bool hash_set_is_disjoint(const hash_set_t *set1, const hash_set_t *set2) {
-    hash_set_t *intersection_set = NULL;
-    bool is_disjoint = false;
+    iterator_t *iterator = NULL;
+    bool is_disjoint = true;
 
     return_value_if_fail(set1 != NULL && set2 != NULL, true);
 
-    intersection_set = hash_set_intersection(set1, set2);
-    is_disjoint = hash_set_is_empty(intersection_set);
-    hash_set_delete(intersection_set);
+    /* Iterate the smaller set and probe the larger one */
+    if (hash_set_size(set2) < hash_set_size(set1)) {
+        swap(set1, set2, const hash_set_t *);
+    }
+
+    iterator = hash_table_iterator_new(set1->hash_table);
+    while (hash_table_iterator_has_next(iterator)) {
+        if (hash_set_contains(set2, pair_get_key(hash_table_iterator_next(iterator)))) {
+            is_disjoint = false;
+            break;
+        }
+    }
+    hash_table_iterator_delete(iterator);
+
     return is_disjoint;
 }
 
@@ -306,18 +313,15 @@ bool hash_set_is_disjoint(const hash_set_t *set1, const hash_set_t *set2) {
  */
 bool hash_set_is_subset(const hash_set_t *set1, const hash_set_t *set2) {
     iterator_t *iterator = NULL;
-    pair_t *pair;
-    T key;
     bool is_subset = true;
 
     return_value_if(set1 == NULL, true);
     return_value_if(set2 == NULL, false);
+    return_value_if(hash_set_size(set1) > hash_set_size(set2), false);
 
     iterator = hash_table_iterator_new(set1->hash_table);
     while (hash_table_iterator_has_next(iterator)) {
-        pair = hash_table_iterator_next(iterator);
-        key = pair_get_key(pair);
-        if (!hash_set_contains(set2, key)) {
+        if (!hash_set_contains(set2, pair_get_key(hash_table_iterator_next(iterator)))) {
             is_subset = false;
             break;
         }
@@ -327,6 +331,87 @@ bool hash_set_is_subset(const hash_set_t *set1, const hash_set_t *set2) {
     return is_subset;
 }
 
+/**
+ * @brief Add every element of another hash_set_t object to a hash_set_t object.
+ * @param set The hash_set_t object to modify.
+ * @param other The other hash_set_t object.
+ * @return Returns the modified hash_set_t object, or NULL if both sets destroy their elements
+ *         or the memory allocation fails. `set` is left unchanged in that case.
+ * @note The added elements are shared with `other`, so at most one of the two sets may destroy them.
+ */
+hash_set_t *hash_set_union_into(hash_set_t *set, const hash_set_t *other) {
+    return_value_if_fail(set != NULL, NULL);
+    return_value_if(other == NULL || other == set, set);
+    /* Both sets would own the shared elements and destroy them twice */
+    return_value_if_fail(set->destroy == NULL || other->destroy == NULL, NULL);
+
+    return_value_if_fail(hash_table_reserve(set->hash_table, hash_set_size(set) + hash_set_size(other)) != NULL, NULL);
+    __hash_set_add_if(set, other, set, false);
+    return set;
+}
+
+/**
+ * @brief Remove from a hash_set_t object every element that is not in another one.
+ * @param set The hash_set_t object to modify.
+ * @param other The other hash_set_t object.
+ * @return Returns the modified hash_set_t object.
+ */
+hash_set_t *hash_set_retain_all(hash_set_t *set, const hash_set_t *other) {
+    iterator_t *iterator = NULL;
+    pair_t *pair;
+
+    return_value_if_fail(set != NULL, NULL);
+    return_value_if(other == set, set);
+
+    iterator = hash_table_iterator_new(set->hash_table);
+    while (hash_table_iterator_has_next(iterator)) {
+        pair = hash_table_iterator_next(iterator);
+        if (!hash_set_contains(other, pair_get_key(pair))) {
+            pair_delete(hash_table_iterator_remove(iterator));
+        }
+    }
+    hash_table_iterator_delete(iterator);
+
+    return set;
+}
+
+/**
+ * @brief Remove from a hash_set_t object every element that is in another one.
+ * @param set The hash_set_t object to modify.
+ * @param other The other hash_set_t object.
+ * @return Returns the modified hash_set_t object.
+ */
+hash_set_t *hash_set_remove_all(hash_set_t *set, const hash_set_t *other) {
+    iterator_t *iterator = NULL;
+    pair_t *pair;
+
+    return_value_if_fail(set != NULL, NULL);
+    return_value_if(other == NULL, set);
+
+    if (other == set) {
+        return hash_set_clear(set);
+    }
+
+    /* Remove by key when `other` is smaller, otherwise filter `set` in place */
+    if (hash_set_size(other) < hash_set_size(set)) {
+        iterator = hash_table_iterator_new(other->hash_table);
+        while (hash_table_iterator_has_next(iterator)) {
+            hash_table_remove(set->hash_table, pair_get_key(hash_table_iterator_next(iterator)));
+        }
+    } else {
+        iterator = hash_table_iterator_new(set->hash_table);
+        while (hash_table_iterator_has_next(iterator)) {
+            pair = hash_table_iterator_next(iterator);
+            if (hash_set_contains(other, pair_get_key(pair))) {
+                pair_delete(hash_table_iterator_remove(iterator));
+            }
+        }
+    }
+    hash_table_iterator_delete(iterator);
+
+    return set;
+}
+
 /**
  * @brief Create an iterator for a hash_set_t object.
  * @param set The hash_set_t object.
@@ -7,6 +7,7 @@
 
 struct hash_table_t {
     list_t **buckets;
+    pool_t *pool;
     size_t size;
     size_t capacity;
     compare_t compare;
@@ -59,19 +60,28 @@ hash_table_t *hash_table_new(compare_t compare, hash_t hash) {
     hash_table = (hash_table_t *)malloc(sizeof(hash_table_t));
     return_value_if_fail(hash_table != NULL, NULL);
 
+    /* All buckets share one node pool */
+    hash_table->pool = list_pool_new();
+    if (hash_table->pool == NULL) {
+        free(hash_table);
+        return NULL;
+    }
+
     hash_table->buckets = (list_t **)malloc(sizeof(list_t *) * DEFAULT_CAPACITY);
     if (hash_table->buckets == NULL) {
+        pool_delete(hash_table->pool);
         free(hash_table);
         return NULL;
     }
 
     for (i = 0; i < DEFAULT_CAPACITY; i++) {
-        hash_table->buckets[i] = list_new(NULL, __pair_delete);
+        hash_table->buckets[i] = list_new_with_pool(NULL, __pair_delete, hash_table->pool);
         if (hash_table->buckets[i] == NULL) {
             for (j = 0; j < i; j++) {
                 list_delete(hash_table->buckets[j]);
             }
             free(hash_table->buckets);
+            pool_delete(hash_table->pool);
             free(hash_table);
             return NULL;
         }
@@ -99,6 +109,7 @@ void hash_table_delete(hash_table_t *hash_table) {
     }
 
     free(hash_table->buckets);
+    pool_delete(hash_table->pool);
     free(hash_table);
 }
 
@@ -175,16 +186,14 @@ bool hash_table_contains(const hash_table_t *hash_table, T key) {
 }
 
 /**
- * @brief Resize a hash_table_t object.
- *        Double the hash_table_t object if the load factor is greater than 0.75.
+ * @brief Resize a hash_table_t object to the given number of buckets.
  * @param hash_table The hash_table_t object.
+ * @param new_capacity The new number of buckets.
  * @return Returns true if memory reallocation is successful, otherwise returns false.
  */
-static bool __hash_table_resize(hash_table_t *hash_table) {
+static bool __hash_table_resize(hash_table_t *hash_table, size_t new_capacity) {
     size_t old_capacity;
-    size_t new_capacity;
     list_t **new_buckets = NULL;
-    iterator_t *iterator = NULL;
     pair_t *pair;
     size_t i = 0;
     size_t j = 0;
@@ -192,12 +201,11 @@ static bool __hash_table_resize(hash_table_t *hash_table) {
 
     return_value_if_fail(hash_table != NULL, false);
 
-    new_capacity = hash_table->capacity * GROWTH_FACTOR;
     new_buckets = (list_t **)malloc(sizeof(list_t *) * new_capacity);
     return_value_if_fail(new_buckets != NULL, false);
 
     for (i = 0; i < new_capacity; i++) {
-        new_buckets[i] = list_new(NULL, __pair_delete);
+        new_buckets[i] = list_new_with_pool(NULL, __pair_delete, hash_table->pool);
         if (new_buckets[i] == NULL) {
             for (j = 0; j < i; j++) {
                 list_delete(new_buckets[j]);
@@ -210,29 +218,13 @@ static bool __hash_table_resize(hash_table_t *hash_table) {
     old_capacity = hash_table->capacity;
     hash_table->capacity = new_capacity;
 
-    /* Rehash */
+    /* Rehash, popping first so that each freed node is reused by the push */
     for (i = 0; i < old_capacity; i++) {
-        iterator = list_iterator_new(hash_table->buckets[i]);
-        if (iterator == NULL) {
-            for (j = 0; j < new_capacity; j++) {
-                list_delete(new_buckets[j]);
-            }
-            free(new_buckets);
-            hash_table->capacity = old_capacity;
-            return false;
-        }
-
-        while (list_iterator_has_next(iterator)) {
-            pair = (pair_t *)list_iterator_next(iterator);
+        while (!list_is_empty(hash_table->buckets[i])) {
+            pair = (pair_t *)list_pop_front(hash_table->buckets[i]);
             new_index = __hash(hash_table, pair_get_key(pair));
             list_push_back(new_buckets[new_index], pair);
         }
-
-        while (!list_is_empty(hash_table->buckets[i])) {
-            list_pop_front(hash_table->buckets[i]);
-        }
-
-        list_iterator_delete(iterator);
         list_delete(hash_table->buckets[i]);
     }
 
@@ -241,6 +233,28 @@ static bool __hash_table_resize(hash_table_t *hash_table) {
     return true;
 }
 
+/**
+ * @brief Reserve buckets for at least `n` key-value pairs in a hash_table_t object.
+ *        Putting up to `n` pairs afterwards does not trigger any rehash.
+ * @param hash_table The hash_table_t object.
+ * @param n The number of key-value pairs.
+ * @return Returns the modified hash_table_t object, or NULL if the memory allocation fails.
+ */
+hash_table_t *hash_table_reserve(hash_table_t *hash_table, size_t n) {
+    size_t new_capacity = 0;
+
+    return_value_if_fail(hash_table != NULL, hash_table);
+
+    new_capacity = hash_table->capacity;
+    while ((float)n / new_capacity > LOAD_FACTOR_THRESHOLD) {
+        new_capacity *= GROWTH_FACTOR;
+    }
+    return_value_if(new_capacity == hash_table->capacity, hash_table);
+
+    return_value_if_fail(__hash_table_resize(hash_table, new_capacity), NULL);
+    return hash_table;
+}
+
 /**
  * @brief Put a key-value pair into a hash_table_t object.
  * @param hash_table The hash_table_t object.
@@ -252,28 +266,22 @@ hash_table_t *hash_table_put(hash_table_t *hash_table, pair_t *pair) {
     list_t *bucket = NULL;
     iterator_t *iterator = NULL;
     pair_t *current_pair = NULL;
-    pair_t *removed_pair = NULL;
-    size_t i = 0;
 
     return_value_if_fail(hash_table != NULL && pair != NULL, hash_table);
 
     index = __hash(hash_table, pair_get_key(pair));
     bucket = hash_table->buckets[index];
 
-    i = 0;
     iterator = list_iterator_new(bucket);
     while (list_iterator_has_next(iterator)) {
         current_pair = (pair_t *)list_iterator_next(iterator);
 
-        /* Key already exists */
+        /* Key already exists, replace the old pair in place */
         if (hash_table->compare(pair_get_key(pair), pair_get_key(current_pair)) == 0) {
-            removed_pair = (pair_t *)list_remove(bucket, i);
-            pair_delete(removed_pair);
-            list_push_back(bucket, pair);
+            list_iterator_set(iterator, pair);
             list_iterator_delete(iterator);
             return hash_table;
         }
-        i++;
     }
     list_iterator_delete(iterator);
 
@@ -281,8 +289,9 @@ hash_table_t *hash_table_put(hash_table_t *hash_table, pair_t *pair) {
     list_push_back(bucket, pair);
     hash_table->size++;
 
+    /* Double the buckets once the load factor exceeds the threshold */
     if ((float)hash_table->size / hash_table->capacity > LOAD_FACTOR_THRESHOLD) {
-        return_value_if_fail(__hash_table_resize(hash_table), hash_table);
+        return_value_if_fail(__hash_table_resize(hash_table, hash_table->capacity * GROWTH_FACTOR), hash_table);
     }
 
     return hash_table;
@@ -300,24 +309,21 @@ hash_table_t *hash_table_remove(hash_table_t *hash_table, T key) {
     list_t *bucket = NULL;
     iterator_t *iterator = NULL;
     pair_t *pair;
-    size_t i = 0;
 
     return_value_if_fail(hash_table != NULL && key != NULL, hash_table);
 
     index = __hash(hash_table, key);
     bucket = hash_table->buckets[index];
 
-    i = 0;
     iterator = list_iterator_new(bucket);
     while (list_iterator_has_next(iterator)) {
         pair = (pair_t *)list_iterator_next(iterator);
         if (hash_table->compare(pair_get_key(pair), key) == 0) {
-            pair = list_remove(bucket, i);
+            pair = list_iterator_remove(iterator);
             pair_delete(pair);
             hash_table->size--;
             break;
         }
-        i++;
     }
 
     list_iterator_delete(iterator);
@@ -473,3 +479,28 @@ pair_t *hash_table_iterator_next(iterator_t *iterator) {
 
     return NULL;
 }
+
+/**
+ * @brief Remove the pair last returned by the iterator.
+ *        The iteration continues with the pair following the removed one.
+ *        A second removal before the next `hash_table_iterator_next()` fails.
+ * @param iterator The iterator_t object.
+ * @return Returns the removed pair if successful, otherwise returns NULL.
+ * @note Caller MUST destroy the returned pair.
+ */
+pair_t *hash_table_iterator_remove(iterator_t *iterator) {
+    hash_table_iterator_state_t *state = NULL;
+    hash_table_t *hash_table = NULL;
+    pair_t *pair = NULL;
+
+    return_value_if_fail(iterator != NULL, NULL);
+    return_value_if_fail(iterator->current != NULL, NULL);
+
+    state = (hash_table_iterator_state_t *)iterator->current;
+    pair = (pair_t *)list_iterator_remove(state->list_iterator);
+    return_value_if_fail(pair != NULL, NULL);
+
+    hash_table = (hash_table_t *)iterator->container;
+    hash_table->size--;
+    return pair;
+}
@@ -1,10 +1,17 @@
 #include "cstl/heap.h"
-#include "cstl/array.h"
+
+#define DEFAULT_CAPACITY 16
+#define GROWTH_FACTOR 2
 
 struct heap_t {
+    T *data;
+    size_t size;
+    size_t capacity;
     heap_type_t heap_type;
-    array_t *array;
+    size_t shift;
+    int order;
     compare_t compare;
+    destroy_t destroy;
 };
 
 /**
@@ -15,22 +22,68 @@ struct heap_t {
  * @return Returns the created heap_t object if successful, otherwise returns NULL.
  */
 heap_t *heap_new(heap_type_t heap_type, compare_t compare, destroy_t destroy) {
+    return heap_new_with_arity(heap_type, compare, destroy, 2);
+}
+
+/**
+ * @brief Create a heap_t object in which every node has `arity` children.
+ *        The children of a node are adjacent in memory, so a wider heap is shallower and
+ *        touches fewer cache lines per sift at the cost of more comparisons per level.
+ * @param heap_type The type of the heap (MIN_HEAP/MAX_HEAP).
+ * @param compare Callback function for comparing two data items.
+ * @param destroy Callback function for destroying a data item.
+ * @param arity The number of children of every node (2, 4 or 8).
+ * @return Returns the created heap_t object if successful, otherwise returns NULL.
+ */
+heap_t *heap_new_with_arity(heap_type_t heap_type, compare_t compare, destroy_t destroy, size_t arity) {
     heap_t *heap = NULL;
 
     return_value_if_fail(heap_type == MIN_HEAP || heap_type == MAX_HEAP, NULL);
     return_value_if_fail(compare != NULL, NULL);
+    return_value_if_fail(arity == 2 || arity == 4 || arity == 8, NULL);
 
     heap = (heap_t *)malloc(sizeof(heap_t));
     return_value_if_fail(heap != NULL, NULL);
 
-    heap->array = array_new(compare, destroy);
-    if (heap->array == NULL) {
+    heap->data = (T *)malloc(sizeof(T) * DEFAULT_CAPACITY);
+    if (heap->data == NULL) {
         free(heap);
         return NULL;
     }
 
+    heap->size = 0;
+    heap->capacity = DEFAULT_CAPACITY;
     heap->heap_type = heap_type;
+    heap->shift = arity == 2 ? 1 : arity == 4 ? 2 : 3;
+    heap->order = heap_type == MIN_HEAP ? 1 : -1;
     heap->compare = compare;
+    heap->destroy = destroy;
+    return heap;
+}
+
+/**
+ * @brief Create a heap_t object from the elements of an array_t object in O(n).
+ * @param heap_type The type of the heap (MIN_HEAP/MAX_HEAP).
+ * @param compare Callback function for comparing two data items.
+ * @param destroy Callback function for destroying a data item.
+ * @param array The array_t object.
+ * @return Returns the created heap_t object if successful, otherwise returns NULL.
+ * @note The heap takes over the elements if successful. Caller MUST NOT destroy them through the array
+ *       afterwards (e.g. create the array with a NULL destroy callback).
+ */
+heap_t *heap_new_from_array(heap_type_t heap_type, compare_t compare, destroy_t destroy, const array_t *array) {
+    heap_t *heap = NULL;
+
+    return_value_if_fail(array != NULL, NULL);
+
+    heap = heap_new(heap_type, compare, destroy);
+    return_value_if_fail(heap != NULL, NULL);
+
+    /* The caller keeps the elements unless the heap took them over */
+    if (heap_push_many(heap, array) == NULL) {
+        heap_delete(heap);
+        return NULL;
+    }
     return heap;
 }
 
@@ -40,7 +93,8 @@ heap_t *heap_new(heap_type_t heap_type, compare_t compare, destroy_t destroy) {
  */
 void heap_delete(heap_t *heap) {
     return_if_fail(heap != NULL);
-    array_delete(heap->array);
+    heap_clear(heap);
+    free(heap->data);
     free(heap);
 }
 
@@ -51,7 +105,7 @@ void heap_delete(heap_t *heap) {
  */
 bool heap_is_empty(const heap_t *heap) {
     return_value_if_fail(heap != NULL, true);
-    return array_is_empty(heap->array);
+    return heap->size == 0;
 }
 
 /**
@@ -61,7 +115,7 @@ bool heap_is_empty(const heap_t *heap) {
  */
 size_t heap_size(const heap_t *heap) {
     return_value_if_fail(heap != NULL, 0);
-    return array_size(heap->array);
+    return heap->size;
 }
 
 /**
@@ -70,107 +124,149 @@ size_t heap_size(const heap_t *heap) {
  * @return Returns the modified heap_t object.
  */
 heap_t *heap_clear(heap_t *heap) {
+    T *data = NULL;
+    size_t i = 0;
+
     return_value_if_fail(heap != NULL, NULL);
-    array_clear(heap->array);
+
+    if (heap->destroy != NULL) {
+        for (i = 0; i < heap->size; i++) {
+            heap->destroy(heap->data[i]);
+        }
+    }
+    heap->size = 0;
+
+    data = (T *)realloc(heap->data, sizeof(T) * DEFAULT_CAPACITY);
+    if (data != NULL) {
+        heap->data = data;
+        heap->capacity = DEFAULT_CAPACITY;
+    }
     return heap;
 }
 
+/**
+ * @brief Determine whether an element belongs closer to the root than another one.
+ * @param compare Callback function for comparing two data items.
+ * @param order 1 for a MIN_HEAP, -1 for a MAX_HEAP.
+ * @param elem1 The first element.
+ * @param elem2 The second element.
+ * @return Returns true if `elem1` strictly precedes `elem2`, otherwise returns false.
+ */
+static bool __precedes(compare_t compare, int order, T elem1, T elem2) {
+    int cmp = compare(elem1, elem2);
+    return order * ((cmp > 0) - (cmp < 0)) < 0;
+}
+
 /**
  * @brief Heapify up.
+ *        The element at `index` is lifted out, parents move down into the hole, and it is written once at the end.
  * @param heap The heap_t object.
  * @param index The index.
- * @return Returns the modified heap_t object.
  */
-static heap_t *__heapify_up(heap_t *heap, size_t index) {
+static void __heapify_up(heap_t *heap, size_t index) {
+    T *data = heap->data;
+    T elem = data[index];
+    compare_t compare = heap->compare;
+    int order = heap->order;
+    size_t shift = heap->shift;
     size_t parent_index;
-    T current;
-    T parent;
-    int cmp;
-    bool should_swap = false;
-
-    return_value_if_fail(heap != NULL, NULL);
 
     while (index != 0) {
-        parent_index = (index - 1) / 2;
-        current = array_get(heap->array, index);
-        parent = array_get(heap->array, parent_index);
-
-        cmp = heap->compare(current, parent);
-        if (heap->heap_type == MIN_HEAP) {
-            should_swap = cmp < 0;
-        } else {
-            should_swap = cmp > 0;
-        }
-
-        if (should_swap) {
-            array_swap(heap->array, index, parent_index);
-            index = parent_index;
-        } else {
+        parent_index = (index - 1) >> shift;
+        if (!__precedes(compare, order, elem, data[parent_index])) {
             break;
         }
+        data[index] = data[parent_index];
+        index = parent_index;
     }
-
-    return heap;
+    data[index] = elem;
 }
 
 /**
  * @brief Heapify down.
+ *        The element at `index` is lifted out, the preceding child of each level moves up into the hole,
+ *        and it is written once at the end.
  * @param heap The heap_t object.
  * @param index The index.
- * @return Returns the modified heap_t object.
  */
-static heap_t *__heapify_down(heap_t *heap, size_t index) {
-    size_t left_child_index;
-    size_t right_child_index;
-    size_t chosen_index;
-    T current;
-    T left_child;
-    T right_child;
-
-    return_value_if_fail(heap != NULL, NULL);
-
-    while (true) {
-        left_child_index = index * 2 + 1;
-        right_child_index = index * 2 + 2;
-        chosen_index = index;
-
-        current = array_get(heap->array, index);
-        left_child = array_get(heap->array, left_child_index);
-        right_child = array_get(heap->array, right_child_index);
-
-        if (left_child_index < array_size(heap->array)) {
-            if (heap->heap_type == MIN_HEAP) {
-                if (heap->compare(left_child, current) < 0) {
-                    chosen_index = left_child_index;
-                }
-            } else {
-                if (heap->compare(left_child, current) > 0) {
-                    chosen_index = left_child_index;
-                }
-            }
+static void __heapify_down(heap_t *heap, size_t index) {
+    T *data = heap->data;
+    T elem = data[index];
+    compare_t compare = heap->compare;
+    int order = heap->order;
+    size_t shift = heap->shift;
+    size_t size = heap->size;
+    size_t child_index;
+    size_t last_index;
+    size_t i;
+
+    while ((child_index = (index << shift) + 1) < size) {
+        last_index = child_index + ((size_t)1 << shift);
+        if (last_index > size) {
+            last_index = size;
         }
-
-        if (right_child_index < array_size(heap->array)) {
-            if (heap->heap_type == MIN_HEAP) {
-                if (heap->compare(right_child, array_get(heap->array, chosen_index)) < 0) {
-                    chosen_index = right_child_index;
-                }
-            } else {
-                if (heap->compare(right_child, array_get(heap->array, chosen_index)) > 0) {
-                    chosen_index = right_child_index;
-                }
+        for (i = child_index + 1; i < last_index; i++) {
+            if (__precedes(compare, order, data[i], data[child_index])) {
+                child_index = i;
             }
         }
-
-        if (chosen_index == index) {
+        if (!__precedes(compare, order, data[child_index], elem)) {
             break;
         }
+        data[index] = data[child_index];
+        index = child_index;
+    }
+    data[index] = elem;
+}
+
+/**
+ * @brief Make room for at least `capacity` elements in a heap_t object.
+ * @param heap The heap_t object.
+ * @param capacity The number of elements.
+ * @return Returns true if memory reallocation is successful, otherwise returns false.
+ */
+static bool __heap_reserve(heap_t *heap, size_t capacity) {
+    size_t new_capacity = heap->capacity;
+    T *new_data = NULL;
 
-        array_swap(heap->array, index, chosen_index);
-        index = chosen_index;
+    return_value_if(capacity <= heap->capacity, true);
+
+    while (new_capacity < capacity) {
+        new_capacity *= GROWTH_FACTOR;
     }
 
-    return heap;
+    new_data = (T *)realloc(heap->data, sizeof(T) * new_capacity);
+    return_value_if_fail(new_data != NULL, false);
+
+    heap->data = new_data;
+    heap->capacity = new_capacity;
+    return true;
+}
+
+/**
+ * @brief Restore the heap property of the whole array bottom-up (Floyd's method) in O(n).
+ * @param heap The heap_t object.
+ */
+static void __heapify(heap_t *heap) {
+    size_t index = heap->size > 1 ? ((heap->size - 2) >> heap->shift) + 1 : 0;
+
+    while (index > 0) {
+        __heapify_down(heap, --index);
+    }
+}
+
+/**
+ * @brief Replace the root of a non-empty heap_t object, then sift the new root down.
+ * @param heap The heap_t object.
+ * @param elem The element.
+ * @return Returns the old root.
+ */
+static T __heap_replace_root(heap_t *heap, T elem) {
+    T root = heap->data[0];
+
+    heap->data[0] = elem;
+    __heapify_down(heap, 0);
+    return root;
 }
 
 /**
@@ -182,8 +278,10 @@ static heap_t *__heapify_down(heap_t *heap, size_t index) {
 heap_t *heap_push(heap_t *heap, T elem) {
     return_value_if_fail(heap != NULL, NULL);
     return_value_if_fail(elem != NULL, heap);
-    array_append(heap->array, elem);
-    __heapify_up(heap, array_size(heap->array) - 1);
+    return_value_if_fail(__heap_reserve(heap, heap->size + 1), heap);
+
+    heap->data[heap->size++] = elem;
+    __heapify_up(heap, heap->size - 1);
     return heap;
 }
 
@@ -198,10 +296,9 @@ T heap_pop(heap_t *heap) {
 
     return_value_if_fail(heap != NULL && !heap_is_empty(heap), NULL);
 
-    array_swap(heap->array, 0, array_size(heap->array) - 1);
-    root = array_remove(heap->array, array_size(heap->array) - 1);
-
-    if (!heap_is_empty(heap)) {
+    root = heap->data[0];
+    heap->data[0] = heap->data[--heap->size];
+    if (heap->size > 0) {
         __heapify_down(heap, 0);
     }
 
@@ -215,5 +312,92 @@ T heap_pop(heap_t *heap) {
  */
 T heap_peek(const heap_t *heap) {
     return_value_if_fail(heap != NULL && !heap_is_empty(heap), NULL);
-    return array_get(heap->array, 0);
+    return heap->data[0];
+}
+
+/**
+ * @brief Push the elements of an array_t object into a heap_t object.
+ *        The batch is appended and the whole heap re-heapified in O(n + k) when that is cheaper
+ *        than k pushes of O(log(n + k)) each.
+ * @param heap The heap_t object.
+ * @param array The array_t object.
+ * @return Returns the modified heap_t object, or NULL if the memory allocation fails.
+ *         The heap is unchanged in that case and the caller keeps the elements.
+ * @note The heap takes over the elements. Caller MUST NOT destroy them through the array
+ *       afterwards (e.g. create the array with a NULL destroy callback).
+ */
+heap_t *heap_push_many(heap_t *heap, const array_t *array) {
+    size_t count = 0;
+    size_t total = 0;
+    size_t depth = 0;
+    size_t i = 0;
+    T elem;
+
+    return_value_if_fail(heap != NULL, NULL);
+    return_value_if_fail(array != NULL, heap);
+
+    count = array_size(array);
+    total = heap->size + count;
+    /* Reserve up front, so neither path below can fail halfway and drop elements */
+    return_value_if_fail(__heap_reserve(heap, total), NULL);
+
+    /* Compare k pushes against a rebuild, taking the depth of the final heap as log(n + k) */
+    while (((size_t)1 << depth) <= total) {
+        depth++;
+    }
+
+    if (count * depth <= total) {
+        for (i = 0; i < count; i++) {
+            heap_push(heap, array_get(array, i));
+        }
+        return heap;
+    }
+
+    for (i = 0; i < count; i++) {
+        elem = array_get(array, i);
+        if (elem != NULL) {
+            heap->data[heap->size++] = elem;
+        }
+    }
+    __heapify(heap);
+    return heap;
+}
+
+/**
+ * @brief Push an element into a heap_t object, then pop the root, with a single sift down.
+ *        If the element would be the new root, it is returned right away and the heap is unchanged.
+ * @param heap The heap_t object.
+ * @param elem The element, which MUST NOT be NULL.
+ * @return Returns the popped element, or NULL if `elem` is NULL, in which case the heap is unchanged.
+ * @note Caller MUST free the returned element (if applicable).
+ */
+T heap_pushpop(heap_t *heap, T elem) {
+    return_value_if_fail(heap != NULL && elem != NULL, NULL);
+    return_value_if(heap_is_empty(heap), elem);
+
+    if (!__precedes(heap->compare, heap->order, heap->data[0], elem)) {
+        return elem;
+    }
+
+    return __heap_replace_root(heap, elem);
+}
+
+/**
+ * @brief Pop the root of a heap_t object, then push an element, with a single sift down.
+ *        Unlike heap_pushpop, the returned element is the old root even if the new element would precede it.
+ * @param heap The heap_t object.
+ * @param elem The element, which MUST NOT be NULL.
+ * @return Returns the popped element, or NULL if the heap_t object was empty or `elem` is NULL.
+ *         If the heap was empty and `elem` cannot be pushed, `elem` itself is returned.
+ * @note Caller MUST free the returned element (if applicable).
+ */
+T heap_replace(heap_t *heap, T elem) {
+    return_value_if_fail(heap != NULL && elem != NULL, NULL);
+
+    if (heap_is_empty(heap)) {
+        heap_push(heap, elem);
+        return heap_is_empty(heap) ? elem : NULL;
+    }
+
+    return __heap_replace_root(heap, elem);
 }
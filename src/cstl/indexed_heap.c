@@ -0,0 +1,364 @@
+#include "cstl/indexed_heap.h"
+
+#define DEFAULT_CAPACITY 16
+#define GROWTH_FACTOR 2
+
+typedef struct entry_t {
+    T elem;
+    size_t handle;
+} entry_t;
+
+struct indexed_heap_t {
+    entry_t *entries;
+    size_t size;
+    size_t capacity;
+    size_t *positions;
+    size_t *free_handles;
+    size_t free_count;
+    size_t handles;
+    int order;
+    compare_t compare;
+    destroy_t destroy;
+};
+
+/**
+ * @brief Create an indexed_heap_t object.
+ * @param heap_type The type of the heap (MIN_HEAP/MAX_HEAP).
+ * @param compare Callback function for comparing two data items.
+ * @param destroy Callback function for destroying a data item.
+ * @return Returns the created indexed_heap_t object if successful, otherwise returns NULL.
+ */
+indexed_heap_t *indexed_heap_new(heap_type_t heap_type, compare_t compare, destroy_t destroy) {
+    indexed_heap_t *heap = NULL;
+
+    return_value_if_fail(heap_type == MIN_HEAP || heap_type == MAX_HEAP, NULL);
+    return_value_if_fail(compare != NULL, NULL);
+
+    heap = (indexed_heap_t *)malloc(sizeof(indexed_heap_t));
+    return_value_if_fail(heap != NULL, NULL);
+
+    /* Handles are recycled before new ones are issued, so there are never more handles than slots */
+    heap->entries = (entry_t *)malloc(sizeof(entry_t) * DEFAULT_CAPACITY);
+    heap->positions = (size_t *)malloc(sizeof(size_t) * DEFAULT_CAPACITY);
+    heap->free_handles = (size_t *)malloc(sizeof(size_t) * DEFAULT_CAPACITY);
+    if (heap->entries == NULL || heap->positions == NULL || heap->free_handles == NULL) {
+        free(heap->entries);
+        free(heap->positions);
+        free(heap->free_handles);
+        free(heap);
+        return NULL;
+    }
+
+    heap->size = 0;
+    heap->capacity = DEFAULT_CAPACITY;
+    heap->free_count = 0;
+    heap->handles = 0;
+    heap->order = heap_type == MIN_HEAP ? 1 : -1;
+    heap->compare = compare;
+    heap->destroy = destroy;
+    return heap;
+}
+
+/**
+ * @brief Destroy an indexed_heap_t object.
+ * @param heap The indexed_heap_t object.
+ */
+void indexed_heap_delete(indexed_heap_t *heap) {
+    return_if_fail(heap != NULL);
+    indexed_heap_clear(heap);
+    free(heap->entries);
+    free(heap->positions);
+    free(heap->free_handles);
+    free(heap);
+}
+
+/**
+ * @brief Determine whether an indexed_heap_t object is empty.
+ * @param heap The indexed_heap_t object.
+ * @return Returns true if the indexed_heap_t object is empty, otherwise returns false.
+ */
+bool indexed_heap_is_empty(const indexed_heap_t *heap) {
+    return_value_if_fail(heap != NULL, true);
+    return heap->size == 0;
+}
+
+/**
+ * @brief Get the size of an indexed_heap_t object.
+ * @param heap The indexed_heap_t object.
+ * @return Returns the size of the indexed_heap_t object.
+ */
+size_t indexed_heap_size(const indexed_heap_t *heap) {
+    return_value_if_fail(heap != NULL, 0);
+    return heap->size;
+}
+
+/**
+ * @brief Clear an indexed_heap_t object.
+ *        All handles become invalid.
+ * @param heap The indexed_heap_t object.
+ * @return Returns the modified indexed_heap_t object.
+ */
+indexed_heap_t *indexed_heap_clear(indexed_heap_t *heap) {
+    size_t i = 0;
+
+    return_value_if_fail(heap != NULL, NULL);
+
+    if (heap->destroy != NULL) {
+        for (i = 0; i < heap->size; i++) {
+            heap->destroy(heap->entries[i].elem);
+        }
+    }
+
+    heap->size = 0;
+    heap->free_count = 0;
+    heap->handles = 0;
+    return heap;
+}
+
+/**
+ * @brief Determine whether an element belongs closer to the root than another one.
+ * @param heap The indexed_heap_t object.
+ * @param elem1 The first element.
+ * @param elem2 The second element.
+ * @return Returns true if `elem1` strictly precedes `elem2`, otherwise returns false.
+ */
+static bool __precedes(const indexed_heap_t *heap, T elem1, T elem2) {
+    int cmp = heap->compare(elem1, elem2);
+    return heap->order * ((cmp > 0) - (cmp < 0)) < 0;
+}
+
+/**
+ * @brief Heapify up, keeping the positions of the moved entries up to date.
+ * @param heap The indexed_heap_t object.
+ * @param index The index.
+ * @return Returns the final index of the entry.
+ */
+static size_t __heapify_up(indexed_heap_t *heap, size_t index) {
+    entry_t *entries = heap->entries;
+    entry_t entry = entries[index];
+    size_t parent_index;
+
+    while (index != 0) {
+        parent_index = (index - 1) / 2;
+        if (!__precedes(heap, entry.elem, entries[parent_index].elem)) {
+            break;
+        }
+        entries[index] = entries[parent_index];
+        heap->positions[entries[index].handle] = index;
+        index = parent_index;
+    }
+
+    entries[index] = entry;
+    heap->positions[entry.handle] = index;
+    return index;
+}
+
+/**
+ * @brief Heapify down, keeping the positions of the moved entries up to date.
+ * @param heap The indexed_heap_t object.
+ * @param index The index.
+ */
+static void __heapify_down(indexed_heap_t *heap, size_t index) {
+    entry_t *entries = heap->entries;
+    entry_t entry = entries[index];
+    size_t child_index;
+
+    while ((child_index = index * 2 + 1) < heap->size) {
+        if (child_index + 1 < heap->size && __precedes(heap, entries[child_index + 1].elem, entries[child_index].elem)) {
+            child_index++;
+        }
+        if (!__precedes(heap, entries[child_index].elem, entry.elem)) {
+            break;
+        }
+        entries[index] = entries[child_index];
+        heap->positions[entries[index].handle] = index;
+        index = child_index;
+    }
+
+    entries[index] = entry;
+    heap->positions[entry.handle] = index;
+}
+
+/**
+ * @brief Move the entry at an index up or down to where it belongs.
+ * @param heap The indexed_heap_t object.
+ * @param index The index.
+ */
+static void __heapify(indexed_heap_t *heap, size_t index) {
+    if (__heapify_up(heap, index) == index) {
+        __heapify_down(heap, index);
+    }
+}
+
+/**
+ * @brief Make room for one more element in an indexed_heap_t object.
+ * @param heap The indexed_heap_t object.
+ * @return Returns true if memory reallocation is successful, otherwise returns false.
+ */
+static bool __indexed_heap_grow(indexed_heap_t *heap) {
+    size_t new_capacity;
+    entry_t *entries = NULL;
+    size_t *positions = NULL;
+    size_t *free_handles = NULL;
+
+    return_value_if(heap->size < heap->capacity, true);
+
+    new_capacity = heap->capacity * GROWTH_FACTOR;
+
+    entries = (entry_t *)realloc(heap->entries, sizeof(entry_t) * new_capacity);
+    return_value_if_fail(entries != NULL, false);
+    heap->entries = entries;
+
+    positions = (size_t *)realloc(heap->positions, sizeof(size_t) * new_capacity);
+    return_value_if_fail(positions != NULL, false);
+    heap->positions = positions;
+
+    free_handles = (size_t *)realloc(heap->free_handles, sizeof(size_t) * new_capacity);
+    return_value_if_fail(free_handles != NULL, false);
+    heap->free_handles = free_handles;
+
+    heap->capacity = new_capacity;
+    return true;
+}
+
+/**
+ * @brief Remove the entry at an index and release its handle.
+ * @param heap The indexed_heap_t object.
+ * @param index The index.
+ * @return Returns the removed element.
+ */
+static T __remove_at(indexed_heap_t *heap, size_t index) {
+    entry_t entry = heap->entries[index];
+
+    heap->positions[entry.handle] = INDEXED_HEAP_INVALID_HANDLE;
+    heap->free_handles[heap->free_count++] = entry.handle;
+
+    /* Fill the hole with the last entry, which may belong above or below it */
+    heap->size--;
+    if (index < heap->size) {
+        heap->entries[index] = heap->entries[heap->size];
+        heap->positions[heap->entries[index].handle] = index;
+        __heapify(heap, index);
+    }
+
+    return entry.elem;
+}
+
+/**
+ * @brief Push an element into an indexed_heap_t object.
+ * @param heap The indexed_heap_t object.
+ * @param elem The element.
+ * @return Returns the handle of the element, which stays valid until the element leaves the heap,
+ *         or INDEXED_HEAP_INVALID_HANDLE if the element cannot be pushed.
+ * @note The handle of an element that left the heap may be reused by a later push.
+ */
+size_t indexed_heap_push(indexed_heap_t *heap, T elem) {
+    size_t handle;
+
+    return_value_if_fail(heap != NULL && elem != NULL, INDEXED_HEAP_INVALID_HANDLE);
+    return_value_if_fail(__indexed_heap_grow(heap), INDEXED_HEAP_INVALID_HANDLE);
+
+    if (heap->free_count > 0) {
+        handle = heap->free_handles[--heap->free_count];
+    } else {
+        handle = heap->handles++;
+    }
+
+    heap->entries[heap->size].elem = elem;
+    heap->entries[heap->size].handle = handle;
+    heap->size++;
+    __heapify_up(heap, heap->size - 1);
+    return handle;
+}
+
+/**
+ * @brief Pop the root element from an indexed_heap_t object.
+ * @param heap The indexed_heap_t object.
+ * @return Returns the popped element.
+ * @note Caller MUST free the returned element (if applicable).
+ */
+T indexed_heap_pop(indexed_heap_t *heap) {
+    return_value_if_fail(heap != NULL && heap->size > 0, NULL);
+    return __remove_at(heap, 0);
+}
+
+/**
+ * @brief Peek the root element of an indexed_heap_t object.
+ * @param heap The indexed_heap_t object.
+ * @return Returns the root element.
+ */
+T indexed_heap_peek(const indexed_heap_t *heap) {
+    return_value_if_fail(heap != NULL && heap->size > 0, NULL);
+    return heap->entries[0].elem;
+}
+
+/**
+ * @brief Get the handle of the root element of an indexed_heap_t object.
+ * @param heap The indexed_heap_t object.
+ * @return Returns the handle of the root element, or INDEXED_HEAP_INVALID_HANDLE if the heap is empty.
+ */
+size_t indexed_heap_peek_handle(const indexed_heap_t *heap) {
+    return_value_if_fail(heap != NULL && heap->size > 0, INDEXED_HEAP_INVALID_HANDLE);
+    return heap->entries[0].handle;
+}
+
+/**
+ * @brief Determine whether a handle refers to an element in an indexed_heap_t object.
+ * @param heap The indexed_heap_t object.
+ * @param handle The handle.
+ * @return Returns true if the handle refers to an element in the heap, otherwise returns false.
+ */
+bool indexed_heap_contains(const indexed_heap_t *heap, size_t handle) {
+    return_value_if_fail(heap != NULL, false);
+    return handle < heap->handles && heap->positions[handle] != INDEXED_HEAP_INVALID_HANDLE;
+}
+
+/**
+ * @brief Get the element of a handle in an indexed_heap_t object.
+ * @param heap The indexed_heap_t object.
+ * @param handle The handle.
+ * @return Returns the element if the handle is valid, otherwise returns NULL.
+ */
+T indexed_heap_get(const indexed_heap_t *heap, size_t handle) {
+    return_value_if_fail(indexed_heap_contains(heap, handle), NULL);
+    return heap->entries[heap->positions[handle]].elem;
+}
+
+/**
+ * @brief Restore the position of an element after its priority changed in either direction in O(log n).
+ * @param heap The indexed_heap_t object.
+ * @param handle The handle of the changed element.
+ * @return Returns the modified indexed_heap_t object.
+ */
+indexed_heap_t *indexed_heap_update(indexed_heap_t *heap, size_t handle) {
+    return_value_if_fail(heap != NULL, NULL);
+    return_value_if_fail(indexed_heap_contains(heap, handle), heap);
+    __heapify(heap, heap->positions[handle]);
+    return heap;
+}
+
+/**
+ * @brief Restore the position of an element after it moved towards the root in O(log n).
+ *        That is a smaller key for a MIN_HEAP and a larger key for a MAX_HEAP.
+ * @param heap The indexed_heap_t object.
+ * @param handle The handle of the changed element.
+ * @return Returns the modified indexed_heap_t object.
+ */
+indexed_heap_t *indexed_heap_decrease_key(indexed_heap_t *heap, size_t handle) {
+    return_value_if_fail(heap != NULL, NULL);
+    return_value_if_fail(indexed_heap_contains(heap, handle), heap);
+    __heapify_up(heap, heap->positions[handle]);
+    return heap;
+}
+
+/**
+ * @brief Remove an element from an indexed_heap_t object by its handle in O(log n).
+ * @param heap The indexed_heap_t object.
+ * @param handle The handle.
+ * @return Returns the removed element if the handle is valid, otherwise returns NULL.
+ * @note Caller MUST free the returned element (if applicable).
+ */
+T indexed_heap_remove(indexed_heap_t *heap, size_t handle) {
+    return_value_if_fail(indexed_heap_contains(heap, handle), NULL);
+    return __remove_at(heap, heap->positions[handle]);
+}
@@ -12,15 +12,23 @@ struct list_t {
     size_t size;
     compare_t compare;
     destroy_t destroy;
+    pool_t *pool;
+    bool owns_pool;
 };
 
+typedef struct list_iterator_t {
+    iterator_t iterator;
+    bool removed;    /* The element last returned has been removed since */
+} list_iterator_t;
+
 /**
  * @brief Create a node_t object.
+ * @param list The list_t object which owns the node.
  * @param elem The element.
  * @return Returns the created node_t object if successful, otherwise returns NULL.
  */
-static node_t *__node_new(T elem) {
-    node_t *node = (node_t *)malloc(sizeof(node_t));
+static node_t *__node_new(list_t *list, T elem) {
+    node_t *node = (node_t *)pool_alloc(list->pool);
     return_value_if_fail(node != NULL, NULL);
     node->data = elem;
     node->prev = NULL;
@@ -28,6 +36,24 @@ static node_t *__node_new(T elem) {
     return node;
 }
 
+/**
+ * @brief Destroy a node_t object without destroying its element.
+ * @param list The list_t object which owns the node.
+ * @param node The node_t object.
+ */
+static void __node_delete(list_t *list, node_t *node) {
+    pool_free(list->pool, node);
+}
+
+/**
+ * @brief Create a pool_t object for allocating nodes of list_t objects.
+ * @return Returns the created pool_t object if successful, otherwise returns NULL.
+ * @note Caller MUST destroy the returned pool with `pool_delete()` after all lists using it are destroyed.
+ */
+pool_t *list_pool_new(void) {
+    return pool_new(sizeof(node_t));
+}
+
 /**
  * @brief Create a list_t object.
  * @param compare Callback function for comparing two data items.
@@ -35,7 +61,37 @@ static node_t *__node_new(T elem) {
  * @return Returns the created list_t object if successful, otherwise returns NULL.
  */
 list_t *list_new(compare_t compare, destroy_t destroy) {
-    list_t *list = (list_t *)malloc(sizeof(list_t));
+    list_t *list = NULL;
+    pool_t *pool = NULL;
+
+    pool = list_pool_new();
+    return_value_if_fail(pool != NULL, NULL);
+
+    list = list_new_with_pool(compare, destroy, pool);
+    if (list == NULL) {
+        pool_delete(pool);
+        return NULL;
+    }
+
+    list->owns_pool = true;
+    return list;
+}
+
+/**
+ * @brief Create a list_t object which allocates its nodes from a shared pool.
+ * @param compare Callback function for comparing two data items.
+ * @param destroy Callback function for destroying a data item.
+ * @param pool The pool_t object created by `list_pool_new()`.
+ * @return Returns the created list_t object if successful, otherwise returns NULL.
+ * @note The pool is not owned by the list and MUST outlive it.
+ */
+list_t *list_new_with_pool(compare_t compare, destroy_t destroy, pool_t *pool) {
+    list_t *list = NULL;
+
+    return_value_if_fail(pool != NULL, NULL);
+    return_value_if_fail(pool_block_size(pool) >= sizeof(node_t), NULL);
+
+    list = (list_t *)malloc(sizeof(list_t));
     return_value_if_fail(list != NULL, NULL);
 
     list->head = NULL;
@@ -43,6 +99,8 @@ list_t *list_new(compare_t compare, destroy_t destroy) {
     list->size = 0;
     list->compare = compare;
     list->destroy = destroy;
+    list->pool = pool;
+    list->owns_pool = false;
 
     return list;
 }
@@ -54,6 +112,9 @@ list_t *list_new(compare_t compare, destroy_t destroy) {
 void list_delete(list_t *list) {
     return_if_fail(list != NULL);
     list_clear(list);
+    if (list->owns_pool) {
+        pool_delete(list->pool);
+    }
     free(list);
 }
 
@@ -103,14 +164,23 @@ list_t *list_clear(list_t *list) {
 
     return_value_if_fail(list != NULL, NULL);
 
-    node = list->head;
-    while (node != NULL) {
-        next_node = node->next;
-        if (list->destroy != NULL) {
-            list->destroy(node->data);
+    /* Nodes of a private pool are released in bulk, so only the elements need a visit */
+    if (list->destroy != NULL || !list->owns_pool) {
+        node = list->head;
+        while (node != NULL) {
+            next_node = node->next;
+            if (list->destroy != NULL) {
+                list->destroy(node->data);
+            }
+            if (!list->owns_pool) {
+                __node_delete(list, node);
+            }
+            node = next_node;
         }
-        free(node);
-        node = next_node;
+    }
+
+    if (list->owns_pool) {
+        pool_clear(list->pool);
     }
 
     list->head = NULL;
@@ -147,6 +217,62 @@ static node_t *__node_get(const list_t *list, size_t index) {
     return node;
 }
 
+/**
+ * @brief Unlink a node_t object from the list_t object and destroy the node.
+ * @param list The list_t object.
+ * @param node The node_t object.
+ * @return Returns the element of the removed node.
+ */
+static T __node_remove(list_t *list, node_t *node) {
+    T elem = node->data;
+
+    if (node->prev == NULL) {
+        list->head = node->next;
+    } else {
+        node->prev->next = node->next;
+    }
+
+    if (node->next == NULL) {
+        list->tail = node->prev;
+    } else {
+        node->next->prev = node->prev;
+    }
+
+    __node_delete(list, node);
+    list->size--;
+    return elem;
+}
+
+/**
+ * @brief Link a new node_t object into the list_t object after the specified node.
+ * @param list The list_t object.
+ * @param node The node_t object to insert after, or NULL to insert at the beginning.
+ * @param elem The element.
+ * @return Returns true if successful, otherwise returns false.
+ */
+static bool __node_insert_after(list_t *list, node_t *node, T elem) {
+    node_t *new_node = __node_new(list, elem);
+    return_value_if_fail(new_node != NULL, false);
+
+    new_node->prev = node;
+    new_node->next = node == NULL ? list->head : node->next;
+
+    if (new_node->prev == NULL) {
+        list->head = new_node;
+    } else {
+        new_node->prev->next = new_node;
+    }
+
+    if (new_node->next == NULL) {
+        list->tail = new_node;
+    } else {
+        new_node->next->prev = new_node;
+    }
+
+    list->size++;
+    return true;
+}
+
 /**
  * @brief Get the element at the specified index of a list_t object.
  * @param list The list_t object.
@@ -283,7 +409,7 @@ list_t *list_push_front(list_t *list, T elem) {
     return_value_if_fail(list != NULL, NULL);
     return_value_if_fail(elem != NULL, list);
 
-    node = __node_new(elem);
+    node = __node_new(list, elem);
     return_value_if_fail(node != NULL, list);
 
     if (list->size == 0) {
@@ -311,7 +437,7 @@ list_t *list_push_back(list_t *list, T elem) {
     return_value_if_fail(list != NULL, NULL);
     return_value_if_fail(elem != NULL, list);
 
-    node = __node_new(elem);
+    node = __node_new(list, elem);
     return_value_if_fail(node != NULL, list);
 
     if (list->size == 0) {
@@ -351,7 +477,7 @@ T list_pop_front(list_t *list) {
         list->head->prev = NULL;
     }
 
-    free(node);
+    __node_delete(list, node);
     list->size--;
     return elem;
 }
@@ -380,7 +506,7 @@ T list_pop_back(list_t *list) {
         list->tail->next = NULL;
     }
 
-    free(node);
+    __node_delete(list, node);
     list->size--;
     return elem;
 }
@@ -402,21 +528,9 @@ list_t *list_insert(list_t *list, size_t index, T elem) {
     } else if (index == list->size) {
         list_push_back(list, elem);
     } else {
-        node_t *node = NULL;
-        node_t *new_node = NULL;
-
-        node = __node_get(list, index);
+        node_t *node = __node_get(list, index);
         return_value_if_fail(node != NULL, list);
-
-        new_node = __node_new(elem);
-        return_value_if_fail(new_node != NULL, list);
-
-        new_node->prev = node->prev;
-        new_node->next = node;
-        node->prev->next = new_node;
-        node->prev = new_node;
-
-        list->size++;
+        __node_insert_after(list, node->prev, elem);
     }
 
     return list;
@@ -431,7 +545,6 @@ list_t *list_insert(list_t *list, size_t index, T elem) {
  */
 T list_remove(list_t *list, size_t index) {
     node_t *node = NULL;
-    T elem = NULL;
 
     return_value_if_fail(list != NULL, NULL);
     return_value_if_fail(index >= 0 && index < list->size, NULL);
@@ -443,14 +556,7 @@ T list_remove(list_t *list, size_t index) {
     } else {
         node = __node_get(list, index);
         return_value_if_fail(node != NULL, NULL);
-
-        elem = node->data;
-        node->prev->next = node->next;
-        node->next->prev = node->prev;
-
-        free(node);
-        list->size--;
-        return elem;
+        return __node_remove(list, node);
     }
 }
 
@@ -480,22 +586,259 @@ list_t *list_reverse(list_t *list) {
     return list;
 }
 
+/**
+ * @brief Sort the list_t object in ascending order.
+ *        Stable bottom-up merge sort which relinks the nodes in place without allocating.
+ * @param list The list_t object.
+ * @return Returns the modified list_t object.
+ */
+list_t *list_sort(list_t *list) {
+    node_t *head = NULL;
+    node_t *tail = NULL;
+    node_t *p = NULL;
+    node_t *q = NULL;
+    node_t *node = NULL;
+    size_t run_size = 1;
+    size_t p_size;
+    size_t q_size;
+    size_t merges;
+
+    return_value_if_fail(list != NULL, NULL);
+    return_value_if_fail(list->compare != NULL, list);
+    return_value_if(list->size < 2, list);
+
+    head = list->head;
+    while (true) {
+        p = head;
+        head = NULL;
+        tail = NULL;
+        merges = 0;
+
+        /* Merge adjacent runs of length run_size */
+        while (p != NULL) {
+            merges++;
+            q = p;
+            for (p_size = 0; p_size < run_size && q != NULL; p_size++) {
+                q = q->next;
+            }
+            q_size = run_size;
+
+            while (p_size > 0 || (q_size > 0 && q != NULL)) {
+                if (p_size == 0) {
+                    node = q;
+                    q = q->next;
+                    q_size--;
+                } else if (q_size == 0 || q == NULL || list->compare(p->data, q->data) <= 0) {
+                    node = p;
+                    p = p->next;
+                    p_size--;
+                } else {
+                    node = q;
+                    q = q->next;
+                    q_size--;
+                }
+
+                if (tail == NULL) {
+                    head = node;
+                } else {
+                    tail->next = node;
+                }
+                node->prev = tail;
+                tail = node;
+            }
+
+            p = q;
+        }
+
+        tail->next = NULL;
+        if (merges <= 1) {
+            break;
+        }
+        run_size *= 2;
+    }
+
+    list->head = head;
+    list->tail = tail;
+    return list;
+}
+
+/**
+ * @brief Move the nodes of `other` into the pool of `list`.
+ *        A private pool of `other` is merged as a whole if its block size matches, otherwise the nodes are copied.
+ * @param list The list_t object which receives the nodes.
+ * @param other The list_t object whose nodes are about to be moved.
+ * @return Returns true if successful, otherwise returns false.
+ */
+static bool __adopt_nodes(list_t *list, list_t *other) {
+    node_t *new_nodes = NULL;
+    node_t *new_node = NULL;
+    node_t *node = NULL;
+    node_t *next_node = NULL;
+    node_t *prev_node = NULL;
+    size_t i = 0;
+
+    return_value_if(list->pool == other->pool, true);
+
+    /* pool_merge() only takes over pools of the same block size */
+    if (other->owns_pool && pool_block_size(list->pool) == pool_block_size(other->pool)) {
+        pool_merge(list->pool, other->pool);
+        return true;
+    }
+
+    /* Allocate every node up front so that failure leaves both lists untouched */
+    for (i = 0; i < other->size; i++) {
+        new_node = __node_new(list, NULL);
+        if (new_node == NULL) {
+            while (new_nodes != NULL) {
+                new_node = new_nodes->next;
+                __node_delete(list, new_nodes);
+                new_nodes = new_node;
+            }
+            return false;
+        }
+        new_node->next = new_nodes;
+        new_nodes = new_node;
+    }
+
+    node = other->head;
+    while (node != NULL) {
+        next_node = node->next;
+        new_node = new_nodes;
+        new_nodes = new_nodes->next;
+
+        new_node->data = node->data;
+        new_node->prev = prev_node;
+        new_node->next = NULL;
+        if (prev_node == NULL) {
+            other->head = new_node;
+        } else {
+            prev_node->next = new_node;
+        }
+        prev_node = new_node;
+
+        __node_delete(other, node);
+        node = next_node;
+    }
+    other->tail = prev_node;
+    return true;
+}
+
+/**
+ * @brief Move all elements of `other` into the list_t object before the specified position.
+ * @param list The list_t object.
+ * @param index The index. Passing the size of `list` appends the elements.
+ * @param other The list_t object to be emptied.
+ * @return Returns the modified list_t object.
+ * @note The moved elements are owned by `list` afterwards.
+ */
+list_t *list_splice(list_t *list, size_t index, list_t *other) {
+    node_t *node = NULL;
+
+    return_value_if_fail(list != NULL, NULL);
+    return_value_if_fail(other != NULL && other != list, list);
+    return_value_if_fail(index >= 0 && index <= list->size, list);
+    return_value_if(other->size == 0, list);
+    return_value_if_fail(__adopt_nodes(list, other), list);
+
+    if (list->size == 0) {
+        list->head = other->head;
+        list->tail = other->tail;
+    } else if (index == 0) {
+        other->tail->next = list->head;
+        list->head->prev = other->tail;
+        list->head = other->head;
+    } else if (index == list->size) {
+        list->tail->next = other->head;
+        other->head->prev = list->tail;
+        list->tail = other->tail;
+    } else {
+        node = __node_get(list, index);
+        return_value_if_fail(node != NULL, list);
+
+        other->head->prev = node->prev;
+        other->tail->next = node;
+        node->prev->next = other->head;
+        node->prev = other->tail;
+    }
+
+    list->size += other->size;
+    other->head = NULL;
+    other->tail = NULL;
+    other->size = 0;
+    return list;
+}
+
+/**
+ * @brief Merge the sorted list `other` into the sorted list_t object.
+ *        The merge is stable: equal elements of `list` precede those of `other`.
+ * @param list The list_t object sorted in ascending order.
+ * @param other The list_t object sorted in ascending order, which is emptied.
+ * @return Returns the modified list_t object.
+ * @note The moved elements are owned by `list` afterwards.
+ */
+list_t *list_merge(list_t *list, list_t *other) {
+    node_t *p = NULL;
+    node_t *q = NULL;
+    node_t *node = NULL;
+    node_t *tail = NULL;
+
+    return_value_if_fail(list != NULL, NULL);
+    return_value_if_fail(other != NULL && other != list, list);
+    return_value_if_fail(list->compare != NULL, list);
+    return_value_if(other->size == 0, list);
+    return_value_if_fail(__adopt_nodes(list, other), list);
+
+    p = list->head;
+    q = other->head;
+    list->head = NULL;
+
+    while (p != NULL || q != NULL) {
+        if (q == NULL || (p != NULL && list->compare(p->data, q->data) <= 0)) {
+            node = p;
+            p = p->next;
+        } else {
+            node = q;
+            q = q->next;
+        }
+
+        if (tail == NULL) {
+            list->head = node;
+        } else {
+            tail->next = node;
+        }
+        node->prev = tail;
+        tail = node;
+    }
+
+    tail->next = NULL;
+    list->tail = tail;
+    list->size += other->size;
+    other->head = NULL;
+    other->tail = NULL;
+    other->size = 0;
+    return list;
+}
+
 /**
  * @brief Create an iterator for a list_t object.
+ *        The iterator is a cursor on the element last returned by `list_iterator_next()`,
+ *        which can be removed, replaced or used as an insert position in O(1).
  * @param list The list_t object.
  * @return Returns the iterator for container.
  */
 iterator_t *list_iterator_new(const list_t *list) {
-    iterator_t *iterator = NULL;
+    list_iterator_t *iterator = NULL;
 
     return_value_if_fail(list != NULL, NULL);
 
-    iterator = (iterator_t *)malloc(sizeof(iterator_t));
+    iterator = (list_iterator_t *)malloc(sizeof(list_iterator_t));
     return_value_if_fail(iterator != NULL, NULL);
 
-    iterator->container = (void *)list;
-    iterator->current = list->head;
-    return iterator;
+    /* The cursor starts before the first element */
+    iterator->iterator.container = (void *)list;
+    iterator->iterator.current = NULL;
+    iterator->removed = false;
+    return &iterator->iterator;
 }
 
 /**
@@ -513,8 +856,15 @@ void list_iterator_delete(iterator_t *iterator) {
  * @return Returns true if the iterator has the next element, otherwise returns false.
  */
 bool list_iterator_has_next(const iterator_t *iterator) {
+    list_t *list = NULL;
+
     return_value_if_fail(iterator != NULL, false);
-    return iterator->current != NULL;
+
+    list = (list_t *)iterator->container;
+    if (iterator->current == NULL) {
+        return list->head != NULL;
+    }
+    return ((node_t *)iterator->current)->next != NULL;
 }
 
 /**
@@ -523,12 +873,92 @@ bool list_iterator_has_next(const iterator_t *iterator) {
  * @return Returns the next element of the iterator.
  */
 T list_iterator_next(iterator_t *iterator) {
-    T elem = NULL;
+    list_t *list = NULL;
 
     return_value_if_fail(iterator != NULL, NULL);
     return_value_if_fail(list_iterator_has_next(iterator), NULL);
 
-    elem = ((node_t *)iterator->current)->data;
-    iterator->current = ((node_t *)iterator->current)->next;
-    return elem;
+    list = (list_t *)iterator->container;
+    if (iterator->current == NULL) {
+        iterator->current = list->head;
+    } else {
+        iterator->current = ((node_t *)iterator->current)->next;
+    }
+    ((list_iterator_t *)iterator)->removed = false;
+    return ((node_t *)iterator->current)->data;
+}
+
+/**
+ * @brief Remove the element last returned by the iterator in O(1).
+ *        The iteration continues with the element following the removed one.
+ *        Until the next `list_iterator_next()`, there is no element to remove, replace or insert before.
+ * @param iterator The iterator_t object.
+ * @return Returns the removed element if successful, otherwise returns NULL.
+ * @note Caller MUST free the returned element (if applicable).
+ */
+T list_iterator_remove(iterator_t *iterator) {
+    node_t *node = NULL;
+
+    return_value_if_fail(iterator != NULL, NULL);
+    return_value_if_fail(iterator->current != NULL && !((list_iterator_t *)iterator)->removed, NULL);
+
+    /* The cursor moves back to the previous element, so that next() continues after the removed one */
+    node = (node_t *)iterator->current;
+    iterator->current = node->prev;
+    ((list_iterator_t *)iterator)->removed = true;
+    return __node_remove((list_t *)iterator->container, node);
+}
+
+/**
+ * @brief Replace the element last returned by the iterator in O(1).
+ * @param iterator The iterator_t object.
+ * @param elem The element.
+ * @return Returns the iterator_t object.
+ */
+iterator_t *list_iterator_set(iterator_t *iterator, T elem) {
+    list_t *list = NULL;
+    node_t *node = NULL;
+
+    return_value_if_fail(iterator != NULL, NULL);
+    return_value_if_fail(iterator->current != NULL && !((list_iterator_t *)iterator)->removed, iterator);
+    return_value_if_fail(elem != NULL, iterator);
+
+    list = (list_t *)iterator->container;
+    node = (node_t *)iterator->current;
+    if (list->destroy != NULL) {
+        list->destroy(node->data);
+    }
+    node->data = elem;
+    return iterator;
+}
+
+/**
+ * @brief Insert an element before the element last returned by the iterator in O(1).
+ *        The inserted element is not returned by the following `list_iterator_next()`.
+ * @param iterator The iterator_t object.
+ * @param elem The element.
+ * @return Returns the iterator_t object.
+ */
+iterator_t *list_iterator_insert_before(iterator_t *iterator, T elem) {
+    return_value_if_fail(iterator != NULL, NULL);
+    return_value_if_fail(iterator->current != NULL && !((list_iterator_t *)iterator)->removed, iterator);
+    return_value_if_fail(elem != NULL, iterator);
+    __node_insert_after((list_t *)iterator->container, ((node_t *)iterator->current)->prev, elem);
+    return iterator;
+}
+
+/**
+ * @brief Insert an element after the element last returned by the iterator in O(1).
+ *        The inserted element is returned by the following `list_iterator_next()`.
+ *        If no element has been returned yet, the element is inserted at the beginning,
+ *        and after a removal it takes the place of the removed element.
+ * @param iterator The iterator_t object.
+ * @param elem The element.
+ * @return Returns the iterator_t object.
+ */
+iterator_t *list_iterator_insert_after(iterator_t *iterator, T elem) {
+    return_value_if_fail(iterator != NULL, NULL);
+    return_value_if_fail(elem != NULL, iterator);
+    __node_insert_after((list_t *)iterator->container, (node_t *)iterator->current, elem);
+    return iterator;
 }
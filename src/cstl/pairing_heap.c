@@ -0,0 +1,340 @@
+#include "cstl/pairing_heap.h"
+#include "utils/pool.h"
+
+struct pairing_heap_node_t {
+    T elem;
+    struct pairing_heap_node_t *child;
+    struct pairing_heap_node_t *next;
+    struct pairing_heap_node_t *prev;   /* Parent for the first child, left sibling otherwise */
+};
+
+typedef struct pairing_heap_node_t node_t;
+
+struct pairing_heap_t {
+    node_t *root;
+    pool_t *pool;
+    size_t size;
+    int order;
+    compare_t compare;
+    destroy_t destroy;
+};
+
+/**
+ * @brief Create a pairing_heap_t object.
+ * @param heap_type The type of the heap (MIN_HEAP/MAX_HEAP).
+ * @param compare Callback function for comparing two data items.
+ * @param destroy Callback function for destroying a data item.
+ * @return Returns the created pairing_heap_t object if successful, otherwise returns NULL.
+ */
+pairing_heap_t *pairing_heap_new(heap_type_t heap_type, compare_t compare, destroy_t destroy) {
+    pairing_heap_t *heap = NULL;
+
+    return_value_if_fail(heap_type == MIN_HEAP || heap_type == MAX_HEAP, NULL);
+    return_value_if_fail(compare != NULL, NULL);
+
+    heap = (pairing_heap_t *)malloc(sizeof(pairing_heap_t));
+    return_value_if_fail(heap != NULL, NULL);
+
+    heap->pool = pool_new(sizeof(node_t));
+    if (heap->pool == NULL) {
+        free(heap);
+        return NULL;
+    }
+
+    heap->root = NULL;
+    heap->size = 0;
+    heap->order = heap_type == MIN_HEAP ? 1 : -1;
+    heap->compare = compare;
+    heap->destroy = destroy;
+    return heap;
+}
+
+/**
+ * @brief Destroy a pairing_heap_t object.
+ * @param heap The pairing_heap_t object.
+ */
+void pairing_heap_delete(pairing_heap_t *heap) {
+    return_if_fail(heap != NULL);
+    pairing_heap_clear(heap);
+    pool_delete(heap->pool);
+    free(heap);
+}
+
+/**
+ * @brief Determine whether a pairing_heap_t object is empty.
+ * @param heap The pairing_heap_t object.
+ * @return Returns true if the pairing_heap_t object is empty, otherwise returns false.
+ */
+bool pairing_heap_is_empty(const pairing_heap_t *heap) {
+    return_value_if_fail(heap != NULL, true);
+    return heap->size == 0;
+}
+
+/**
+ * @brief Get the size of a pairing_heap_t object.
+ * @param heap The pairing_heap_t object.
+ * @return Returns the size of the pairing_heap_t object.
+ */
+size_t pairing_heap_size(const pairing_heap_t *heap) {
+    return_value_if_fail(heap != NULL, 0);
+    return heap->size;
+}
+
+/**
+ * @brief Clear a pairing_heap_t object.
+ * @param heap The pairing_heap_t object.
+ * @return Returns the modified pairing_heap_t object.
+ */
+pairing_heap_t *pairing_heap_clear(pairing_heap_t *heap) {
+    node_t *node = NULL;
+    node_t *last = NULL;
+
+    return_value_if_fail(heap != NULL, NULL);
+
+    /* Splice the children of every node in front of its siblings, so the tree is visited as one list */
+    node = heap->destroy != NULL ? heap->root : NULL;
+    while (node != NULL) {
+        if (node->child != NULL) {
+            for (last = node->child; last->next != NULL; last = last->next) {
+            }
+            last->next = node->next;
+            node->next = node->child;
+        }
+        heap->destroy(node->elem);
+        node = node->next;
+    }
+
+    /* The nodes are released slab by slab */
+    pool_clear(heap->pool);
+
+    heap->root = NULL;
+    heap->size = 0;
+    return heap;
+}
+
+/**
+ * @brief Determine whether an element belongs closer to the root than another one.
+ * @param heap The pairing_heap_t object.
+ * @param elem1 The first element.
+ * @param elem2 The second element.
+ * @return Returns true if `elem1` strictly precedes `elem2`, otherwise returns false.
+ */
+static bool __precedes(const pairing_heap_t *heap, T elem1, T elem2) {
+    int cmp = heap->compare(elem1, elem2);
+    return heap->order * ((cmp > 0) - (cmp < 0)) < 0;
+}
+
+/**
+ * @brief Link two detached trees, making the one with the lower priority root the first child of the other.
+ * @param heap The pairing_heap_t object.
+ * @param node1 The root of the first tree.
+ * @param node2 The root of the second tree.
+ * @return Returns the root of the linked tree.
+ */
+static node_t *__link(const pairing_heap_t *heap, node_t *node1, node_t *node2) {
+    node_t *parent = node1;
+    node_t *child = node2;
+
+    if (__precedes(heap, node2->elem, node1->elem)) {
+        parent = node2;
+        child = node1;
+    }
+
+    child->prev = parent;
+    child->next = parent->child;
+    if (parent->child != NULL) {
+        parent->child->prev = child;
+    }
+    parent->child = child;
+
+    parent->next = NULL;
+    parent->prev = NULL;
+    return parent;
+}
+
+/**
+ * @brief Merge a list of sibling trees into one tree with the two-pass pairing.
+ * @param heap The pairing_heap_t object.
+ * @param first The first tree of the list.
+ * @return Returns the root of the merged tree, or NULL if the list is empty.
+ */
+static node_t *__merge_pairs(const pairing_heap_t *heap, node_t *first) {
+    node_t *pairs = NULL;
+    node_t *root = NULL;
+    node_t *next = NULL;
+    node_t *node = NULL;
+
+    /* First pass: link adjacent pairs from left to right, stacking the results in reverse */
+    while (first != NULL) {
+        node = first;
+        first = first->next;
+        if (first != NULL) {
+            next = first->next;
+            node = __link(heap, node, first);
+            first = next;
+        }
+        node->next = pairs;
+        pairs = node;
+    }
+
+    /* Second pass: link the pairs from right to left into the last one */
+    while (pairs != NULL) {
+        next = pairs->next;
+        root = root == NULL ? pairs : __link(heap, root, pairs);
+        pairs = next;
+    }
+
+    if (root != NULL) {
+        root->next = NULL;
+        root->prev = NULL;
+    }
+    return root;
+}
+
+/**
+ * @brief Detach a non-root node and its subtree from its parent and siblings.
+ * @param node The node.
+ */
+static void __detach(node_t *node) {
+    if (node->prev->child == node) {
+        node->prev->child = node->next;
+    } else {
+        node->prev->next = node->next;
+    }
+    if (node->next != NULL) {
+        node->next->prev = node->prev;
+    }
+    node->next = NULL;
+    node->prev = NULL;
+}
+
+/**
+ * @brief Push an element into a pairing_heap_t object in O(1).
+ * @param heap The pairing_heap_t object.
+ * @param elem The element.
+ * @return Returns the node holding the element, which stays valid until the element leaves the heap,
+ *         or NULL if the element cannot be pushed.
+ */
+pairing_heap_node_t *pairing_heap_push(pairing_heap_t *heap, T elem) {
+    node_t *node = NULL;
+
+    return_value_if_fail(heap != NULL && elem != NULL, NULL);
+
+    node = (node_t *)pool_alloc(heap->pool);
+    return_value_if_fail(node != NULL, NULL);
+
+    node->elem = elem;
+    node->child = NULL;
+    node->next = NULL;
+    node->prev = NULL;
+
+    heap->root = heap->root == NULL ? node : __link(heap, heap->root, node);
+    heap->size++;
+    return node;
+}
+
+/**
+ * @brief Pop the root element from a pairing_heap_t object in amortized O(log n).
+ * @param heap The pairing_heap_t object.
+ * @return Returns the popped element.
+ * @note Caller MUST free the returned element (if applicable).
+ */
+T pairing_heap_pop(pairing_heap_t *heap) {
+    node_t *root = NULL;
+    T elem = NULL;
+
+    return_value_if_fail(heap != NULL && heap->root != NULL, NULL);
+
+    root = heap->root;
+    elem = root->elem;
+    heap->root = __merge_pairs(heap, root->child);
+    heap->size--;
+    pool_free(heap->pool, root);
+    return elem;
+}
+
+/**
+ * @brief Peek the root element of a pairing_heap_t object.
+ * @param heap The pairing_heap_t object.
+ * @return Returns the root element.
+ */
+T pairing_heap_peek(const pairing_heap_t *heap) {
+    return_value_if_fail(heap != NULL && heap->root != NULL, NULL);
+    return heap->root->elem;
+}
+
+/**
+ * @brief Move all elements of another pairing_heap_t object into a pairing_heap_t object.
+ *        The two roots are linked in O(1) and the node slabs of `other` are handed over without
+ *        copying, so its nodes stay valid and now belong to `heap`, `other` is left empty.
+ * @param heap The pairing_heap_t object.
+ * @param other The pairing_heap_t object to be melded, with the same heap type and compare function.
+ * @return Returns the modified pairing_heap_t object, or NULL if the two heaps are not compatible.
+ * @note Caller MUST destroy the parameter `other`.
+ */
+pairing_heap_t *pairing_heap_meld(pairing_heap_t *heap, pairing_heap_t *other) {
+    return_value_if_fail(heap != NULL && other != NULL, NULL);
+    return_value_if_fail(heap->order == other->order && heap->compare == other->compare, NULL);
+    return_value_if(heap == other || other->root == NULL, heap);
+
+    heap->root = heap->root == NULL ? other->root : __link(heap, heap->root, other->root);
+    heap->size += other->size;
+    pool_merge(heap->pool, other->pool);
+
+    other->root = NULL;
+    other->size = 0;
+    return heap;
+}
+
+/**
+ * @brief Get the element held by a node of a pairing_heap_t object.
+ * @param node The pairing_heap_node_t object.
+ * @return Returns the element.
+ */
+T pairing_heap_node_get(const pairing_heap_node_t *node) {
+    return_value_if_fail(node != NULL, NULL);
+    return node->elem;
+}
+
+/**
+ * @brief Restore the position of a node after its element moved towards the root in amortized O(log n).
+ *        That is a smaller key for a MIN_HEAP and a larger key for a MAX_HEAP.
+ * @param heap The pairing_heap_t object.
+ * @param node The node of the changed element.
+ * @return Returns the modified pairing_heap_t object.
+ */
+pairing_heap_t *pairing_heap_decrease_key(pairing_heap_t *heap, pairing_heap_node_t *node) {
+    return_value_if_fail(heap != NULL && node != NULL, NULL);
+    return_value_if(node == heap->root, heap);
+
+    /* The subtree of the node is still heap-ordered, so it only has to be cut and relinked */
+    __detach(node);
+    heap->root = __link(heap, heap->root, node);
+    return heap;
+}
+
+/**
+ * @brief Remove a node from a pairing_heap_t object in amortized O(log n).
+ * @param heap The pairing_heap_t object.
+ * @param node The node.
+ * @return Returns the element held by the removed node.
+ * @note Caller MUST free the returned element (if applicable).
+ */
+T pairing_heap_remove(pairing_heap_t *heap, pairing_heap_node_t *node) {
+    node_t *subtree = NULL;
+    T elem = NULL;
+
+    return_value_if_fail(heap != NULL && node != NULL, NULL);
+    return_value_if(node == heap->root, pairing_heap_pop(heap));
+
+    __detach(node);
+    subtree = __merge_pairs(heap, node->child);
+    if (subtree != NULL) {
+        heap->root = __link(heap, heap->root, subtree);
+    }
+    heap->size--;
+
+    elem = node->elem;
+    pool_free(heap->pool, node);
+    return elem;
+}
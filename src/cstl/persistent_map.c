@@ -0,0 +1,577 @@
+#include "cstl/persistent_map.h"
+#include "utils/numeric.h"
+
+/* An AVL tree of 2^64 nodes is less than 93 levels high */
+#define MAX_HEIGHT 96
+
+typedef struct entry_t {
+    pair_t *pair;
+    size_t refs;
+} entry_t;
+
+typedef struct node_t {
+    entry_t *entry;
+    struct node_t *left;
+    struct node_t *right;
+    size_t refs;
+    size_t size;
+    int height;
+} node_t;
+
+struct persistent_map_t {
+    node_t *root;
+    compare_t compare;
+};
+
+typedef struct persistent_map_iterator_t {
+    iterator_t iterator;
+    node_t *stack[MAX_HEIGHT];
+    size_t top;
+} persistent_map_iterator_t;
+
+/**
+ * @brief Create an entry_t object holding one reference.
+ * @param pair The pair_t object.
+ * @return Returns the entry_t object if create successfully, otherwise returns NULL.
+ */
+static entry_t *__entry_new(pair_t *pair) {
+    entry_t *entry = (entry_t *)malloc(sizeof(entry_t));
+    return_value_if_fail(entry != NULL, NULL);
+
+    entry->pair = pair;
+    entry->refs = 1;
+    return entry;
+}
+
+/**
+ * @brief Drop one reference to an entry_t object, destroying it and its pair with the last one.
+ * @param entry The entry_t object.
+ */
+static void __entry_release(entry_t *entry) {
+    return_if(--entry->refs > 0);
+    pair_delete(entry->pair);
+    free(entry);
+}
+
+/**
+ * @brief Get the key of a node_t object.
+ * @param node The node_t object.
+ * @return Returns the key.
+ */
+static T __key(const node_t *node) {
+    return pair_get_key(node->entry->pair);
+}
+
+/**
+ * @brief Get the height of a node_t object.
+ * @param node The node_t object, or NULL.
+ * @return Returns the height, 0 for NULL.
+ */
+static int __height(const node_t *node) {
+    return node == NULL ? 0 : node->height;
+}
+
+/**
+ * @brief Get the subtree size of a node_t object.
+ * @param node The node_t object, or NULL.
+ * @return Returns the number of nodes in the subtree, 0 for NULL.
+ */
+static size_t __size(const node_t *node) {
+    return node == NULL ? 0 : node->size;
+}
+
+/**
+ * @brief Take one more reference to a node_t object.
+ * @param node The node_t object, or NULL.
+ * @return Returns the node_t object.
+ */
+static node_t *__retain(node_t *node) {
+    if (node != NULL) {
+        node->refs++;
+    }
+    return node;
+}
+
+/**
+ * @brief Drop one reference to a node_t object, destroying it with the last one.
+ * @param node The node_t object, or NULL.
+ */
+static void __release(node_t *node) {
+    return_if(node == NULL);
+    return_if(--node->refs > 0);
+
+    __entry_release(node->entry);
+    __release(node->left);
+    __release(node->right);
+    free(node);
+}
+
+/**
+ * @brief Create a node_t object.
+ *        The node takes over the references to `left` and `right`, even if the creation fails.
+ * @param entry The entry_t object.
+ * @param left The left subtree.
+ * @param right The right subtree.
+ * @return Returns the node_t object if create successfully, otherwise returns NULL.
+ */
+static node_t *__node_new(entry_t *entry, node_t *left, node_t *right) {
+    node_t *node = (node_t *)malloc(sizeof(node_t));
+    if (node == NULL) {
+        __release(left);
+        __release(right);
+        return NULL;
+    }
+
+    entry->refs++;
+    node->entry = entry;
+    node->left = left;
+    node->right = right;
+    node->refs = 1;
+    node->size = __size(left) + __size(right) + 1;
+    node->height = max(__height(left), __height(right)) + 1;
+    return node;
+}
+
+/**
+ * @brief Create a node_t object whose left subtree is two levels higher than the right one.
+ * @param entry The entry_t object.
+ * @param left The left subtree.
+ * @param right The right subtree.
+ * @return Returns the balanced node_t object if create successfully, otherwise returns NULL.
+ */
+static node_t *__rotate_right(entry_t *entry, node_t *left, node_t *right) {
+    node_t *child = NULL;
+    node_t *sibling = NULL;
+    node_t *node = NULL;
+
+    if (__height(left->left) >= __height(left->right)) {
+        child = __node_new(entry, __retain(left->right), right);
+        if (child != NULL) {
+            node = __node_new(left->entry, __retain(left->left), child);
+        }
+    } else {
+        sibling = __node_new(left->entry, __retain(left->left), __retain(left->right->left));
+        if (sibling == NULL) {
+            __release(right);
+        } else {
+            child = __node_new(entry, __retain(left->right->right), right);
+            if (child == NULL) {
+                __release(sibling);
+            } else {
+                node = __node_new(left->right->entry, sibling, child);
+            }
+        }
+    }
+
+    __release(left);
+    return node;
+}
+
+/**
+ * @brief Create a node_t object whose right subtree is two levels higher than the left one.
+ * @param entry The entry_t object.
+ * @param left The left subtree.
+ * @param right The right subtree.
+ * @return Returns the balanced node_t object if create successfully, otherwise returns NULL.
+ */
+static node_t *__rotate_left(entry_t *entry, node_t *left, node_t *right) {
+    node_t *child = NULL;
+    node_t *sibling = NULL;
+    node_t *node = NULL;
+
+    if (__height(right->right) >= __height(right->left)) {
+        child = __node_new(entry, left, __retain(right->left));
+        if (child != NULL) {
+            node = __node_new(right->entry, child, __retain(right->right));
+        }
+    } else {
+        sibling = __node_new(right->entry, __retain(right->left->right), __retain(right->right));
+        if (sibling == NULL) {
+            __release(left);
+        } else {
+            child = __node_new(entry, left, __retain(right->left->left));
+            if (child == NULL) {
+                __release(sibling);
+            } else {
+                node = __node_new(right->left->entry, child, sibling);
+            }
+        }
+    }
+
+    __release(right);
+    return node;
+}
+
+/**
+ * @brief Create a balanced node_t object from an entry and two subtrees whose heights differ by at most 2.
+ *        The node takes over the references to `left` and `right`, even if the creation fails.
+ * @param entry The entry_t object.
+ * @param left The left subtree.
+ * @param right The right subtree.
+ * @return Returns the node_t object if create successfully, otherwise returns NULL.
+ */
+static node_t *__balance(entry_t *entry, node_t *left, node_t *right) {
+    if (__height(left) > __height(right) + 1) {
+        return __rotate_right(entry, left, right);
+    }
+    if (__height(right) > __height(left) + 1) {
+        return __rotate_left(entry, left, right);
+    }
+    return __node_new(entry, left, right);
+}
+
+/**
+ * @brief Copy the path to the key of an entry, putting the entry at its end.
+ * @param compare Callback function for comparing two keys.
+ * @param node The root of the subtree.
+ * @param entry The entry_t object.
+ * @return Returns the new root of the subtree if successful, otherwise returns NULL.
+ */
+static node_t *__insert(compare_t compare, node_t *node, entry_t *entry) {
+    node_t *child = NULL;
+    int cmp = 0;
+
+    if (node == NULL) {
+        return __node_new(entry, NULL, NULL);
+    }
+
+    cmp = compare(pair_get_key(entry->pair), __key(node));
+    if (cmp < 0) {
+        child = __insert(compare, node->left, entry);
+        return_value_if_fail(child != NULL, NULL);
+        return __balance(node->entry, child, __retain(node->right));
+    }
+    if (cmp > 0) {
+        child = __insert(compare, node->right, entry);
+        return_value_if_fail(child != NULL, NULL);
+        return __balance(node->entry, __retain(node->left), child);
+    }
+
+    /* Key already exists, the new version refers to the new pair */
+    return __node_new(entry, __retain(node->left), __retain(node->right));
+}
+
+/**
+ * @brief Copy the path to the minimum of a non-empty subtree, leaving the minimum out.
+ * @param node The root of the subtree.
+ * @param result The new root of the subtree, which may be NULL.
+ * @return Returns true if successful, otherwise returns false.
+ */
+static bool __remove_min(node_t *node, node_t **result) {
+    node_t *child = NULL;
+
+    if (node->left == NULL) {
+        *result = __retain(node->right);
+        return true;
+    }
+
+    return_value_if_fail(__remove_min(node->left, &child), false);
+    *result = __balance(node->entry, child, __retain(node->right));
+    return *result != NULL;
+}
+
+/**
+ * @brief Copy the path to an existing key, leaving its node out.
+ * @param compare Callback function for comparing two keys.
+ * @param node The root of the subtree.
+ * @param key The key.
+ * @param result The new root of the subtree, which may be NULL.
+ * @return Returns true if successful, otherwise returns false.
+ */
+static bool __remove(compare_t compare, node_t *node, T key, node_t **result) {
+    node_t *child = NULL;
+    node_t *min = NULL;
+    int cmp = 0;
+
+    cmp = compare(key, __key(node));
+    if (cmp < 0) {
+        return_value_if_fail(__remove(compare, node->left, key, &child), false);
+        *result = __balance(node->entry, child, __retain(node->right));
+        return *result != NULL;
+    }
+    if (cmp > 0) {
+        return_value_if_fail(__remove(compare, node->right, key, &child), false);
+        *result = __balance(node->entry, __retain(node->left), child);
+        return *result != NULL;
+    }
+
+    if (node->left == NULL) {
+        *result = __retain(node->right);
+        return true;
+    }
+    if (node->right == NULL) {
+        *result = __retain(node->left);
+        return true;
+    }
+
+    /* Replace the node by its successor */
+    min = node->right;
+    while (min->left != NULL) {
+        min = min->left;
+    }
+    return_value_if_fail(__remove_min(node->right, &child), false);
+    *result = __balance(min->entry, __retain(node->left), child);
+    return *result != NULL;
+}
+
+/**
+ * @brief Find the node of a key.
+ * @param map The persistent_map_t object.
+ * @param key The key.
+ * @return Returns the node_t object if found, otherwise returns NULL.
+ */
+static node_t *__find(const persistent_map_t *map, T key) {
+    node_t *node = map->root;
+    int cmp = 0;
+
+    while (node != NULL) {
+        cmp = map->compare(key, __key(node));
+        if (cmp == 0) {
+            break;
+        }
+        node = cmp < 0 ? node->left : node->right;
+    }
+    return node;
+}
+
+/**
+ * @brief Create a version of a persistent_map_t object.
+ *        The version takes over the reference to `root`, even if the creation fails.
+ * @param compare Callback function for comparing two keys.
+ * @param root The root node.
+ * @return Returns the created persistent_map_t object if successful, otherwise returns NULL.
+ */
+static persistent_map_t *__persistent_map_new(compare_t compare, node_t *root) {
+    persistent_map_t *map = (persistent_map_t *)malloc(sizeof(persistent_map_t));
+    if (map == NULL) {
+        __release(root);
+        return NULL;
+    }
+
+    map->root = root;
+    map->compare = compare;
+    return map;
+}
+
+/**
+ * @brief Create an empty persistent_map_t object.
+ * @param compare Callback function for comparing two keys.
+ * @return Returns the created persistent_map_t object if successful, otherwise returns NULL.
+ */
+persistent_map_t *persistent_map_new(compare_t compare) {
+    return_value_if_fail(compare != NULL, NULL);
+    return __persistent_map_new(compare, NULL);
+}
+
+/**
+ * @brief Destroy a version of a persistent_map_t object.
+ *        The pairs are destroyed once no remaining version refers to them.
+ * @param map The persistent_map_t object.
+ */
+void persistent_map_delete(persistent_map_t *map) {
+    return_if_fail(map != NULL);
+    __release(map->root);
+    free(map);
+}
+
+/**
+ * @brief Take a snapshot of a persistent_map_t object in O(1).
+ *        The snapshot shares every node with the original version.
+ * @param map The persistent_map_t object.
+ * @return Returns the snapshot if successful, otherwise returns NULL.
+ * @note Caller MUST destroy the returned persistent_map_t object.
+ */
+persistent_map_t *persistent_map_snapshot(const persistent_map_t *map) {
+    return_value_if_fail(map != NULL, NULL);
+    return __persistent_map_new(map->compare, __retain(map->root));
+}
+
+/**
+ * @brief Determine whether a persistent_map_t object is empty.
+ * @param map The persistent_map_t object.
+ * @return Returns true if the persistent_map_t object is empty, otherwise returns false.
+ */
+bool persistent_map_is_empty(const persistent_map_t *map) {
+    return_value_if_fail(map != NULL, true);
+    return map->root == NULL;
+}
+
+/**
+ * @brief Get the size of a persistent_map_t object.
+ * @param map The persistent_map_t object.
+ * @return Returns the size of the persistent_map_t object.
+ */
+size_t persistent_map_size(const persistent_map_t *map) {
+    return_value_if_fail(map != NULL, 0);
+    return __size(map->root);
+}
+
+/**
+ * @brief Traverse a subtree in order.
+ * @param node The root of the subtree.
+ * @param visit Callback function for visiting a key-value pair.
+ */
+static void __foreach(node_t *node, visit_pair_t visit) {
+    while (node != NULL) {
+        __foreach(node->left, visit);
+        visit(node->entry->pair);
+        node = node->right;
+    }
+}
+
+/**
+ * @brief Traverse a persistent_map_t object in ascending order of keys.
+ * @param map The persistent_map_t object.
+ * @param visit Callback function for visiting a key-value pair.
+ */
+void persistent_map_foreach(const persistent_map_t *map, visit_pair_t visit) {
+    return_if_fail(map != NULL && visit != NULL);
+    __foreach(map->root, visit);
+}
+
+/**
+ * @brief Check if a persistent_map_t object contains the specified key.
+ * @param map The persistent_map_t object.
+ * @param key The key.
+ * @return Returns true if the persistent_map_t object contains the specified key, otherwise returns false.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+bool persistent_map_contains(const persistent_map_t *map, T key) {
+    return_value_if_fail(map != NULL && key != NULL, false);
+    return __find(map, key) != NULL;
+}
+
+/**
+ * @brief Get the value of a key-value pair by given key.
+ * @param map The persistent_map_t object.
+ * @param key The key.
+ * @return Returns the value of the key-value pair if found, otherwise NULL.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+T persistent_map_get(const persistent_map_t *map, T key) {
+    node_t *node = NULL;
+
+    return_value_if_fail(map != NULL && key != NULL, NULL);
+
+    node = __find(map, key);
+    return_value_if(node == NULL, NULL);
+    return pair_get_value(node->entry->pair);
+}
+
+/**
+ * @brief Create a new version of a persistent_map_t object with a key-value pair put into it.
+ *        Only the O(log n) nodes on the path to the key are copied, the original version is unchanged.
+ * @param map The persistent_map_t object.
+ * @param pair The pair_t object.
+ * @return Returns the new version if successful, otherwise returns NULL.
+ * @note The new version takes ownership of the parameter `pair`.
+ * @note Caller MUST destroy the returned persistent_map_t object.
+ */
+persistent_map_t *persistent_map_put(const persistent_map_t *map, pair_t *pair) {
+    entry_t *entry = NULL;
+    node_t *root = NULL;
+
+    return_value_if_fail(map != NULL && pair != NULL, NULL);
+
+    entry = __entry_new(pair);
+    return_value_if_fail(entry != NULL, NULL);
+
+    /* The nodes take their own references, so the pair goes away with the entry if the copy fails */
+    root = __insert(map->compare, map->root, entry);
+    __entry_release(entry);
+    return_value_if_fail(root != NULL, NULL);
+
+    return __persistent_map_new(map->compare, root);
+}
+
+/**
+ * @brief Create a new version of a persistent_map_t object with a key-value pair removed by given key.
+ *        Only the O(log n) nodes on the path to the key are copied, the original version is unchanged.
+ * @param map The persistent_map_t object.
+ * @param key The key.
+ * @return Returns the new version if successful, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ * @note Caller MUST destroy the returned persistent_map_t object.
+ */
+persistent_map_t *persistent_map_remove(const persistent_map_t *map, T key) {
+    node_t *root = NULL;
+
+    return_value_if_fail(map != NULL && key != NULL, NULL);
+
+    if (__find(map, key) == NULL) {
+        return persistent_map_snapshot(map);
+    }
+
+    return_value_if_fail(__remove(map->compare, map->root, key, &root), NULL);
+    return __persistent_map_new(map->compare, root);
+}
+
+/**
+ * @brief Push a node and its chain of left children onto the stack of an iterator.
+ * @param iterator The persistent_map_iterator_t object.
+ * @param node The node_t object, or NULL.
+ */
+static void __push_left(persistent_map_iterator_t *iterator, node_t *node) {
+    while (node != NULL) {
+        iterator->stack[iterator->top++] = node;
+        node = node->left;
+    }
+}
+
+/**
+ * @brief Create an iterator for a persistent_map_t object in ascending order of keys.
+ * @param map The persistent_map_t object.
+ * @return Returns the iterator for container.
+ */
+iterator_t *persistent_map_iterator_new(const persistent_map_t *map) {
+    persistent_map_iterator_t *iterator = NULL;
+
+    return_value_if_fail(map != NULL, NULL);
+
+    iterator = (persistent_map_iterator_t *)malloc(sizeof(persistent_map_iterator_t));
+    return_value_if_fail(iterator != NULL, NULL);
+
+    iterator->iterator.container = (void *)map;
+    iterator->iterator.current = NULL;
+    iterator->top = 0;
+    __push_left(iterator, map->root);
+    return (iterator_t *)iterator;
+}
+
+/**
+ * @brief Destroy an iterator.
+ * @param iterator The iterator_t object.
+ */
+void persistent_map_iterator_delete(iterator_t *iterator) {
+    return_if_fail(iterator != NULL);
+    free(iterator);
+}
+
+/**
+ * @brief Determine whether an iterator has the next element.
+ * @param iterator The iterator_t object.
+ * @return Returns true if the iterator has the next element, otherwise returns false.
+ */
+bool persistent_map_iterator_has_next(const iterator_t *iterator) {
+    return_value_if_fail(iterator != NULL, false);
+    return ((const persistent_map_iterator_t *)iterator)->top > 0;
+}
+
+/**
+ * @brief Get the next element of an iterator.
+ * @param iterator The iterator_t object.
+ * @return Returns the next element of the iterator.
+ */
+T persistent_map_iterator_next(iterator_t *iterator) {
+    persistent_map_iterator_t *state = NULL;
+    node_t *node = NULL;
+
+    return_value_if_fail(iterator != NULL, NULL);
+    return_value_if_fail(persistent_map_iterator_has_next(iterator), NULL);
+
+    state = (persistent_map_iterator_t *)iterator;
+    node = state->stack[--state->top];
+    __push_left(state, node->right);
+    iterator->current = node;
+    return node->entry->pair;
+}
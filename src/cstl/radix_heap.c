@@ -0,0 +1,332 @@
+#include "cstl/radix_heap.h"
+#include "utils/numeric.h"
+#include <limits.h>
+
+#define BUCKETS (sizeof(unsigned long) * CHAR_BIT + 1)
+#define DEFAULT_CAPACITY 16
+#define GROWTH_FACTOR 2
+
+typedef struct entry_t {
+    unsigned long key;
+    T elem;
+} entry_t;
+
+typedef struct bucket_t {
+    entry_t *entries;
+    size_t size;
+    size_t capacity;
+} bucket_t;
+
+/* Bucket 0 holds the keys equal to `last`, bucket i the keys whose highest bit differing from `last` is bit i - 1 */
+struct radix_heap_t {
+    bucket_t buckets[BUCKETS];
+    size_t size;
+    unsigned long last;
+    destroy_t destroy;
+};
+
+/**
+ * @brief Create a radix_heap_t object.
+ * @param destroy Callback function for destroying a data item.
+ * @return Returns the created radix_heap_t object if successful, otherwise returns NULL.
+ */
+radix_heap_t *radix_heap_new(destroy_t destroy) {
+    radix_heap_t *heap = NULL;
+    size_t i = 0;
+
+    heap = (radix_heap_t *)malloc(sizeof(radix_heap_t));
+    return_value_if_fail(heap != NULL, NULL);
+
+    /* Buckets allocate on their first push, most of them are never used */
+    for (i = 0; i < BUCKETS; i++) {
+        heap->buckets[i].entries = NULL;
+        heap->buckets[i].size = 0;
+        heap->buckets[i].capacity = 0;
+    }
+
+    heap->size = 0;
+    heap->last = 0;
+    heap->destroy = destroy;
+    return heap;
+}
+
+/**
+ * @brief Destroy a radix_heap_t object.
+ * @param heap The radix_heap_t object.
+ */
+void radix_heap_delete(radix_heap_t *heap) {
+    size_t i = 0;
+
+    return_if_fail(heap != NULL);
+
+    radix_heap_clear(heap);
+    for (i = 0; i < BUCKETS; i++) {
+        free(heap->buckets[i].entries);
+    }
+    free(heap);
+}
+
+/**
+ * @brief Determine whether a radix_heap_t object is empty.
+ * @param heap The radix_heap_t object.
+ * @return Returns true if the radix_heap_t object is empty, otherwise returns false.
+ */
+bool radix_heap_is_empty(const radix_heap_t *heap) {
+    return_value_if_fail(heap != NULL, true);
+    return heap->size == 0;
+}
+
+/**
+ * @brief Get the size of a radix_heap_t object.
+ * @param heap The radix_heap_t object.
+ * @return Returns the size of the radix_heap_t object.
+ */
+size_t radix_heap_size(const radix_heap_t *heap) {
+    return_value_if_fail(heap != NULL, 0);
+    return heap->size;
+}
+
+/**
+ * @brief Clear a radix_heap_t object and reset its last popped key to 0.
+ * @param heap The radix_heap_t object.
+ * @return Returns the modified radix_heap_t object.
+ */
+radix_heap_t *radix_heap_clear(radix_heap_t *heap) {
+    bucket_t *bucket = NULL;
+    size_t i = 0;
+    size_t j = 0;
+
+    return_value_if_fail(heap != NULL, NULL);
+
+    for (i = 0; i < BUCKETS; i++) {
+        bucket = &heap->buckets[i];
+        if (heap->destroy != NULL) {
+            for (j = 0; j < bucket->size; j++) {
+                heap->destroy(bucket->entries[j].elem);
+            }
+        }
+        bucket->size = 0;
+    }
+
+    heap->size = 0;
+    heap->last = 0;
+    return heap;
+}
+
+/**
+ * @brief Get the last popped key of a radix_heap_t object, the smallest key that can still be pushed.
+ * @param heap The radix_heap_t object.
+ * @return Returns the last popped key, or 0 if nothing has been popped yet.
+ */
+unsigned long radix_heap_last_key(const radix_heap_t *heap) {
+    return_value_if_fail(heap != NULL, 0);
+    return heap->last;
+}
+
+/**
+ * @brief Get the number of significant bits of a value.
+ * @param value The value.
+ * @return Returns the position of the highest set bit plus one, or 0 if the value is 0.
+ */
+static size_t __bit_length(unsigned long value) {
+    size_t length = 0;
+    size_t shift = sizeof(unsigned long) * CHAR_BIT / 2;
+
+    /* Binary search for the highest set bit */
+    while (shift > 0) {
+        if ((value >> shift) != 0) {
+            value >>= shift;
+            length += shift;
+        }
+        shift /= 2;
+    }
+    return length + (value != 0);
+}
+
+/**
+ * @brief Make sure a bucket can hold a given number of entries.
+ * @param bucket The bucket.
+ * @param n The number of entries.
+ * @return Returns true if memory reallocation is successful, otherwise returns false.
+ */
+static bool __bucket_reserve(bucket_t *bucket, size_t n) {
+    size_t new_capacity;
+    entry_t *entries = NULL;
+
+    return_value_if(n <= bucket->capacity, true);
+
+    new_capacity = bucket->capacity == 0 ? DEFAULT_CAPACITY : bucket->capacity;
+    while (new_capacity < n) {
+        new_capacity *= GROWTH_FACTOR;
+    }
+
+    entries = (entry_t *)realloc(bucket->entries, sizeof(entry_t) * new_capacity);
+    return_value_if_fail(entries != NULL, false);
+
+    bucket->entries = entries;
+    bucket->capacity = new_capacity;
+    return true;
+}
+
+/**
+ * @brief Make bucket 0 non-empty by advancing `last` to the smallest key and redistributing its bucket.
+ * @param heap The radix_heap_t object, which MUST NOT be empty.
+ * @return Returns true if successful, otherwise returns false and leaves the heap unchanged.
+ */
+static bool __refill(radix_heap_t *heap) {
+    size_t counts[BUCKETS];
+    bucket_t *bucket = NULL;
+    bucket_t *target = NULL;
+    unsigned long key;
+    size_t i = 1;
+    size_t j = 0;
+
+    return_value_if(heap->buckets[0].size > 0, true);
+
+    while (heap->buckets[i].size == 0) {
+        i++;
+    }
+    bucket = &heap->buckets[i];
+
+    key = bucket->entries[0].key;
+    for (j = 1; j < bucket->size; j++) {
+        key = min(key, bucket->entries[j].key);
+    }
+
+    /*
+     * Every key of bucket i shares the bits above bit i - 1 with the new `last`, so each entry lands
+     * in a lower bucket. Size those buckets first, so running out of memory loses nothing.
+     */
+    for (j = 0; j < i; j++) {
+        counts[j] = 0;
+    }
+    for (j = 0; j < bucket->size; j++) {
+        counts[__bit_length(bucket->entries[j].key ^ key)]++;
+    }
+    for (j = 0; j < i; j++) {
+        return_value_if_fail(__bucket_reserve(&heap->buckets[j], heap->buckets[j].size + counts[j]), false);
+    }
+
+    heap->last = key;
+    for (j = 0; j < bucket->size; j++) {
+        target = &heap->buckets[__bit_length(bucket->entries[j].key ^ key)];
+        target->entries[target->size++] = bucket->entries[j];
+    }
+    bucket->size = 0;
+    return true;
+}
+
+/**
+ * @brief Find an entry with the smallest key without advancing `last`.
+ *        Later pushes may still use any key not smaller than the last popped key.
+ * @param heap The radix_heap_t object, which MUST NOT be empty.
+ * @return Returns the entry.
+ */
+static const entry_t *__min_entry(const radix_heap_t *heap) {
+    const bucket_t *bucket = NULL;
+    const entry_t *entry = NULL;
+    size_t i = 0;
+    size_t j = 0;
+
+    while (heap->buckets[i].size == 0) {
+        i++;
+    }
+    bucket = &heap->buckets[i];
+
+    /* Take the last of equal keys, which is the one pop returns after redistributing in order */
+    entry = &bucket->entries[0];
+    for (j = 1; j < bucket->size; j++) {
+        if (bucket->entries[j].key <= entry->key) {
+            entry = &bucket->entries[j];
+        }
+    }
+    return entry;
+}
+
+/**
+ * @brief Push an element with a key into a radix_heap_t object in O(1).
+ * @param heap The radix_heap_t object.
+ * @param key The key, which MUST NOT be smaller than the last popped key.
+ * @param elem The element, which may be NULL if only the keys matter (see radix_heap_pop_key()).
+ * @return Returns the modified radix_heap_t object, or NULL if the key is smaller than the last popped key.
+ * @note The element is not taken over if the key is rejected.
+ */
+radix_heap_t *radix_heap_push(radix_heap_t *heap, unsigned long key, T elem) {
+    bucket_t *bucket = NULL;
+
+    return_value_if_fail(heap != NULL, NULL);
+    return_value_if_fail(key >= heap->last, NULL);
+
+    bucket = &heap->buckets[__bit_length(key ^ heap->last)];
+    return_value_if_fail(__bucket_reserve(bucket, bucket->size + 1), NULL);
+
+    bucket->entries[bucket->size].key = key;
+    bucket->entries[bucket->size].elem = elem;
+    bucket->size++;
+    heap->size++;
+    return heap;
+}
+
+/**
+ * @brief Pop an element with the smallest key from a radix_heap_t object in O(1) amortized.
+ * @param heap The radix_heap_t object.
+ * @return Returns the popped element, or NULL if the radix_heap_t object is empty or out of memory.
+ * @note Caller MUST free the returned element (if applicable).
+ *       Use radix_heap_pop_key() to tell a NULL element from a failed pop.
+ */
+T radix_heap_pop(radix_heap_t *heap) {
+    T elem = NULL;
+
+    return_value_if_fail(radix_heap_pop_key(heap, NULL, &elem), NULL);
+    return elem;
+}
+
+/**
+ * @brief Pop an element with the smallest key and the key itself from a radix_heap_t object in O(1) amortized.
+ * @param heap The radix_heap_t object.
+ * @param key Output parameter for the popped key, or NULL if not needed.
+ * @param elem Output parameter for the popped element, or NULL if not needed.
+ * @return Returns true if an element was popped, otherwise returns false if the radix_heap_t object is empty
+ *         or out of memory, in which case the outputs are left untouched.
+ * @note Caller MUST free the popped element (if applicable).
+ */
+bool radix_heap_pop_key(radix_heap_t *heap, unsigned long *key, T *elem) {
+    bucket_t *bucket = NULL;
+
+    return_value_if_fail(heap != NULL && heap->size > 0, false);
+    return_value_if_fail(__refill(heap), false);
+
+    bucket = &heap->buckets[0];
+    bucket->size--;
+    heap->size--;
+    if (key != NULL) {
+        *key = bucket->entries[bucket->size].key;
+    }
+    if (elem != NULL) {
+        *elem = bucket->entries[bucket->size].elem;
+    }
+    return true;
+}
+
+/**
+ * @brief Peek an element with the smallest key of a radix_heap_t object.
+ *        Unless it is the last popped key, the smallest key is found by scanning the lowest non-empty bucket.
+ * @param heap The radix_heap_t object.
+ * @return Returns the element.
+ */
+T radix_heap_peek(const radix_heap_t *heap) {
+    return_value_if_fail(heap != NULL && heap->size > 0, NULL);
+    return __min_entry(heap)->elem;
+}
+
+/**
+ * @brief Peek the smallest key of a radix_heap_t object.
+ *        Unless it is the last popped key, the smallest key is found by scanning the lowest non-empty bucket.
+ * @param heap The radix_heap_t object.
+ * @return Returns the smallest key, or the last popped key if the radix_heap_t object is empty.
+ */
+unsigned long radix_heap_peek_key(const radix_heap_t *heap) {
+    return_value_if_fail(heap != NULL, 0);
+    return_value_if(heap->size == 0, heap->last);
+    return __min_entry(heap)->key;
+}
@@ -1,4 +1,6 @@
 #include "cstl/red_black_tree.h"
+#include "utils/numeric.h"
+#include "utils/pool.h"
 
 typedef enum {
     RED,
@@ -11,17 +13,27 @@ typedef struct node_t {
     struct node_t *left;
     struct node_t *right;
     struct node_t *parent;
+    size_t size;
 } node_t;
 
 struct red_black_tree_t {
     node_t *root;
     size_t size;
     compare_t compare;
+    key_of_t key_of;
     destroy_t destroy;
+    pool_t *pool;
 };
 
+typedef struct red_black_tree_iterator_t {
+    iterator_t iterator;
+    node_t *end;
+    bool reverse;
+} red_black_tree_iterator_t;
+
 /**
  * @brief Create a node_t object.
+ * @param tree The red_black_tree_t object which owns the node.
  * @param key The key.
  * @param color The color (RED/BLACK).
  * @param left The pointer to the left child.
@@ -29,8 +41,8 @@ struct red_black_tree_t {
  * @param parent The pointer to the parent.
  * @return Returns the node_t object if create successfully, otherwise returns NULL.
  */
-static node_t *__node_new(T key, color_t color, node_t *left, node_t *right, node_t *parent) {
-    node_t *node = (node_t *)malloc(sizeof(node_t));
+static node_t *__node_new(red_black_tree_t *tree, T key, color_t color, node_t *left, node_t *right, node_t *parent) {
+    node_t *node = (node_t *)pool_alloc(tree->pool);
     return_value_if_fail(node != NULL, NULL);
 
     node->key = key;
@@ -38,22 +50,17 @@ static node_t *__node_new(T key, color_t color, node_t *left, node_t *right, nod
     node->left = left;
     node->right = right;
     node->parent = parent;
+    node->size = 1;
     return node;
 }
 
 /**
- * @brief Destroy a node_t object.
- * @param tree The red_black_tree_t object.
+ * @brief Destroy a node_t object without destroying its key.
+ * @param tree The red_black_tree_t object which owns the node.
  * @param node The node_t object.
  */
 static void __node_delete(red_black_tree_t *tree, node_t *node) {
-    return_if_fail(tree != NULL && node != NULL);
-    __node_delete(tree, node->left);
-    __node_delete(tree, node->right);
-    if (tree->destroy != NULL) {
-        tree->destroy(node->key);
-    }
-    free(node);
+    pool_free(tree->pool, node);
 }
 
 /**
@@ -66,6 +73,120 @@ static color_t __node_color(node_t *node) {
     return node->color;
 }
 
+/**
+ * @brief Get the number of nodes in the subtree rooted at the node.
+ * @param node The node_t object.
+ * @return Returns the size of the subtree. For NIL nodes, returns 0.
+ */
+static size_t __node_size(const node_t *node) {
+    return_value_if_fail(node != NULL, 0);
+    return node->size;
+}
+
+/**
+ * @brief Get the ordering key of a data item.
+ * @param tree The red_black_tree_t object.
+ * @param data The data item.
+ * @return Returns the key extracted by `key_of`, or the data item itself if there is no key extractor.
+ */
+static T __key(const red_black_tree_t *tree, T data) {
+    if (tree->key_of == NULL) {
+        return data;
+    }
+    return tree->key_of(data);
+}
+
+/**
+ * @brief Compare a key with the key of a node.
+ * @param tree The red_black_tree_t object.
+ * @param key The key.
+ * @param node The node_t object.
+ * @return Returns negative value if the key is less than the key of the node.
+ *         Returns 0 if the key is equal to the key of the node.
+ *         Returns positive value if the key is greater than the key of the node.
+ */
+static int __compare(const red_black_tree_t *tree, T key, const node_t *node) {
+    return tree->compare(key, __key(tree, node->key));
+}
+
+/**
+ * @brief Get the minimum node in the red_black_tree_t object.
+ * @param node The node_t object.
+ * @return Returns the minimum node if exists, otherwise returns NULL.
+ */
+static node_t *__min_node(const node_t *node) {
+    node_t *min_node = NULL;
+
+    return_value_if_fail(node != NULL, NULL);
+
+    min_node = (node_t *)node;
+    while (min_node->left != NULL) {
+        min_node = min_node->left;
+    }
+    return min_node;
+}
+
+/**
+ * @brief Get the maximum node in the red_black_tree_t object.
+ * @param node The node_t object.
+ * @return Returns the maximum node if exists, otherwise returns NULL.
+ */
+static node_t *__max_node(const node_t *node) {
+    node_t *max_node = NULL;
+
+    return_value_if_fail(node != NULL, NULL);
+
+    max_node = (node_t *)node;
+    while (max_node->right != NULL) {
+        max_node = max_node->right;
+    }
+    return max_node;
+}
+
+/**
+ * @brief Get the successor of a node.
+ * @param node The node_t object.
+ * @return Returns the successor of a node if exists, otherwise returns NULL.
+ */
+static node_t *__successor(node_t *node) {
+    node_t *successor = NULL;
+
+    return_value_if_fail(node != NULL, NULL);
+
+    if (node->right != NULL) {
+        return __min_node(node->right);
+    }
+
+    successor = node->parent;
+    while (successor != NULL && node == successor->right) {
+        node = successor;
+        successor = successor->parent;
+    }
+    return successor;
+}
+
+/**
+ * @brief Get the predecessor of a node.
+ * @param node The node_t object.
+ * @return Returns the predecessor of a node if exists, otherwise returns NULL.
+ */
+static node_t *__predecessor(node_t *node) {
+    node_t *predecessor = NULL;
+
+    return_value_if_fail(node != NULL, NULL);
+
+    if (node->left != NULL) {
+        return __max_node(node->left);
+    }
+
+    predecessor = node->parent;
+    while (predecessor != NULL && node == predecessor->left) {
+        node = predecessor;
+        predecessor = predecessor->parent;
+    }
+    return predecessor;
+}
+
 /**
  * @brief Create a red_black_tree_t object.
  * @param compare Callback function for comparing two data items.
@@ -73,6 +194,19 @@ static color_t __node_color(node_t *node) {
  * @return Returns the red_black_tree_t object if create successfully, otherwise returns NULL.
  */
 red_black_tree_t *red_black_tree_new(compare_t compare, destroy_t destroy) {
+    return red_black_tree_new_with_key(compare, NULL, destroy);
+}
+
+/**
+ * @brief Create a red_black_tree_t object which orders data items by an extracted key.
+ * @param compare Callback function for comparing two keys.
+ * @param key_of Callback function for extracting the key from a data item, or NULL to compare data items directly.
+ * @param destroy Callback function for destroying a data item.
+ * @return Returns the red_black_tree_t object if create successfully, otherwise returns NULL.
+ * @note The comparator and key extractor are stored per tree, so trees with different orderings can coexist.
+ *       Lookup and removal functions take the raw key rather than a whole data item.
+ */
+red_black_tree_t *red_black_tree_new_with_key(compare_t compare, key_of_t key_of, destroy_t destroy) {
     red_black_tree_t *tree = NULL;
 
     return_value_if_fail(compare != NULL, NULL);
@@ -80,20 +214,246 @@ red_black_tree_t *red_black_tree_new(compare_t compare, destroy_t destroy) {
     tree = (red_black_tree_t *)malloc(sizeof(red_black_tree_t));
     return_value_if_fail(tree != NULL, NULL);
 
+    tree->pool = pool_new(sizeof(node_t));
+    if (tree->pool == NULL) {
+        free(tree);
+        return NULL;
+    }
+
     tree->root = NULL;
     tree->size = 0;
     tree->compare = compare;
+    tree->key_of = key_of;
     tree->destroy = destroy;
     return tree;
 }
 
+/**
+ * @brief Link the data items in [low, high) into a perfectly balanced subtree.
+ *        Nodes on the deepest level are red and all others are black, so every path has the same black height.
+ * @param tree The red_black_tree_t object.
+ * @param data The data items in strictly ascending order.
+ * @param low The first index.
+ * @param high The index past the last one.
+ * @param depth The depth of the subtree root.
+ * @param height The depth of the deepest level.
+ * @param parent The parent of the subtree root.
+ * @return Returns the subtree root, or NULL if the range is empty.
+ */
+static node_t *__build(red_black_tree_t *tree, T *data, size_t low, size_t high, size_t depth, size_t height, node_t *parent) {
+    node_t *node = NULL;
+    size_t mid = 0;
+
+    return_value_if(low >= high, NULL);
+
+    mid = low + (high - low) / 2;
+    node = __node_new(tree, data[mid], depth == height && depth > 0 ? RED : BLACK, NULL, NULL, parent);
+    return_value_if_fail(node != NULL, NULL);
+    tree->size++;
+
+    node->left = __build(tree, data, low, mid, depth + 1, height, node);
+    node->right = __build(tree, data, mid + 1, high, depth + 1, height, node);
+    node->size = high - low;
+    return node;
+}
+
+/**
+ * @brief Create a red_black_tree_t object from data items in strictly ascending order in O(n).
+ * @param compare Callback function for comparing two keys.
+ * @param key_of Callback function for extracting the key from a data item, or NULL to compare data items directly.
+ * @param destroy Callback function for destroying a data item.
+ * @param data The data items.
+ * @param n The number of data items.
+ * @return Returns the red_black_tree_t object if create successfully, otherwise returns NULL.
+ */
+static red_black_tree_t *__new_from_sorted(compare_t compare, key_of_t key_of, destroy_t destroy, T *data, size_t n) {
+    red_black_tree_t *tree = NULL;
+    size_t height = 0;
+    size_t m = 0;
+
+    tree = red_black_tree_new_with_key(compare, key_of, destroy);
+    return_value_if_fail(tree != NULL, NULL);
+
+    for (m = n; m > 1; m >>= 1) {
+        height++;
+    }
+    tree->root = __build(tree, data, 0, n, 0, height, NULL);
+
+    /* out of memory, hand the data items back untouched */
+    if (tree->size != n) {
+        tree->destroy = NULL;
+        red_black_tree_delete(tree);
+        return NULL;
+    }
+    return tree;
+}
+
+/**
+ * @brief Copy the data items of an array_t object into a new buffer.
+ * @param array The array_t object.
+ * @return Returns the buffer if successful, otherwise returns NULL.
+ * @note Caller MUST free the returned buffer.
+ */
+static T *__copy_array(const array_t *array) {
+    T *data = NULL;
+    size_t n = array_size(array);
+    size_t i = 0;
+
+    data = (T *)malloc(max(n, 1) * sizeof(T));
+    return_value_if_fail(data != NULL, NULL);
+
+    for (i = 0; i < n; i++) {
+        data[i] = array_get(array, i);
+    }
+    return data;
+}
+
+/**
+ * @brief Create a red_black_tree_t object from the data items of an array_t object in strictly ascending order.
+ *        The tree is linked level by level in O(n) without a single comparison-driven insert or rotation.
+ * @param compare Callback function for comparing two keys.
+ * @param key_of Callback function for extracting the key from a data item, or NULL to compare data items directly.
+ * @param destroy Callback function for destroying a data item.
+ * @param array The array_t object.
+ * @return Returns the red_black_tree_t object if create successfully, otherwise returns NULL,
+ *         including when the data items are not in strictly ascending order.
+ * @note The tree takes over the data items if successful. Caller MUST NOT destroy them through the array
+ *       afterwards (e.g. create the array with a NULL destroy callback).
+ */
+red_black_tree_t *red_black_tree_new_from_sorted(compare_t compare, key_of_t key_of, destroy_t destroy, const array_t *array) {
+    red_black_tree_t *tree = NULL;
+    T *data = NULL;
+    size_t n = 0;
+    size_t i = 0;
+
+    return_value_if_fail(compare != NULL && array != NULL, NULL);
+
+    data = __copy_array(array);
+    return_value_if_fail(data != NULL, NULL);
+
+    n = array_size(array);
+    for (i = 1; i < n; i++) {
+        if (key_of == NULL ? compare(data[i - 1], data[i]) >= 0 : compare(key_of(data[i - 1]), key_of(data[i])) >= 0) {
+            free(data);
+            return NULL;
+        }
+    }
+
+    tree = __new_from_sorted(compare, key_of, destroy, data, n);
+    free(data);
+    return tree;
+}
+
+/**
+ * @brief Merge two adjacent sorted runs by key.
+ * @param tree The red_black_tree_t object which provides the comparator.
+ * @param src The source buffer.
+ * @param dst The destination buffer.
+ * @param left The start of the left run.
+ * @param mid The start of the right run.
+ * @param right The end of the right run.
+ */
+static void __merge(const red_black_tree_t *tree, T *src, T *dst, size_t left, size_t mid, size_t right) {
+    size_t i = left;
+    size_t j = mid;
+    size_t k = left;
+
+    while (i < mid && j < right) {
+        if (tree->compare(__key(tree, src[j]), __key(tree, src[i])) < 0) {
+            dst[k++] = src[j++];
+        } else {
+            dst[k++] = src[i++];
+        }
+    }
+    while (i < mid) {
+        dst[k++] = src[i++];
+    }
+    while (j < right) {
+        dst[k++] = src[j++];
+    }
+}
+
+/**
+ * @brief Create a red_black_tree_t object from the data items of an array_t object in any order.
+ *        The data items are merge sorted by key in O(n log n) and the tree is then linked in O(n).
+ * @param compare Callback function for comparing two keys.
+ * @param key_of Callback function for extracting the key from a data item, or NULL to compare data items directly.
+ * @param destroy Callback function for destroying a data item.
+ * @param array The array_t object.
+ * @param replace Whether a later data item replaces an earlier one with an equal key, like red_black_tree_put.
+ *                Otherwise later data items are discarded, like red_black_tree_insert.
+ * @return Returns the red_black_tree_t object if create successfully, otherwise returns NULL.
+ * @note The tree takes over the data items if successful, and destroys the discarded ones (if applicable).
+ *       Caller MUST NOT destroy them through the array afterwards (e.g. create the array with a NULL destroy callback).
+ *       On failure no data item is destroyed and the caller keeps all of them.
+ */
+red_black_tree_t *red_black_tree_new_from_array(compare_t compare, key_of_t key_of, destroy_t destroy, const array_t *array, bool replace) {
+    red_black_tree_t *tree = NULL;
+    T *data = NULL;
+    T *buffer = NULL;
+    size_t n = 0;
+    size_t width = 0;
+    size_t left = 0;
+    size_t kept = 0;
+    size_t dropped = 0;
+    size_t i = 0;
+
+    return_value_if_fail(compare != NULL && array != NULL, NULL);
+
+    /* An empty tree only serves as the holder of the comparator and key extractor while sorting */
+    tree = red_black_tree_new_with_key(compare, key_of, destroy);
+    return_value_if_fail(tree != NULL, NULL);
+
+    n = array_size(array);
+    data = __copy_array(array);
+    buffer = (T *)malloc(max(n, 1) * sizeof(T));
+    if (data == NULL || buffer == NULL) {
+        free(data);
+        free(buffer);
+        red_black_tree_delete(tree);
+        return NULL;
+    }
+
+    for (width = 1; width < n; width *= 2) {
+        for (left = 0; left < n; left += 2 * width) {
+            __merge(tree, data, buffer, left, min(left + width, n), min(left + 2 * width, n));
+        }
+        swap(data, buffer, T *);
+    }
+
+    /* The sort is stable, so equal keys keep their order in the array.
+       The discarded data items are set aside in the spare buffer until the tree is built. */
+    for (i = 0; i < n; i++) {
+        if (kept > 0 && compare(__key(tree, data[kept - 1]), __key(tree, data[i])) == 0) {
+            if (replace) {
+                swap(data[kept - 1], data[i], T);
+            }
+            buffer[dropped++] = data[i];
+        } else {
+            data[kept++] = data[i];
+        }
+    }
+    red_black_tree_delete(tree);
+
+    tree = __new_from_sorted(compare, key_of, destroy, data, kept);
+    if (tree != NULL && destroy != NULL) {
+        for (i = 0; i < dropped; i++) {
+            destroy(buffer[i]);
+        }
+    }
+    free(data);
+    free(buffer);
+    return tree;
+}
+
 /**
  * @brief Destroy a red_black_tree_t object.
  * @param tree The red_black_tree_t object.
  */
 void red_black_tree_delete(red_black_tree_t *tree) {
     return_if_fail(tree != NULL);
-    __node_delete(tree, tree->root);
+    red_black_tree_clear(tree);
+    pool_delete(tree->pool);
     free(tree);
 }
 
@@ -123,8 +483,18 @@ size_t red_black_tree_size(const red_black_tree_t *tree) {
  * @return Returns the modified red_black_tree_t object.
  */
 red_black_tree_t *red_black_tree_clear(red_black_tree_t *tree) {
+    node_t *node = NULL;
+
     return_value_if_fail(tree != NULL, NULL);
-    __node_delete(tree, tree->root);
+
+    /* Nodes are released in bulk with their slabs, so only the keys need a visit */
+    if (tree->destroy != NULL) {
+        for (node = __min_node(tree->root); node != NULL; node = __successor(node)) {
+            tree->destroy(node->key);
+        }
+    }
+    pool_clear(tree->pool);
+
     tree->root = NULL;
     tree->size = 0;
     return tree;
@@ -138,24 +508,8 @@ red_black_tree_t *red_black_tree_clear(red_black_tree_t *tree) {
  * @note Caller MUST free the parameter `key` (if applicable).
  */
 bool red_black_tree_contains(const red_black_tree_t *tree, T key) {
-    node_t *node = NULL;
-    int cmp;
-
     return_value_if_fail(tree != NULL, false);
-    return_value_if_fail(tree->compare != NULL, false);
-
-    node = tree->root;
-    while (node != NULL) {
-        cmp = tree->compare(key, node->key);
-        if (cmp < 0) {
-            node = node->left;
-        } else if (cmp > 0) {
-            node = node->right;
-        } else {
-            return true;
-        }
-    }
-    return false;
+    return red_black_tree_find(tree, key) != NULL;
 }
 
 /**
@@ -228,6 +582,9 @@ static void __left_rotate(red_black_tree_t *tree, node_t *x) {
     }
     y->left = x;
     x->parent = y;
+
+    y->size = x->size;
+    x->size = __node_size(x->left) + __node_size(x->right) + 1;
 }
 
 /**
@@ -256,6 +613,9 @@ static void __right_rotate(red_black_tree_t *tree, node_t *x) {
     }
     y->right = x;
     x->parent = y;
+
+    y->size = x->size;
+    x->size = __node_size(x->left) + __node_size(x->right) + 1;
 }
 
 /**
@@ -301,49 +661,57 @@ static void __insert_fixup(red_black_tree_t *tree, node_t *node) {
 }
 
 /**
- * @brief Inserts a key into the red-black tree.
+ * @brief Insert a data item, or handle an existing data item with an equal key.
+ *        The tree is walked only once in both cases.
  * @param tree The red_black_tree_t object.
- * @param key The key.
+ * @param data The data item.
+ * @param replace Whether an existing data item with an equal key is replaced by the new one.
+ *                Otherwise the new data item is discarded.
  * @return Returns the modified red_black_tree_t object.
  */
-red_black_tree_t *red_black_tree_insert(red_black_tree_t *tree, T key) {
+static red_black_tree_t *__insert(red_black_tree_t *tree, T data, bool replace) {
     node_t *node = NULL;
     node_t *current = NULL;
     node_t *parent = NULL;
+    T key = NULL;
     int cmp;
 
-    return_value_if_fail(tree != NULL && key != NULL, tree);
-    return_value_if_fail(tree->compare != NULL, tree);
+    return_value_if_fail(tree != NULL && data != NULL, tree);
+
+    key = __key(tree, data);
+    current = tree->root;
+    while (current != NULL) {
+        parent = current;
+        cmp = __compare(tree, key, current);
+        if (cmp < 0) {
+            current = current->left;
+        } else if (cmp > 0) {
+            current = current->right;
+        } else {
+            /* key already exists, keep one of the two data items in the node */
+            if (replace) {
+                swap(current->key, data, T);
+            }
+            if (tree->destroy != NULL) {
+                tree->destroy(data);
+            }
+            return tree;
+        }
+    }
 
-    node = __node_new(key, RED, NULL, NULL, NULL);
+    node = __node_new(tree, data, RED, NULL, NULL, parent);
     return_value_if_fail(node != NULL, tree);
 
-    if (tree->root == NULL) {
+    if (parent == NULL) {
         tree->root = node;
+    } else if (cmp < 0) {
+        parent->left = node;
     } else {
-        current = tree->root;
-        parent = NULL;
-
-        while (current != NULL) {
-            parent = current;
-            cmp = tree->compare(key, current->key);
-            if (cmp < 0) {
-                current = current->left;
-            } else if (cmp > 0) {
-                current = current->right;
-            } else {
-                __node_delete(tree, node);
-                return tree;
-            }
-        }
+        parent->right = node;
+    }
 
-        node->parent = parent;
-        cmp = tree->compare(key, parent->key);
-        if (cmp < 0) {
-            parent->left = node;
-        } else {
-            parent->right = node;
-        }
+    for (current = parent; current != NULL; current = current->parent) {
+        current->size++;
     }
 
     __insert_fixup(tree, node);
@@ -352,20 +720,25 @@ red_black_tree_t *red_black_tree_insert(red_black_tree_t *tree, T key) {
 }
 
 /**
- * @brief Get the minimum node in the red_black_tree_t object.
- * @param node The node_t object.
- * @return Returns the minimum node if exists, otherwise returns NULL.
+ * @brief Inserts a key into the red-black tree.
+ *        If the tree already contains an equal key, the new key is destroyed (if applicable).
+ * @param tree The red_black_tree_t object.
+ * @param key The key.
+ * @return Returns the modified red_black_tree_t object.
  */
-static node_t *__min_node(const node_t *node) {
-    node_t *min_node = NULL;
-
-    return_value_if_fail(node != NULL, NULL);
+red_black_tree_t *red_black_tree_insert(red_black_tree_t *tree, T key) {
+    return __insert(tree, key, false);
+}
 
-    min_node = (node_t *)node;
-    while (min_node->left != NULL) {
-        min_node = min_node->left;
-    }
-    return min_node;
+/**
+ * @brief Inserts a data item into the red-black tree, or replaces the data item with an equal key in place.
+ *        The replaced data item is destroyed (if applicable).
+ * @param tree The red_black_tree_t object.
+ * @param data The data item.
+ * @return Returns the modified red_black_tree_t object.
+ */
+red_black_tree_t *red_black_tree_put(red_black_tree_t *tree, T data) {
+    return __insert(tree, data, true);
 }
 
 /**
@@ -393,86 +766,75 @@ static void __transplant(red_black_tree_t *tree, node_t *u, node_t *v) {
 /**
  * @brief Fix the red-black tree after removal to maintain its properties.
  * @param tree The red_black_tree_t object.
- * @param x The node to fix up.
+ * @param x The node to fix up, which may be NIL.
+ * @param parent The parent of x, needed since x may be NIL.
  */
-static void __remove_fixup(red_black_tree_t *tree, node_t *x) {
+static void __remove_fixup(red_black_tree_t *tree, node_t *x, node_t *parent) {
     node_t *w = NULL;
 
-    return_if_fail(tree != NULL && x != NULL);
+    return_if_fail(tree != NULL);
 
     while (x != tree->root && __node_color(x) == BLACK) {
-        if (x == x->parent->left) {
-            w = x->parent->right;
-            if (w == NULL) {
-                break;
-            }
-
+        if (x == parent->left) {
+            w = parent->right;
             if (__node_color(w) == RED) {
                 w->color = BLACK;
-                x->parent->color = RED;
-                __left_rotate(tree, x->parent);
-                w = x->parent->right;
-            }
-
-            if (w == NULL) {
-                break;
+                parent->color = RED;
+                __left_rotate(tree, parent);
+                w = parent->right;
             }
 
             if (__node_color(w->left) == BLACK && __node_color(w->right) == BLACK) {
                 w->color = RED;
-                x = x->parent;
+                x = parent;
+                parent = x->parent;
             } else {
                 if (__node_color(w->right) == BLACK) {
                     w->left->color = BLACK;
                     w->color = RED;
                     __right_rotate(tree, w);
-                    w = x->parent->right;
+                    w = parent->right;
                 }
 
-                w->color = __node_color(x->parent);
-                x->parent->color = BLACK;
+                w->color = parent->color;
+                parent->color = BLACK;
                 w->right->color = BLACK;
-                __left_rotate(tree, x->parent);
+                __left_rotate(tree, parent);
                 x = tree->root;
             }
         } else {
-            w = x->parent->left;
-            if (w == NULL) {
-                break;
-            }
-
+            w = parent->left;
             if (__node_color(w) == RED) {
                 w->color = BLACK;
-                x->parent->color = RED;
-                __right_rotate(tree, x->parent);
-                w = x->parent->left;
-            }
-
-            if (w == NULL) {
-                break;
+                parent->color = RED;
+                __right_rotate(tree, parent);
+                w = parent->left;
             }
 
             if (__node_color(w->right) == BLACK && __node_color(w->left) == BLACK) {
                 w->color = RED;
-                x = x->parent;
+                x = parent;
+                parent = x->parent;
             } else {
                 if (__node_color(w->left) == BLACK) {
                     w->right->color = BLACK;
                     w->color = RED;
                     __left_rotate(tree, w);
-                    w = x->parent->left;
+                    w = parent->left;
                 }
 
-                w->color = x->parent->color;
-                x->parent->color = BLACK;
+                w->color = parent->color;
+                parent->color = BLACK;
                 w->left->color = BLACK;
-                __right_rotate(tree, x->parent);
+                __right_rotate(tree, parent);
                 x = tree->root;
             }
         }
     }
 
-    x->color = BLACK;
+    if (x != NULL) {
+        x->color = BLACK;
+    }
 }
 
 /**
@@ -484,17 +846,17 @@ static void __remove_fixup(red_black_tree_t *tree, node_t *x) {
  */
 red_black_tree_t *red_black_tree_remove(red_black_tree_t *tree, T key) {
     node_t *x = NULL;
+    node_t *x_parent = NULL;
     node_t *y = NULL;
     node_t *z = NULL;
     color_t y_original_color;
     int cmp;
 
     return_value_if_fail(tree != NULL && key != NULL, tree);
-    return_value_if_fail(tree->compare != NULL, tree);
 
     z = tree->root;
     while (z != NULL) {
-        cmp = tree->compare(key, z->key);
+        cmp = __compare(tree, key, z);
         if (cmp < 0) {
             z = z->left;
         } else if (cmp > 0) {
@@ -512,9 +874,11 @@ red_black_tree_t *red_black_tree_remove(red_black_tree_t *tree, T key) {
 
     if (z->left == NULL) {
         x = z->right;
+        x_parent = z->parent;
         __transplant(tree, z, z->right);
     } else if (z->right == NULL) {
         x = z->left;
+        x_parent = z->parent;
         __transplant(tree, z, z->left);
     } else {
         y = __min_node(z->right);
@@ -522,10 +886,12 @@ red_black_tree_t *red_black_tree_remove(red_black_tree_t *tree, T key) {
         x = y->right;
 
         if (y->parent == z) {
+            x_parent = y;
             if (x != NULL) {
                 x->parent = y;
             }
         } else {
+            x_parent = y->parent;
             __transplant(tree, y, y->right);
             y->right = z->right;
             y->right->parent = y;
@@ -535,15 +901,21 @@ red_black_tree_t *red_black_tree_remove(red_black_tree_t *tree, T key) {
         y->left = z->left;
         y->left->parent = y;
         y->color = z->color;
+        y->size = z->size;
+    }
+
+    /* One node is gone below x_parent, shrink every subtree on the way up */
+    for (y = x_parent; y != NULL; y = y->parent) {
+        y->size--;
     }
 
     if (y_original_color == BLACK) {
-        __remove_fixup(tree, x);
+        __remove_fixup(tree, x, x_parent);
     }
 
-    z->left = NULL;
-    z->right = NULL;
-    z->parent = NULL;
+    if (tree->destroy != NULL) {
+        tree->destroy(z->key);
+    }
     __node_delete(tree, z);
 
     tree->size--;
@@ -551,25 +923,292 @@ red_black_tree_t *red_black_tree_remove(red_black_tree_t *tree, T key) {
 }
 
 /**
- * @brief Get the successor of a node.
- * @param node The node_t object.
- * @return Returns the successor of a node if exists, otherwise returns NULL.
+ * @brief Get the greatest node whose key is less than (or equal to) the given key.
+ * @param tree The red_black_tree_t object.
+ * @param key The key.
+ * @param inclusive Whether a node with an equal key matches.
+ * @return Returns the node if exists, otherwise returns NULL.
  */
-static node_t *__successor(node_t *node) {
-    node_t *successor = NULL;
+static node_t *__floor_node(const red_black_tree_t *tree, T key, bool inclusive) {
+    node_t *node = tree->root;
+    node_t *floor = NULL;
+    int cmp;
 
-    return_value_if_fail(node != NULL, NULL);
+    while (node != NULL) {
+        cmp = __compare(tree, key, node);
+        if (cmp > 0 || (cmp == 0 && inclusive)) {
+            floor = node;
+            if (cmp == 0) {
+                break;
+            }
+            node = node->right;
+        } else {
+            node = node->left;
+        }
+    }
+    return floor;
+}
 
-    if (node->right != NULL) {
-        return __min_node(node->right);
+/**
+ * @brief Get the least node whose key is greater than (or equal to) the given key.
+ * @param tree The red_black_tree_t object.
+ * @param key The key.
+ * @param inclusive Whether a node with an equal key matches.
+ * @return Returns the node if exists, otherwise returns NULL.
+ */
+static node_t *__ceiling_node(const red_black_tree_t *tree, T key, bool inclusive) {
+    node_t *node = tree->root;
+    node_t *ceiling = NULL;
+    int cmp;
+
+    while (node != NULL) {
+        cmp = __compare(tree, key, node);
+        if (cmp < 0 || (cmp == 0 && inclusive)) {
+            ceiling = node;
+            if (cmp == 0) {
+                break;
+            }
+            node = node->left;
+        } else {
+            node = node->right;
+        }
     }
+    return ceiling;
+}
 
-    successor = node->parent;
-    while (successor != NULL && node == successor->right) {
-        node = successor;
-        successor = successor->parent;
+/**
+ * @brief Find the key in the red_black_tree_t object which is equal to the given key.
+ * @param tree The red_black_tree_t object.
+ * @param key The key.
+ * @return Returns the key stored in the tree if found, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+T red_black_tree_find(const red_black_tree_t *tree, T key) {
+    node_t *node = NULL;
+    int cmp;
+
+    return_value_if_fail(tree != NULL && key != NULL, NULL);
+
+    node = tree->root;
+    while (node != NULL) {
+        cmp = __compare(tree, key, node);
+        if (cmp < 0) {
+            node = node->left;
+        } else if (cmp > 0) {
+            node = node->right;
+        } else {
+            return node->key;
+        }
     }
-    return successor;
+    return NULL;
+}
+
+/**
+ * @brief Find the greatest key in the red_black_tree_t object which is less than or equal to the given key.
+ * @param tree The red_black_tree_t object.
+ * @param key The key.
+ * @return Returns the key stored in the tree if found, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+T red_black_tree_floor(const red_black_tree_t *tree, T key) {
+    node_t *node = NULL;
+
+    return_value_if_fail(tree != NULL && key != NULL, NULL);
+
+    node = __floor_node(tree, key, true);
+    return node == NULL ? NULL : node->key;
+}
+
+/**
+ * @brief Find the least key in the red_black_tree_t object which is greater than or equal to the given key.
+ * @param tree The red_black_tree_t object.
+ * @param key The key.
+ * @return Returns the key stored in the tree if found, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+T red_black_tree_ceiling(const red_black_tree_t *tree, T key) {
+    node_t *node = NULL;
+
+    return_value_if_fail(tree != NULL && key != NULL, NULL);
+
+    node = __ceiling_node(tree, key, true);
+    return node == NULL ? NULL : node->key;
+}
+
+/**
+ * @brief Find the greatest key in the red_black_tree_t object which is strictly less than the given key.
+ * @param tree The red_black_tree_t object.
+ * @param key The key.
+ * @return Returns the key stored in the tree if found, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+T red_black_tree_lower(const red_black_tree_t *tree, T key) {
+    node_t *node = NULL;
+
+    return_value_if_fail(tree != NULL && key != NULL, NULL);
+
+    node = __floor_node(tree, key, false);
+    return node == NULL ? NULL : node->key;
+}
+
+/**
+ * @brief Find the least key in the red_black_tree_t object which is strictly greater than the given key.
+ * @param tree The red_black_tree_t object.
+ * @param key The key.
+ * @return Returns the key stored in the tree if found, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+T red_black_tree_higher(const red_black_tree_t *tree, T key) {
+    node_t *node = NULL;
+
+    return_value_if_fail(tree != NULL && key != NULL, NULL);
+
+    node = __ceiling_node(tree, key, false);
+    return node == NULL ? NULL : node->key;
+}
+
+/**
+ * @brief Get the minimum key in the red_black_tree_t object.
+ * @param tree The red_black_tree_t object.
+ * @return Returns the minimum key if the tree is not empty, otherwise returns NULL.
+ */
+T red_black_tree_min(const red_black_tree_t *tree) {
+    return_value_if_fail(tree != NULL && tree->root != NULL, NULL);
+    return __min_node(tree->root)->key;
+}
+
+/**
+ * @brief Get the maximum key in the red_black_tree_t object.
+ * @param tree The red_black_tree_t object.
+ * @return Returns the maximum key if the tree is not empty, otherwise returns NULL.
+ */
+T red_black_tree_max(const red_black_tree_t *tree) {
+    return_value_if_fail(tree != NULL && tree->root != NULL, NULL);
+    return __max_node(tree->root)->key;
+}
+
+/**
+ * @brief Get the key with the specified rank in the red_black_tree_t object.
+ * @param tree The red_black_tree_t object.
+ * @param index The 0-based rank, i.e. the number of smaller keys.
+ * @return Returns the key if the index is valid, otherwise returns NULL.
+ */
+T red_black_tree_select(const red_black_tree_t *tree, size_t index) {
+    node_t *node = NULL;
+    size_t left_size = 0;
+
+    return_value_if_fail(tree != NULL, NULL);
+    return_value_if_fail(index < tree->size, NULL);
+
+    node = tree->root;
+    while (node != NULL) {
+        left_size = __node_size(node->left);
+        if (index < left_size) {
+            node = node->left;
+        } else if (index > left_size) {
+            index -= left_size + 1;
+            node = node->right;
+        } else {
+            return node->key;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Count the keys in the red_black_tree_t object which are strictly less than the given key.
+ * @param tree The red_black_tree_t object.
+ * @param key The key, which does not need to be in the tree.
+ * @return Returns the rank of the key.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+size_t red_black_tree_rank(const red_black_tree_t *tree, T key) {
+    node_t *node = NULL;
+    size_t rank = 0;
+    int cmp;
+
+    return_value_if_fail(tree != NULL && key != NULL, 0);
+
+    node = tree->root;
+    while (node != NULL) {
+        cmp = __compare(tree, key, node);
+        if (cmp <= 0) {
+            node = node->left;
+        } else {
+            rank += __node_size(node->left) + 1;
+            node = node->right;
+        }
+    }
+    return rank;
+}
+
+/**
+ * @brief Check the invariants of the subtree rooted at a node.
+ * @param tree The red_black_tree_t object.
+ * @param node The root of the subtree, which may be NIL.
+ * @param parent The expected parent of the node.
+ * @param lo The nearest smaller node outside the subtree, or NULL if there is none.
+ * @param hi The nearest larger node outside the subtree, or NULL if there is none.
+ * @param black_height Output parameter for the number of black nodes on every path down to NIL.
+ * @return Returns true if every invariant holds in the subtree, otherwise returns false.
+ */
+static bool __is_valid(const red_black_tree_t *tree, const node_t *node, const node_t *parent, const node_t *lo, const node_t *hi, size_t *black_height) {
+    size_t left_height = 0;
+    size_t right_height = 0;
+
+    *black_height = 0;
+    return_value_if(node == NULL, true);
+
+    return_value_if(node->parent != parent, false);
+    return_value_if(lo != NULL && __compare(tree, __key(tree, lo->key), node) >= 0, false);
+    return_value_if(hi != NULL && __compare(tree, __key(tree, hi->key), node) <= 0, false);
+    return_value_if(node->color == RED && (__node_color(node->left) == RED || __node_color(node->right) == RED), false);
+    return_value_if(node->size != __node_size(node->left) + __node_size(node->right) + 1, false);
+
+    return_value_if_fail(__is_valid(tree, node->left, node, lo, node, &left_height), false);
+    return_value_if_fail(__is_valid(tree, node->right, node, node, hi, &right_height), false);
+    return_value_if(left_height != right_height, false);
+
+    *black_height = left_height + (node->color == BLACK ? 1 : 0);
+    return true;
+}
+
+/**
+ * @brief Check the invariants of a red_black_tree_t object in O(n).
+ *        The keys are in strictly ascending order, the root is black, no red node has a red child,
+ *        every path from a node down to NIL has the same number of black nodes, the parent links
+ *        and the subtree sizes are consistent, and the size of the tree matches its nodes.
+ * @param tree The red_black_tree_t object.
+ * @return Returns true if every invariant holds, otherwise returns false.
+ */
+bool red_black_tree_is_valid(const red_black_tree_t *tree) {
+    size_t black_height = 0;
+
+    return_value_if_fail(tree != NULL, false);
+    return_value_if(__node_color(tree->root) != BLACK, false);
+    return_value_if(tree->size != __node_size(tree->root), false);
+    return __is_valid(tree, tree->root, NULL, NULL, NULL, &black_height);
+}
+
+/**
+ * @brief Create an iterator which walks the nodes from `begin` (inclusive) to `end` (exclusive).
+ * @param tree The red_black_tree_t object.
+ * @param begin The first node to visit, or NULL for an empty range.
+ * @param end The node to stop at, or NULL to run off the end of the tree.
+ * @param reverse Whether to walk through predecessors instead of successors.
+ * @return Returns the iterator for container.
+ */
+static iterator_t *__iterator_new(const red_black_tree_t *tree, node_t *begin, node_t *end, bool reverse) {
+    red_black_tree_iterator_t *iterator = NULL;
+
+    iterator = (red_black_tree_iterator_t *)malloc(sizeof(red_black_tree_iterator_t));
+    return_value_if_fail(iterator != NULL, NULL);
+
+    iterator->iterator.container = (void *)tree;
+    iterator->iterator.current = begin == end ? NULL : begin;
+    iterator->end = end;
+    iterator->reverse = reverse;
+    return (iterator_t *)iterator;
 }
 
 /**
@@ -578,16 +1217,42 @@ static node_t *__successor(node_t *node) {
  * @return Returns the iterator for container.
  */
 iterator_t *red_black_tree_iterator_new(const red_black_tree_t *tree) {
-    iterator_t *iterator = NULL;
+    return_value_if_fail(tree != NULL, NULL);
+    return __iterator_new(tree, __min_node(tree->root), NULL, false);
+}
+
+/**
+ * @brief Create an iterator over the keys in [lo, hi) of an red_black_tree_t object in ascending order.
+ *        Seeking to the first key and locating the stop node both take O(log n).
+ * @param tree The red_black_tree_t object.
+ * @param lo The inclusive lower bound, or NULL for no lower bound.
+ * @param hi The exclusive upper bound, or NULL for no upper bound.
+ * @return Returns the iterator for container.
+ * @note Caller MUST free the parameters `lo` and `hi` (if applicable).
+ */
+iterator_t *red_black_tree_iterator_range(const red_black_tree_t *tree, T lo, T hi) {
+    node_t *begin = NULL;
+    node_t *end = NULL;
 
     return_value_if_fail(tree != NULL, NULL);
 
-    iterator = (iterator_t *)malloc(sizeof(iterator_t));
-    return_value_if_fail(iterator != NULL, NULL);
+    if (lo != NULL && hi != NULL && tree->compare(lo, hi) >= 0) {
+        return __iterator_new(tree, NULL, NULL, false);
+    }
 
-    iterator->container = (void *)tree;
-    iterator->current = __min_node(tree->root);
-    return iterator;
+    begin = lo == NULL ? __min_node(tree->root) : __ceiling_node(tree, lo, true);
+    end = hi == NULL ? NULL : __ceiling_node(tree, hi, true);
+    return __iterator_new(tree, begin, end, false);
+}
+
+/**
+ * @brief Create an iterator for an red_black_tree_t object in descending order.
+ * @param tree The red_black_tree_t object.
+ * @return Returns the iterator for container.
+ */
+iterator_t *red_black_tree_iterator_reverse(const red_black_tree_t *tree) {
+    return_value_if_fail(tree != NULL, NULL);
+    return __iterator_new(tree, __max_node(tree->root), NULL, true);
 }
 
 /**
@@ -615,12 +1280,21 @@ bool red_black_tree_iterator_has_next(const iterator_t *iterator) {
  * @return Returns the next element of the iterator.
  */
 T red_black_tree_iterator_next(iterator_t *iterator) {
+    red_black_tree_iterator_t *tree_iterator = NULL;
     T elem = NULL;
 
     return_value_if_fail(iterator != NULL, NULL);
     return_value_if_fail(red_black_tree_iterator_has_next(iterator), NULL);
 
+    tree_iterator = (red_black_tree_iterator_t *)iterator;
     elem = ((node_t *)iterator->current)->key;
-    iterator->current = __successor(iterator->current);
+    if (tree_iterator->reverse) {
+        iterator->current = __predecessor(iterator->current);
+    } else {
+        iterator->current = __successor(iterator->current);
+    }
+    if (iterator->current == tree_iterator->end) {
+        iterator->current = NULL;
+    }
     return elem;
 }
@@ -1,19 +1,34 @@
 #include "cstl/str.h"
 
-#define DEFAULT_CAPACITY 16
-#define SHRINK_FACTOR 2
-#define GROWTH_FACTOR (3 / 2)
+#define SHRINK_FACTOR 4
+#define GROWTH_FACTOR 2
+#define INLINE_CAPACITY 24
 
+/**
+ * Short contents live in `buffer` inside the struct, so a short string takes a single allocation.
+ * `string` points either to `buffer` or to a heap block once the contents outgrow it.
+ */
 struct string_t {
     char *string;
     size_t length;
     size_t capacity;
+    char buffer[INLINE_CAPACITY];
 };
 
+/**
+ * @brief Checks if the contents of the string_t object are stored inline.
+ * @param string The string_t object.
+ * @return Returns true if the contents are stored inline, otherwise returns false.
+ */
+static bool __string_is_inline(const string_t *string) {
+    return string->string == string->buffer;
+}
+
 /**
  * @brief Create a string_t object.
  * @param str The primitive string.
  * @return Returns a string_t pointer if the memory allocation succeeds, otherwise returns NULL.
+ * @note Strings shorter than 24 characters are stored inside the object and take a single allocation.
  */
 string_t *string_new(const char *str) {
     string_t *string = NULL;
@@ -25,15 +40,20 @@ string_t *string_new(const char *str) {
     return_value_if_fail(string != NULL, NULL);
 
     len = strlen(str);
-    string->string = (char *)malloc(sizeof(char) * (len + 1));
-    if (string->string == NULL) {
-        free(string);
-        return NULL;
+    if (len < INLINE_CAPACITY) {
+        string->string = string->buffer;
+        string->capacity = INLINE_CAPACITY;
+    } else {
+        string->string = (char *)malloc(sizeof(char) * (len + 1));
+        if (string->string == NULL) {
+            free(string);
+            return NULL;
+        }
+        string->capacity = len + 1;
     }
 
-    strcpy(string->string, str);
+    memcpy(string->string, str, len + 1);
     string->length = len;
-    string->capacity = len + 1;
     return string;
 }
 
@@ -43,12 +63,15 @@ string_t *string_new(const char *str) {
  */
 void string_delete(string_t *string) {
     return_if_fail(string != NULL);
-    free(string->string);
+    if (!__string_is_inline(string)) {
+        free(string->string);
+    }
     free(string);
 }
 
 /**
  * @brief Resizes the string capacity to the specified capacity.
+ *        A capacity that fits in the inline buffer moves the contents back into the struct.
  * @param string The string_t object.
  * @param new_capacity The new capacity.
  * @return Returns false if the memory allocation fails, otherwise returns true.
@@ -58,39 +81,60 @@ static bool __string_resize_to(string_t *string, size_t new_capacity) {
 
     return_value_if_fail(string != NULL, false);
 
-    new_string = (char *)realloc(string->string, sizeof(char) * new_capacity);
-    return_value_if_fail(new_string != NULL, false);
+    if (new_capacity <= INLINE_CAPACITY) {
+        if (!__string_is_inline(string)) {
+            memcpy(string->buffer, string->string, string->length + 1);
+            free(string->string);
+            string->string = string->buffer;
+            string->capacity = INLINE_CAPACITY;
+        }
+        return true;
+    }
+
+    if (__string_is_inline(string)) {
+        new_string = (char *)malloc(sizeof(char) * new_capacity);
+        return_value_if_fail(new_string != NULL, false);
+        memcpy(new_string, string->string, string->length + 1);
+    } else {
+        new_string = (char *)realloc(string->string, sizeof(char) * new_capacity);
+        return_value_if_fail(new_string != NULL, false);
+    }
     string->string = new_string;
     string->capacity = new_capacity;
     return true;
 }
 
 /**
- * @brief Resizes the string capacity.
- *        1. If the length of the string is 0, the capacity is set to 16.
- *        2. If the length of the string is less than half of the capacity, the capacity is reduced by half.
- *        3. If the length of the string is greater than or equal to the capacity, the capacity is increased by half.
+ * @brief Make room for at least `capacity` characters (including the terminator) in the string_t object.
+ *        The capacity grows geometrically, so appending n characters one by one costs O(n) in total.
  * @param string The string_t object.
+ * @param capacity The number of characters.
  * @return Returns false if the memory allocation fails, otherwise returns true.
  */
-static bool __string_resize(string_t *string) {
-    size_t new_capacity;
+static bool __string_reserve(string_t *string, size_t capacity) {
+    size_t new_capacity = string->capacity;
 
-    return_value_if_fail(string != NULL, false);
+    return_value_if(capacity <= string->capacity, true);
 
-    if (string->length == 0) {
-        new_capacity = DEFAULT_CAPACITY;
-    } else if (string->length < string->capacity / SHRINK_FACTOR) {
-        new_capacity = string->capacity / SHRINK_FACTOR + 1;
-    } else if (string->length + 1 >= string->capacity) {
-        new_capacity = string->capacity * GROWTH_FACTOR + 1;
-    } else {
-        return true;
+    while (new_capacity < capacity) {
+        new_capacity *= GROWTH_FACTOR;
     }
-
     return __string_resize_to(string, new_capacity);
 }
 
+/**
+ * @brief Shrinks the string capacity after the string got shorter.
+ *        Once the length falls below a quarter of the capacity, the capacity is reduced to twice the length,
+ *        so alternating growth and shrinkage around one size does not reallocate every time.
+ * @param string The string_t object.
+ * @return Returns false if the memory allocation fails, otherwise returns true.
+ */
+static bool __string_resize(string_t *string) {
+    return_value_if_fail(string != NULL, false);
+    return_value_if(string->length + 1 > string->capacity / SHRINK_FACTOR, true);
+    return __string_resize_to(string, (string->length + 1) * 2);
+}
+
 /**
  * @brief Clone a string_t object.
  * @param string The string_t object.
@@ -121,6 +165,41 @@ bool string_is_empty(const string_t *string) {
     return string->length == 0;
 }
 
+/**
+ * @brief Returns the number of characters the string_t object can hold without reallocation.
+ * @param string The string_t object.
+ * @return Returns the capacity of the string_t object.
+ */
+size_t string_capacity(const string_t *string) {
+    return_value_if_fail(string != NULL, 0);
+    return string->capacity - 1;
+}
+
+/**
+ * @brief Reserve room for at least `n` characters in the string_t object.
+ *        Growing the string up to `n` characters afterwards does not reallocate.
+ * @param string The string_t object.
+ * @param n The number of characters.
+ * @return Returns the modified string_t object.
+ */
+string_t *string_reserve(string_t *string, size_t n) {
+    return_value_if_fail(string != NULL, NULL);
+    return_value_if(n + 1 <= string->capacity, string);
+    __string_resize_to(string, n + 1);
+    return string;
+}
+
+/**
+ * @brief Release the unused capacity of the string_t object.
+ * @param string The string_t object.
+ * @return Returns the modified string_t object.
+ */
+string_t *string_shrink_to_fit(string_t *string) {
+    return_value_if_fail(string != NULL, NULL);
+    __string_resize_to(string, string->length + 1);
+    return string;
+}
+
 /**
  * @brief Get the primitive string.
  * @param string The string_t object.
@@ -354,7 +433,7 @@ size_t string_count_substring(const string_t *string, const char *substr) {
 string_t *string_append_char(string_t *string, char c) {
     return_value_if_fail(string != NULL, NULL);
     return_value_if_fail(c != '\0', string);
-    return_value_if_fail(__string_resize(string), string);
+    return_value_if_fail(__string_reserve(string, string->length + 2), string);
     string->string[string->length++] = c;
     string->string[string->length] = '\0';
     return string;
@@ -378,7 +457,7 @@ string_t *string_insert_char(string_t *string, size_t index, char c) {
         return string;
     }
 
-    return_value_if_fail(__string_resize(string), string);
+    return_value_if_fail(__string_reserve(string, string->length + 2), string);
     str_insert_char(string->string, index, c);
     string->length++;
     return string;
@@ -391,17 +470,31 @@ string_t *string_insert_char(string_t *string, size_t index, char c) {
  * @return Returns the modified string_t object.
  */
 string_t *string_concat(string_t *string, const char *str) {
-    size_t new_len;
+    return_value_if_fail(string != NULL && str != NULL, string);
+    return string_append_n(string, str, strlen(str));
+}
+
+/**
+ * @brief Append at most `n` characters of the specified string to the end of the string_t object.
+ *        The appended characters stop at the terminator of `str` if it comes first.
+ * @param string The string_t object.
+ * @param str The appended string.
+ * @param n The maximum number of appended characters.
+ * @return Returns the modified string_t object.
+ */
+string_t *string_append_n(string_t *string, const char *str, size_t n) {
+    size_t len = 0;
 
     return_value_if_fail(string != NULL && str != NULL, string);
 
-    new_len = string->length + strlen(str);
-    if (new_len + 1 >= string->capacity) {
-        return_value_if_fail(__string_resize_to(string, new_len + 1), string);
+    while (len < n && str[len] != '\0') {
+        len++;
     }
+    return_value_if_fail(__string_reserve(string, string->length + len + 1), string);
 
-    strcat(string->string, str);
-    string->length = new_len;
+    memcpy(string->string + string->length, str, len);
+    string->length += len;
+    string->string[string->length] = '\0';
     return string;
 }
 
@@ -419,9 +512,7 @@ string_t *string_insert_string(string_t *string, size_t index, const char *str)
     return_value_if_fail(index >= 0 && index <= string->length, string);
 
     new_len = string->length + strlen(str);
-    if (new_len + 1 >= string->capacity) {
-        return_value_if_fail(__string_resize_to(string, new_len + 1), string);
-    }
+    return_value_if_fail(__string_reserve(string, new_len + 1), string);
 
     str_insert_string(string->string, index, str);
     string->length = new_len;
@@ -493,12 +584,11 @@ string_t *string_replace_string(string_t *string, const char *old_str, const cha
     occurences = str_count_substring(string->string, old_str);
     new_len = string->length + occurences * len_diff;
 
-    if (new_len + 1 >= string->capacity) {
-        return_value_if_fail(__string_resize_to(string, new_len + 1), string);
-    }
+    return_value_if_fail(__string_reserve(string, new_len + 1), string);
 
     str_replace_string(string->string, old_str, new_str);
     string->length = new_len;
+    __string_resize(string);
     return string;
 }
 
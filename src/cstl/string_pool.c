@@ -0,0 +1,335 @@
+#include "cstl/string_pool.h"
+#include "utils/numeric.h"
+#include <string.h>
+
+#define DEFAULT_CAPACITY 16
+#define GROWTH_FACTOR 2
+#define LOAD_FACTOR_THRESHOLD 0.75
+#define CHUNK_SIZE 65536
+
+/**
+ * @brief Types with the strictest alignment, used to align entries.
+ */
+typedef union align_t {
+    long l;
+    double d;
+    void *p;
+} align_t;
+
+/* The header of an interned string, immediately followed by its characters in the arena */
+typedef struct entry_t {
+    struct entry_t *next;
+    size_t hash;
+    size_t length;
+} entry_t;
+
+typedef struct chunk_t {
+    struct chunk_t *next;
+} chunk_t;
+
+struct string_pool_t {
+    entry_t **buckets;
+    size_t size;
+    size_t capacity;
+    chunk_t *chunks;
+    char *cursor;      /* The free space of the newest shared chunk */
+    size_t remaining;
+};
+
+/**
+ * @brief Round a size up to the alignment of align_t.
+ * @param size The size in bytes.
+ * @return Returns the aligned size.
+ */
+static size_t __align(size_t size) {
+    return (size + sizeof(align_t) - 1) / sizeof(align_t) * sizeof(align_t);
+}
+
+/**
+ * @brief Get the characters of an entry.
+ * @param entry The entry.
+ * @return Returns the interned string.
+ */
+static char *__entry_string(const entry_t *entry) {
+    return (char *)entry + __align(sizeof(entry_t));
+}
+
+/**
+ * @brief Get the entry of an interned string.
+ * @param str The interned string.
+ * @return Returns the entry.
+ */
+static entry_t *__string_entry(const char *str) {
+    return (entry_t *)(str - __align(sizeof(entry_t)));
+}
+
+/**
+ * @brief Hash a string and measure its length in a single pass.
+ *        The hash is the same as str_hash().
+ * @param str The string.
+ * @param length Output parameter for the length of the string.
+ * @return Returns the hash of the string.
+ */
+static size_t __hash(const char *str, size_t *length) {
+    size_t hash_value = 5381;
+    const char *p = str;
+    int c;
+
+    while ((c = *p++) != '\0') {
+        hash_value = ((hash_value << 5) + hash_value) + c;
+    }
+    *length = (size_t)(p - str - 1);
+    return hash_value;
+}
+
+/**
+ * @brief Find the entry of a string.
+ * @param pool The string_pool_t object.
+ * @param str The string.
+ * @param hash The hash of the string.
+ * @param length The length of the string.
+ * @return Returns the entry if found, otherwise returns NULL.
+ */
+static entry_t *__find(const string_pool_t *pool, const char *str, size_t hash, size_t length) {
+    entry_t *entry = NULL;
+
+    for (entry = pool->buckets[hash % pool->capacity]; entry != NULL; entry = entry->next) {
+        if (entry->hash == hash && entry->length == length && memcmp(__entry_string(entry), str, length) == 0) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Allocate an entry with room for `length` characters and the terminator from the arena.
+ *        Entries are carved out of shared chunks, an entry larger than a chunk gets a chunk of its own.
+ * @param pool The string_pool_t object.
+ * @param length The length of the string.
+ * @return Returns the allocated entry if successful, otherwise returns NULL.
+ */
+static entry_t *__alloc_entry(string_pool_t *pool, size_t length) {
+    size_t need = __align(__align(sizeof(entry_t)) + length + 1);
+    size_t header = __align(sizeof(chunk_t));
+    chunk_t *chunk = NULL;
+    char *block = NULL;
+
+    if (need > pool->remaining) {
+        chunk = (chunk_t *)malloc(header + max(need, CHUNK_SIZE));
+        return_value_if_fail(chunk != NULL, NULL);
+        chunk->next = pool->chunks;
+        pool->chunks = chunk;
+        if (need > CHUNK_SIZE) {
+            return (entry_t *)((char *)chunk + header);
+        }
+        pool->cursor = (char *)chunk + header;
+        pool->remaining = CHUNK_SIZE;
+    }
+
+    block = pool->cursor;
+    pool->cursor += need;
+    pool->remaining -= need;
+    return (entry_t *)block;
+}
+
+/**
+ * @brief Double the number of buckets of a string_pool_t object and relink every entry.
+ * @param pool The string_pool_t object.
+ * @return Returns true if memory allocation is successful, otherwise returns false.
+ */
+static bool __rehash(string_pool_t *pool) {
+    size_t new_capacity = pool->capacity * GROWTH_FACTOR;
+    entry_t **new_buckets = NULL;
+    entry_t *entry = NULL;
+    entry_t *next = NULL;
+    size_t i = 0;
+
+    new_buckets = (entry_t **)calloc(new_capacity, sizeof(entry_t *));
+    return_value_if_fail(new_buckets != NULL, false);
+
+    for (i = 0; i < pool->capacity; i++) {
+        for (entry = pool->buckets[i]; entry != NULL; entry = next) {
+            next = entry->next;
+            entry->next = new_buckets[entry->hash % new_capacity];
+            new_buckets[entry->hash % new_capacity] = entry;
+        }
+    }
+
+    free(pool->buckets);
+    pool->buckets = new_buckets;
+    pool->capacity = new_capacity;
+    return true;
+}
+
+/**
+ * @brief Create a string_pool_t object.
+ * @return Returns the created string_pool_t object if successful, otherwise returns NULL.
+ */
+string_pool_t *string_pool_new(void) {
+    string_pool_t *pool = NULL;
+
+    pool = (string_pool_t *)malloc(sizeof(string_pool_t));
+    return_value_if_fail(pool != NULL, NULL);
+
+    pool->buckets = (entry_t **)calloc(DEFAULT_CAPACITY, sizeof(entry_t *));
+    if (pool->buckets == NULL) {
+        free(pool);
+        return NULL;
+    }
+
+    pool->size = 0;
+    pool->capacity = DEFAULT_CAPACITY;
+    pool->chunks = NULL;
+    pool->cursor = NULL;
+    pool->remaining = 0;
+    return pool;
+}
+
+/**
+ * @brief Destroy a string_pool_t object.
+ * @param pool The string_pool_t object.
+ * @note All interned strings of the pool become invalid.
+ */
+void string_pool_delete(string_pool_t *pool) {
+    return_if_fail(pool != NULL);
+    string_pool_clear(pool);
+    free(pool->buckets);
+    free(pool);
+}
+
+/**
+ * @brief Determine whether a string_pool_t object is empty.
+ * @param pool The string_pool_t object.
+ * @return Returns true if the string_pool_t object is empty, otherwise returns false.
+ */
+bool string_pool_is_empty(const string_pool_t *pool) {
+    return_value_if_fail(pool != NULL, true);
+    return pool->size == 0;
+}
+
+/**
+ * @brief Get the number of distinct strings in a string_pool_t object.
+ * @param pool The string_pool_t object.
+ * @return Returns the number of distinct strings.
+ */
+size_t string_pool_size(const string_pool_t *pool) {
+    return_value_if_fail(pool != NULL, 0);
+    return pool->size;
+}
+
+/**
+ * @brief Clear a string_pool_t object and release its arena.
+ * @param pool The string_pool_t object.
+ * @return Returns the modified string_pool_t object.
+ * @note All interned strings of the pool become invalid.
+ */
+string_pool_t *string_pool_clear(string_pool_t *pool) {
+    chunk_t *chunk = NULL;
+    chunk_t *next = NULL;
+
+    return_value_if_fail(pool != NULL, NULL);
+
+    for (chunk = pool->chunks; chunk != NULL; chunk = next) {
+        next = chunk->next;
+        free(chunk);
+    }
+    memset(pool->buckets, 0, sizeof(entry_t *) * pool->capacity);
+
+    pool->size = 0;
+    pool->chunks = NULL;
+    pool->cursor = NULL;
+    pool->remaining = 0;
+    return pool;
+}
+
+/**
+ * @brief Intern a string into a string_pool_t object.
+ * @param pool The string_pool_t object.
+ * @param str The string.
+ * @return Returns the canonical copy of the string, which stays valid until the pool is cleared or destroyed,
+ *         or NULL if the memory allocation fails.
+ * @note Caller MUST NOT modify or free the returned string.
+ */
+const char *string_pool_intern(string_pool_t *pool, const char *str) {
+    entry_t *entry = NULL;
+    size_t length = 0;
+    size_t hash = 0;
+
+    return_value_if_fail(pool != NULL && str != NULL, NULL);
+
+    hash = __hash(str, &length);
+    entry = __find(pool, str, hash, length);
+    return_value_if(entry != NULL, __entry_string(entry));
+
+    if ((float)(pool->size + 1) / pool->capacity > LOAD_FACTOR_THRESHOLD) {
+        return_value_if_fail(__rehash(pool), NULL);
+    }
+
+    entry = __alloc_entry(pool, length);
+    return_value_if_fail(entry != NULL, NULL);
+
+    entry->hash = hash;
+    entry->length = length;
+    memcpy(__entry_string(entry), str, length + 1);
+    entry->next = pool->buckets[hash % pool->capacity];
+    pool->buckets[hash % pool->capacity] = entry;
+    pool->size++;
+    return __entry_string(entry);
+}
+
+/**
+ * @brief Look up the canonical copy of a string in a string_pool_t object without interning it.
+ * @param pool The string_pool_t object.
+ * @param str The string.
+ * @return Returns the canonical copy of the string if it was interned, otherwise returns NULL.
+ */
+const char *string_pool_lookup(const string_pool_t *pool, const char *str) {
+    entry_t *entry = NULL;
+    size_t length = 0;
+    size_t hash = 0;
+
+    return_value_if_fail(pool != NULL && str != NULL, NULL);
+
+    hash = __hash(str, &length);
+    entry = __find(pool, str, hash, length);
+    return entry != NULL ? __entry_string(entry) : NULL;
+}
+
+/**
+ * @brief Get the length of an interned string in O(1).
+ * @param str The interned string.
+ * @return Returns the length of the string.
+ */
+size_t string_pool_length(const char *str) {
+    return_value_if_fail(str != NULL, 0);
+    return __string_entry(str)->length;
+}
+
+/**
+ * @brief Get the precomputed hash of an interned string in O(1).
+ *        The value equals str_hash() of the same characters.
+ * @param str The interned string.
+ * @return Returns the hash of the string.
+ * @note Compatible with hash_t, for use as the hash callback of hash_map_t and hash_set_t.
+ */
+size_t string_pool_hash(const T str) {
+    exit_if_fail(str != NULL);
+    return __string_entry((const char *)str)->hash;
+}
+
+/**
+ * @brief Compare two interned strings of the same pool by address in O(1).
+ *        Equal strings compare equal, the order of different strings is arbitrary but consistent.
+ * @param str1 The first interned string.
+ * @param str2 The second interned string.
+ * @return Returns 0 if the strings are equal, otherwise returns a negative or positive integer.
+ * @note Compatible with compare_t, for use as the compare callback of CSTL containers.
+ */
+int string_pool_compare(const T str1, const T str2) {
+    if (str1 == str2) {
+        return 0;
+    }
+    /* Relational operators on pointers into different chunks are undefined, compare the addresses as integers.
+       size_t is as wide as a pointer on LLP64 as well, where unsigned long would truncate it. */
+    return (size_t)str1 < (size_t)str2 ? -1 : 1;
+}
@@ -0,0 +1,384 @@
+#include "cstl/timer_wheel.h"
+#include "utils/pool.h"
+
+#define WHEELS 4
+#define SLOT_BITS 8
+#define SLOTS (1 << SLOT_BITS)
+#define SLOT_MASK (SLOTS - 1)
+
+struct timer_wheel_timer_t {
+    struct timer_wheel_timer_t *prev;
+    struct timer_wheel_timer_t *next;
+    unsigned long expiry;
+    size_t level;
+    T elem;
+};
+
+typedef struct timer_wheel_timer_t node_t;
+
+/* Every slot is the sentinel of a circular doubly linked list, so a timer unlinks itself in O(1) */
+struct timer_wheel_t {
+    node_t slots[WHEELS][SLOTS];
+    size_t counts[WHEELS];
+    pool_t *pool;
+    size_t size;
+    unsigned long next;   /* The next tick to process, one past the current time */
+    destroy_t destroy;
+};
+
+/**
+ * @brief Make a list empty.
+ * @param head The sentinel of the list.
+ */
+static void __list_init(node_t *head) {
+    head->prev = head;
+    head->next = head;
+}
+
+/**
+ * @brief Insert a node at the back of a list.
+ * @param head The sentinel of the list.
+ * @param node The node.
+ */
+static void __list_push_back(node_t *head, node_t *node) {
+    node->prev = head->prev;
+    node->next = head;
+    head->prev->next = node;
+    head->prev = node;
+}
+
+/**
+ * @brief Unlink a node from whichever list it is in.
+ * @param node The node.
+ */
+static void __list_unlink(node_t *node) {
+    node->prev->next = node->next;
+    node->next->prev = node->prev;
+}
+
+/**
+ * @brief Move all nodes of a list to another, empty list.
+ * @param head The sentinel of the empty list.
+ * @param other The sentinel of the list to be moved.
+ */
+static void __list_take(node_t *head, node_t *other) {
+    if (other->next == other) {
+        __list_init(head);
+        return;
+    }
+    head->next = other->next;
+    head->prev = other->prev;
+    head->next->prev = head;
+    head->prev->next = head;
+    __list_init(other);
+}
+
+/**
+ * @brief Create a timer_wheel_t object.
+ * @param now The current time in ticks.
+ * @param destroy Callback function for destroying a data item.
+ * @return Returns the created timer_wheel_t object if successful, otherwise returns NULL.
+ */
+timer_wheel_t *timer_wheel_new(unsigned long now, destroy_t destroy) {
+    timer_wheel_t *wheel = NULL;
+    size_t i = 0;
+    size_t j = 0;
+
+    wheel = (timer_wheel_t *)malloc(sizeof(timer_wheel_t));
+    return_value_if_fail(wheel != NULL, NULL);
+
+    wheel->pool = pool_new(sizeof(node_t));
+    if (wheel->pool == NULL) {
+        free(wheel);
+        return NULL;
+    }
+
+    for (i = 0; i < WHEELS; i++) {
+        for (j = 0; j < SLOTS; j++) {
+            __list_init(&wheel->slots[i][j]);
+        }
+        wheel->counts[i] = 0;
+    }
+
+    wheel->size = 0;
+    wheel->next = now + 1;
+    wheel->destroy = destroy;
+    return wheel;
+}
+
+/**
+ * @brief Destroy a timer_wheel_t object.
+ * @param wheel The timer_wheel_t object.
+ */
+void timer_wheel_delete(timer_wheel_t *wheel) {
+    return_if_fail(wheel != NULL);
+    timer_wheel_clear(wheel);
+    pool_delete(wheel->pool);
+    free(wheel);
+}
+
+/**
+ * @brief Determine whether a timer_wheel_t object has no armed timers.
+ * @param wheel The timer_wheel_t object.
+ * @return Returns true if the timer_wheel_t object is empty, otherwise returns false.
+ */
+bool timer_wheel_is_empty(const timer_wheel_t *wheel) {
+    return_value_if_fail(wheel != NULL, true);
+    return wheel->size == 0;
+}
+
+/**
+ * @brief Get the number of armed timers of a timer_wheel_t object.
+ * @param wheel The timer_wheel_t object.
+ * @return Returns the number of armed timers.
+ */
+size_t timer_wheel_size(const timer_wheel_t *wheel) {
+    return_value_if_fail(wheel != NULL, 0);
+    return wheel->size;
+}
+
+/**
+ * @brief Cancel all timers of a timer_wheel_t object without firing them.
+ * @param wheel The timer_wheel_t object.
+ * @return Returns the modified timer_wheel_t object.
+ */
+timer_wheel_t *timer_wheel_clear(timer_wheel_t *wheel) {
+    node_t *head = NULL;
+    node_t *node = NULL;
+    size_t i = 0;
+    size_t j = 0;
+
+    return_value_if_fail(wheel != NULL, NULL);
+
+    for (i = 0; i < WHEELS; i++) {
+        for (j = 0; j < SLOTS; j++) {
+            head = &wheel->slots[i][j];
+            if (wheel->destroy != NULL) {
+                for (node = head->next; node != head; node = node->next) {
+                    wheel->destroy(node->elem);
+                }
+            }
+            __list_init(head);
+        }
+        wheel->counts[i] = 0;
+    }
+
+    /* The timers are released slab by slab */
+    pool_clear(wheel->pool);
+    wheel->size = 0;
+    return wheel;
+}
+
+/**
+ * @brief Get the current time of a timer_wheel_t object.
+ * @param wheel The timer_wheel_t object.
+ * @return Returns the time passed to the last advance, or to the constructor.
+ */
+unsigned long timer_wheel_now(const timer_wheel_t *wheel) {
+    return_value_if_fail(wheel != NULL, 0);
+    return wheel->next - 1;
+}
+
+/**
+ * @brief Link a timer into the slot of its expiry.
+ *        The lowest wheel whose span covers the distance to the expiry is used. Timers due
+ *        within 256 ticks are in the slot of their exact tick, farther ones in the slot of the
+ *        block of ticks they fall into, to be redistributed when that block begins.
+ * @param wheel The timer_wheel_t object.
+ * @param node The timer.
+ */
+static void __link(timer_wheel_t *wheel, node_t *node) {
+    unsigned long expiry = node->expiry;
+    unsigned long delta = expiry - wheel->next;
+    size_t level = 0;
+
+    if (expiry < wheel->next) {
+        /* Already due, fire with the next tick */
+        node->level = 0;
+        wheel->counts[0]++;
+        __list_push_back(&wheel->slots[0][wheel->next & SLOT_MASK], node);
+        return;
+    }
+
+    while (level < WHEELS - 1 && (delta >> (SLOT_BITS * (level + 1))) != 0) {
+        level++;
+    }
+
+    /* Beyond the span of the top wheel, park in its farthest slot and redistribute from there */
+    if (level == WHEELS - 1 && ((delta >> (SLOT_BITS * 2)) >> (SLOT_BITS * 2)) != 0) {
+        expiry = wheel->next + 0xFFFFFFFFUL;
+    }
+
+    node->level = level;
+    wheel->counts[level]++;
+    __list_push_back(&wheel->slots[level][(expiry >> (SLOT_BITS * level)) & SLOT_MASK], node);
+}
+
+/**
+ * @brief Unlink a timer from its slot.
+ * @param wheel The timer_wheel_t object.
+ * @param node The timer.
+ */
+static void __unlink(timer_wheel_t *wheel, node_t *node) {
+    wheel->counts[node->level]--;
+    __list_unlink(node);
+}
+
+/**
+ * @brief Redistribute the timers of a slot into the lower wheels.
+ * @param wheel The timer_wheel_t object.
+ * @param level The level of the wheel.
+ * @param index The index of the slot.
+ */
+static void __cascade(timer_wheel_t *wheel, size_t level, size_t index) {
+    node_t head;
+    node_t *node = NULL;
+
+    __list_take(&head, &wheel->slots[level][index]);
+    while (head.next != &head) {
+        node = head.next;
+        __unlink(wheel, node);
+        __link(wheel, node);
+    }
+}
+
+/**
+ * @brief Arm a timer in a timer_wheel_t object in O(1).
+ * @param wheel The timer_wheel_t object.
+ * @param expiry The time at which the timer fires. A time not after the current time fires on the next advance past it.
+ * @param elem The element.
+ * @return Returns the timer, which stays valid until it fires or is cancelled, or NULL if it cannot be armed.
+ */
+timer_wheel_timer_t *timer_wheel_arm(timer_wheel_t *wheel, unsigned long expiry, T elem) {
+    node_t *node = NULL;
+
+    return_value_if_fail(wheel != NULL, NULL);
+
+    node = (node_t *)pool_alloc(wheel->pool);
+    return_value_if_fail(node != NULL, NULL);
+
+    node->expiry = expiry;
+    node->elem = elem;
+    __link(wheel, node);
+    wheel->size++;
+    return node;
+}
+
+/**
+ * @brief Move an armed timer of a timer_wheel_t object to a new expiry in O(1).
+ * @param wheel The timer_wheel_t object.
+ * @param timer The armed timer.
+ * @param expiry The new time at which the timer fires.
+ * @return Returns the modified timer_wheel_t object.
+ */
+timer_wheel_t *timer_wheel_rearm(timer_wheel_t *wheel, timer_wheel_timer_t *timer, unsigned long expiry) {
+    return_value_if_fail(wheel != NULL && timer != NULL, NULL);
+
+    __unlink(wheel, timer);
+    timer->expiry = expiry;
+    __link(wheel, timer);
+    return wheel;
+}
+
+/**
+ * @brief Cancel an armed timer of a timer_wheel_t object in O(1).
+ * @param wheel The timer_wheel_t object.
+ * @param timer The armed timer.
+ * @return Returns the element of the cancelled timer.
+ * @note Caller MUST free the returned element (if applicable).
+ */
+T timer_wheel_cancel(timer_wheel_t *wheel, timer_wheel_timer_t *timer) {
+    T elem = NULL;
+
+    return_value_if_fail(wheel != NULL && timer != NULL, NULL);
+
+    __unlink(wheel, timer);
+    elem = timer->elem;
+    pool_free(wheel->pool, timer);
+    wheel->size--;
+    return elem;
+}
+
+/**
+ * @brief Advance the time of a timer_wheel_t object and fire every timer that expired, slot by slot.
+ *        Timers fire tick by tick in order of expiry, those armed for a past time with the first tick.
+ *        The callback may arm, rearm and cancel other timers.
+ * @param wheel The timer_wheel_t object.
+ * @param now The new current time, earlier times are ignored.
+ * @param fire Callback function for the element of each fired timer.
+ * @return Returns the number of fired timers.
+ * @note The callback takes over the fired elements.
+ */
+size_t timer_wheel_advance(timer_wheel_t *wheel, unsigned long now, visit_t fire) {
+    node_t batch;
+    node_t *node = NULL;
+    size_t fired = 0;
+    size_t level = 0;
+    size_t index = 0;
+    unsigned long boundary;
+    T elem = NULL;
+
+    return_value_if_fail(wheel != NULL && fire != NULL, 0);
+
+    while (wheel->next - 1 < now) {
+        if (wheel->size == 0) {
+            wheel->next = now + 1;
+            break;
+        }
+
+        /* Nothing fires before the wheels below the lowest non-empty one are refilled, so skip to that tick */
+        for (level = 0; wheel->counts[level] == 0; level++) {
+        }
+        if (level > 0 && (wheel->next & ((1UL << (SLOT_BITS * level)) - 1)) != 0) {
+            boundary = ((wheel->next >> (SLOT_BITS * level)) + 1) << (SLOT_BITS * level);
+            if (boundary - 1 >= now) {
+                wheel->next = now + 1;
+                break;
+            }
+            wheel->next = boundary;
+        }
+
+        /* At the start of every block of 256 ticks, bring its timers down from the wheel above */
+        index = wheel->next & SLOT_MASK;
+        for (level = 1; level < WHEELS && index == 0; level++) {
+            index = (wheel->next >> (SLOT_BITS * level)) & SLOT_MASK;
+            __cascade(wheel, level, index);
+        }
+
+        /* Detach the whole slot first, so the callback can cancel batched timers and new ones land in later slots */
+        __list_take(&batch, &wheel->slots[0][wheel->next & SLOT_MASK]);
+        wheel->next++;
+
+        while (batch.next != &batch) {
+            node = batch.next;
+            __unlink(wheel, node);
+            elem = node->elem;
+            pool_free(wheel->pool, node);
+            wheel->size--;
+            fired++;
+            fire(elem);
+        }
+    }
+
+    return fired;
+}
+
+/**
+ * @brief Get the element of an armed timer.
+ * @param timer The timer_wheel_timer_t object.
+ * @return Returns the element.
+ */
+T timer_wheel_timer_get(const timer_wheel_timer_t *timer) {
+    return_value_if_fail(timer != NULL, NULL);
+    return timer->elem;
+}
+
+/**
+ * @brief Get the expiry of an armed timer.
+ * @param timer The timer_wheel_timer_t object.
+ * @return Returns the time at which the timer fires.
+ */
+unsigned long timer_wheel_timer_expiry(const timer_wheel_timer_t *timer) {
+    return_value_if_fail(timer != NULL, 0);
+    return timer->expiry;
+}
@@ -6,46 +6,75 @@ struct tree_map_t {
     compare_t compare;
 };
 
-static compare_t __compare = NULL;
-
 /**
- * @brief Private function for comparing two pair_t objects.
- * @param data1 The first pair_t object.
- * @param data2 The second pair_t object.
- * @return Returns negative value if the first element is less than the second element.
- *         Returns 0 if the first element is equal to the second element.
- *         Returns positive value if the first element is greater than the second element.
+ * @brief Private function for extracting the key of a pair_t object.
+ * @param data The pair_t object.
+ * @return Returns the key of the pair_t object.
  */
-static int __pair_compare(const T data1, const T data2) {
-    pair_t *pair1 = (pair_t *)data1;
-    pair_t *pair2 = (pair_t *)data2;
-    return __compare(pair_get_key(pair1), pair_get_key(pair2));
+static T __pair_key(const T data) {
+    return pair_get_key((pair_t *)data);
 }
 
 /**
- * @brief Create a tree_map_t object.
+ * @brief Wrap a red_black_tree_t object into a tree_map_t object.
+ * @param tree The red_black_tree_t object, or NULL if its creation failed.
  * @param compare Callback function for comparing two keys.
  * @return Returns the created tree_map_t object if successful, otherwise returns NULL.
  */
-tree_map_t *tree_map_new(compare_t compare) {
+static tree_map_t *__tree_map_new(red_black_tree_t *tree, compare_t compare) {
     tree_map_t *map = NULL;
 
-    return_value_if_fail(compare != NULL, NULL);
+    return_value_if_fail(tree != NULL, NULL);
 
     map = (tree_map_t *)malloc(sizeof(tree_map_t));
-    return_value_if_fail(map != NULL, NULL);
-
-    __compare = compare;
-    map->tree = red_black_tree_new(__pair_compare, (destroy_t)pair_delete);
-    if (map->tree == NULL) {
-        free(map);
+    if (map == NULL) {
+        red_black_tree_delete(tree);
         return NULL;
     }
 
+    map->tree = tree;
     map->compare = compare;
     return map;
 }
 
+/**
+ * @brief Create a tree_map_t object.
+ * @param compare Callback function for comparing two keys.
+ * @return Returns the created tree_map_t object if successful, otherwise returns NULL.
+ */
+tree_map_t *tree_map_new(compare_t compare) {
+    return_value_if_fail(compare != NULL, NULL);
+    return __tree_map_new(red_black_tree_new_with_key(compare, __pair_key, (destroy_t)pair_delete), compare);
+}
+
+/**
+ * @brief Create a tree_map_t object from the pairs of an array_t object with keys in strictly ascending order in O(n).
+ * @param compare Callback function for comparing two keys.
+ * @param array The array_t object of pair_t objects.
+ * @return Returns the created tree_map_t object if successful, otherwise returns NULL,
+ *         including when the keys are not in strictly ascending order.
+ * @note The map takes over the pairs if successful. Caller MUST NOT destroy them through the array
+ *       afterwards (e.g. create the array with a NULL destroy callback).
+ */
+tree_map_t *tree_map_from_sorted(compare_t compare, const array_t *array) {
+    return_value_if_fail(compare != NULL && array != NULL, NULL);
+    return __tree_map_new(red_black_tree_new_from_sorted(compare, __pair_key, (destroy_t)pair_delete, array), compare);
+}
+
+/**
+ * @brief Create a tree_map_t object from the pairs of an array_t object in any order in O(n log n).
+ *        Of several pairs with equal keys the last one is kept and the others are destroyed, like tree_map_put.
+ * @param compare Callback function for comparing two keys.
+ * @param array The array_t object of pair_t objects.
+ * @return Returns the created tree_map_t object if successful, otherwise returns NULL.
+ * @note The map takes over the pairs if successful. Caller MUST NOT destroy them through the array
+ *       afterwards (e.g. create the array with a NULL destroy callback).
+ */
+tree_map_t *tree_map_from_array(compare_t compare, const array_t *array) {
+    return_value_if_fail(compare != NULL && array != NULL, NULL);
+    return __tree_map_new(red_black_tree_new_from_array(compare, __pair_key, (destroy_t)pair_delete, array, true), compare);
+}
+
 /**
  * @brief Destroy a tree_map_t object.
  * @param map The tree_map_t object.
@@ -76,27 +105,22 @@ size_t tree_map_size(tree_map_t *map) {
     return red_black_tree_size(map->tree);
 }
 
-static visit_pair_t __visit = NULL;
-
-/**
- * @brief Pirvate function for visiting a pair_t object.
- * @param pair The pair_t object.
- */
-static void __visit_pair(T pair) {
-    return_if_fail(pair != NULL);
-    pair = (pair_t *)pair;
-    __visit(pair);
-}
-
 /**
  * @brief Traverse a tree_map_t object.
  * @param map The tree_map_t object.
  * @param visit Callback function for visiting a key-value pair.
  */
 void tree_map_foreach(tree_map_t *map, visit_pair_t visit) {
+    iterator_t *iterator = NULL;
+
     return_if_fail(map != NULL && visit != NULL);
-    __visit = visit;
-    red_black_tree_foreach(map->tree, __visit_pair);
+
+    /* Walk the tree directly, calling the visitor through a cast function pointer is undefined */
+    iterator = red_black_tree_iterator_new(map->tree);
+    while (red_black_tree_iterator_has_next(iterator)) {
+        visit(red_black_tree_iterator_next(iterator));
+    }
+    red_black_tree_iterator_delete(iterator);
 }
 
 /**
@@ -118,16 +142,8 @@ tree_map_t *tree_map_clear(tree_map_t *map) {
  * @note Caller MUST free the parameter `key` (if applicable).
  */
 bool tree_map_contains(const tree_map_t *map, T key) {
-    pair_t *pair = NULL;
-    bool found = false;
-
     return_value_if_fail(map != NULL && key != NULL, false);
-
-    pair = pair_new(key, NULL, NULL, NULL);
-    found = red_black_tree_contains(map->tree, pair);
-    pair_delete(pair);
-
-    return found;
+    return red_black_tree_contains(map->tree, key);
 }
 
 /**
@@ -138,11 +154,7 @@ bool tree_map_contains(const tree_map_t *map, T key) {
  */
 tree_map_t *tree_map_put(tree_map_t *map, pair_t *pair) {
     return_value_if_fail(map != NULL && pair != NULL, map);
-
-    if (red_black_tree_contains(map->tree, pair)) {
-        red_black_tree_remove(map->tree, pair);
-    }
-    red_black_tree_insert(map->tree, pair);
+    red_black_tree_put(map->tree, pair);
     return map;
 }
 
@@ -154,14 +166,8 @@ tree_map_t *tree_map_put(tree_map_t *map, pair_t *pair) {
  * @note Caller MUST free the parameter `key` (if applicable).
  */
 tree_map_t *tree_map_remove(tree_map_t *map, T key) {
-    pair_t *pair = NULL;
-
     return_value_if_fail(map != NULL && key != NULL, map);
-
-    pair = pair_new(key, NULL, NULL, NULL);
-    red_black_tree_remove(map->tree, pair);
-    pair_delete(pair);
-
+    red_black_tree_remove(map->tree, key);
     return map;
 }
 
@@ -173,24 +179,106 @@ tree_map_t *tree_map_remove(tree_map_t *map, T key) {
  * @note Caller MUST free the parameter `key` (if applicable).
  */
 T tree_map_get(const tree_map_t *map, T key) {
-    iterator_t *iterator = NULL;
-    pair_t *pair;
+    pair_t *pair = NULL;
 
     return_value_if_fail(map != NULL && key != NULL, NULL);
 
-    iterator = red_black_tree_iterator_new(map->tree);
-    return_value_if_fail(iterator != NULL, NULL);
+    pair = (pair_t *)red_black_tree_find(map->tree, key);
+    return pair == NULL ? NULL : pair_get_value(pair);
+}
 
-    while (red_black_tree_iterator_has_next(iterator)) {
-        pair = (pair_t *)red_black_tree_iterator_next(iterator);
-        if (map->compare(pair_get_key(pair), key) == 0) {
-            red_black_tree_iterator_delete(iterator);
-            return pair_get_value(pair);
-        }
-    }
+/**
+ * @brief Get the key-value pair with the greatest key less than or equal to the given key.
+ * @param map The tree_map_t object.
+ * @param key The key.
+ * @return Returns the pair_t object if found, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable). The returned pair is owned by the map.
+ */
+pair_t *tree_map_floor(const tree_map_t *map, T key) {
+    return_value_if_fail(map != NULL && key != NULL, NULL);
+    return (pair_t *)red_black_tree_floor(map->tree, key);
+}
 
-    red_black_tree_iterator_delete(iterator);
-    return NULL;
+/**
+ * @brief Get the key-value pair with the least key greater than or equal to the given key.
+ * @param map The tree_map_t object.
+ * @param key The key.
+ * @return Returns the pair_t object if found, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable). The returned pair is owned by the map.
+ */
+pair_t *tree_map_ceiling(const tree_map_t *map, T key) {
+    return_value_if_fail(map != NULL && key != NULL, NULL);
+    return (pair_t *)red_black_tree_ceiling(map->tree, key);
+}
+
+/**
+ * @brief Get the key-value pair with the greatest key strictly less than the given key.
+ * @param map The tree_map_t object.
+ * @param key The key.
+ * @return Returns the pair_t object if found, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable). The returned pair is owned by the map.
+ */
+pair_t *tree_map_lower(const tree_map_t *map, T key) {
+    return_value_if_fail(map != NULL && key != NULL, NULL);
+    return (pair_t *)red_black_tree_lower(map->tree, key);
+}
+
+/**
+ * @brief Get the key-value pair with the least key strictly greater than the given key.
+ * @param map The tree_map_t object.
+ * @param key The key.
+ * @return Returns the pair_t object if found, otherwise returns NULL.
+ * @note Caller MUST free the parameter `key` (if applicable). The returned pair is owned by the map.
+ */
+pair_t *tree_map_higher(const tree_map_t *map, T key) {
+    return_value_if_fail(map != NULL && key != NULL, NULL);
+    return (pair_t *)red_black_tree_higher(map->tree, key);
+}
+
+/**
+ * @brief Get the key-value pair with the least key.
+ * @param map The tree_map_t object.
+ * @return Returns the pair_t object if the map is not empty, otherwise returns NULL.
+ * @note The returned pair is owned by the map.
+ */
+pair_t *tree_map_first(const tree_map_t *map) {
+    return_value_if_fail(map != NULL, NULL);
+    return (pair_t *)red_black_tree_min(map->tree);
+}
+
+/**
+ * @brief Get the key-value pair with the greatest key.
+ * @param map The tree_map_t object.
+ * @return Returns the pair_t object if the map is not empty, otherwise returns NULL.
+ * @note The returned pair is owned by the map.
+ */
+pair_t *tree_map_last(const tree_map_t *map) {
+    return_value_if_fail(map != NULL, NULL);
+    return (pair_t *)red_black_tree_max(map->tree);
+}
+
+/**
+ * @brief Get the key-value pair whose key has the specified rank in O(log n).
+ * @param map The tree_map_t object.
+ * @param index The 0-based rank, i.e. the number of smaller keys.
+ * @return Returns the pair_t object if the index is valid, otherwise returns NULL.
+ * @note The returned pair is owned by the map.
+ */
+pair_t *tree_map_select(const tree_map_t *map, size_t index) {
+    return_value_if_fail(map != NULL, NULL);
+    return (pair_t *)red_black_tree_select(map->tree, index);
+}
+
+/**
+ * @brief Count the keys in the tree_map_t object which are less than the given key in O(log n).
+ * @param map The tree_map_t object.
+ * @param key The key, which does not need to be in the map.
+ * @return Returns the rank of the key.
+ * @note Caller MUST free the parameter `key` (if applicable).
+ */
+size_t tree_map_rank(const tree_map_t *map, T key) {
+    return_value_if_fail(map != NULL && key != NULL, 0);
+    return red_black_tree_rank(map->tree, key);
 }
 
 /**
@@ -203,6 +291,29 @@ iterator_t *tree_map_iterator_new(const tree_map_t *map) {
     return red_black_tree_iterator_new(map->tree);
 }
 
+/**
+ * @brief Create an iterator over the pairs whose keys are in [lo, hi) of a tree_map_t object in ascending order.
+ * @param map The tree_map_t object.
+ * @param lo The inclusive lower bound, or NULL for no lower bound.
+ * @param hi The exclusive upper bound, or NULL for no upper bound.
+ * @return Returns the iterator for container.
+ * @note Caller MUST free the parameters `lo` and `hi` (if applicable).
+ */
+iterator_t *tree_map_iterator_range(const tree_map_t *map, T lo, T hi) {
+    return_value_if_fail(map != NULL, NULL);
+    return red_black_tree_iterator_range(map->tree, lo, hi);
+}
+
+/**
+ * @brief Create an iterator for a tree_map_t object in descending order of keys.
+ * @param map The tree_map_t object.
+ * @return Returns the iterator for container.
+ */
+iterator_t *tree_map_iterator_reverse(const tree_map_t *map) {
+    return_value_if_fail(map != NULL, NULL);
+    return red_black_tree_iterator_reverse(map->tree);
+}
+
 /**
  * @brief Destroy an iterator.
  * @param iterator The iterator_t object.
@@ -7,29 +7,68 @@ struct tree_set_t {
 };
 
 /**
- * @brief Create a tree_set_t object.
+ * @brief Wrap a red_black_tree_t object into a tree_set_t object.
+ * @param tree The red_black_tree_t object, or NULL if its creation failed.
  * @param compare Callback function for comparing two data items.
- * @param destroy Callback function for destroying a data item.
  * @return Returns the created tree_set_t object if successful, otherwise returns NULL.
  */
-tree_set_t *tree_set_new(compare_t compare, destroy_t destroy) {
+static tree_set_t *__tree_set_new(red_black_tree_t *tree, compare_t compare) {
     tree_set_t *set = NULL;
 
-    return_value_if_fail(compare != NULL, NULL);
+    return_value_if_fail(tree != NULL, NULL);
 
     set = (tree_set_t *)malloc(sizeof(tree_set_t));
-    return_value_if_fail(set != NULL, NULL);
-
-    set->tree = red_black_tree_new(compare, destroy);
-    if (set->tree == NULL) {
-        free(set);
+    if (set == NULL) {
+        red_black_tree_delete(tree);
         return NULL;
     }
 
+    set->tree = tree;
     set->compare = compare;
     return set;
 }
 
+/**
+ * @brief Create a tree_set_t object.
+ * @param compare Callback function for comparing two data items.
+ * @param destroy Callback function for destroying a data item.
+ * @return Returns the created tree_set_t object if successful, otherwise returns NULL.
+ */
+tree_set_t *tree_set_new(compare_t compare, destroy_t destroy) {
+    return_value_if_fail(compare != NULL, NULL);
+    return __tree_set_new(red_black_tree_new(compare, destroy), compare);
+}
+
+/**
+ * @brief Create a tree_set_t object from the elements of an array_t object in strictly ascending order in O(n).
+ * @param compare Callback function for comparing two data items.
+ * @param destroy Callback function for destroying a data item.
+ * @param array The array_t object.
+ * @return Returns the created tree_set_t object if successful, otherwise returns NULL,
+ *         including when the elements are not in strictly ascending order.
+ * @note The set takes over the elements if successful. Caller MUST NOT destroy them through the array
+ *       afterwards (e.g. create the array with a NULL destroy callback).
+ */
+tree_set_t *tree_set_from_sorted(compare_t compare, destroy_t destroy, const array_t *array) {
+    return_value_if_fail(compare != NULL && array != NULL, NULL);
+    return __tree_set_new(red_black_tree_new_from_sorted(compare, NULL, destroy, array), compare);
+}
+
+/**
+ * @brief Create a tree_set_t object from the elements of an array_t object in any order in O(n log n).
+ *        Of several equal elements the first one is kept and the others are destroyed (if applicable), like tree_set_add.
+ * @param compare Callback function for comparing two data items.
+ * @param destroy Callback function for destroying a data item.
+ * @param array The array_t object.
+ * @return Returns the created tree_set_t object if successful, otherwise returns NULL.
+ * @note The set takes over the elements if successful. Caller MUST NOT destroy them through the array
+ *       afterwards (e.g. create the array with a NULL destroy callback).
+ */
+tree_set_t *tree_set_from_array(compare_t compare, destroy_t destroy, const array_t *array) {
+    return_value_if_fail(compare != NULL && array != NULL, NULL);
+    return __tree_set_new(red_black_tree_new_from_array(compare, NULL, destroy, array, false), compare);
+}
+
 /**
  * @brief Destroy a tree_set_t object.
  * @param set The tree_set_t object.
@@ -119,46 +158,155 @@ tree_set_t *tree_set_remove(tree_set_t *set, T elem) {
 }
 
 /**
- * @brief Get the union of two tree_set_t objects.
- * @param set1 The first tree_set_t object.
- * @param set2 The second tree_set_t object.
- * @return Returns the union of two tree_set_t objects.
- * @note Caller MUST destroy the returned union tree_set_t object.
+ * @brief Get the element with the specified rank in the tree_set_t object in O(log n).
+ * @param set The tree_set_t object.
+ * @param index The 0-based rank, i.e. the number of smaller elements.
+ * @return Returns the element if the index is valid, otherwise returns NULL.
  */
-tree_set_t *tree_set_union(const tree_set_t *set1, const tree_set_t *set2) {
-    tree_set_t *union_set = NULL;
-    iterator_t *iterator = NULL;
-    T elem = NULL;
+T tree_set_select(const tree_set_t *set, size_t index) {
+    return_value_if_fail(set != NULL, NULL);
+    return red_black_tree_select(set->tree, index);
+}
 
-    return_value_if(set1 == NULL && set2 == NULL, NULL);
+/**
+ * @brief Count the elements in the tree_set_t object which are less than the given element in O(log n).
+ * @param set The tree_set_t object.
+ * @param elem The element, which does not need to be in the set.
+ * @return Returns the rank of the element.
+ * @note Caller MUST free the parameter `elem` (if applicable).
+ */
+size_t tree_set_rank(const tree_set_t *set, T elem) {
+    return_value_if_fail(set != NULL && elem != NULL, 0);
+    return red_black_tree_rank(set->tree, elem);
+}
+
+/**
+ * @brief Which elements of a merge of two tree_set_t objects end up in the result.
+ */
+typedef enum {
+    ONLY_FIRST = 1,
+    ONLY_SECOND = 2,
+    IN_BOTH = 4
+} merge_t;
+
+/**
+ * @brief Create an iterator for a tree_set_t object which may be NULL.
+ * @param set The tree_set_t object, or NULL for an empty set.
+ * @param iterator Output parameter for the iterator, or NULL for an empty set.
+ * @return Returns true if successful, otherwise returns false.
+ */
+static bool __iterator_new(const tree_set_t *set, iterator_t **iterator) {
+    *iterator = NULL;
+    return_value_if(set == NULL, true);
+    *iterator = red_black_tree_iterator_new(set->tree);
+    return *iterator != NULL;
+}
+
+/**
+ * @brief Get the next element of an iterator, or NULL once it is exhausted.
+ * @param iterator The iterator_t object, or NULL.
+ * @return Returns the next element if exists, otherwise returns NULL.
+ */
+static T __next(iterator_t *iterator) {
+    return_value_if_fail(red_black_tree_iterator_has_next(iterator), NULL);
+    return red_black_tree_iterator_next(iterator);
+}
+
+/**
+ * @brief Append an element to an array_t object.
+ * @param array The array_t object.
+ * @param elem The element.
+ * @return Returns true if the element was appended, otherwise returns false.
+ */
+static bool __append(array_t *array, T elem) {
+    size_t size = array_size(array);
+
+    array_append(array, elem);
+    return array_size(array) == size + 1;
+}
 
-    if (set1 == NULL) {
-        union_set = tree_set_new(set2->compare, NULL);
-    } else {
-        union_set = tree_set_new(set1->compare, NULL);
+/**
+ * @brief Merge two tree_set_t objects with two cursors over their in-order iterators.
+ *        The selected elements come out in ascending order, so the result is built in bulk.
+ *        The whole operation is O(m + n).
+ * @param set1 The first tree_set_t object, or NULL for an empty set.
+ * @param set2 The second tree_set_t object, or NULL for an empty set.
+ * @param keep A combination of merge_t flags selecting the elements to keep.
+ * @return Returns the result tree_set_t object, which shares elements with the inputs, or NULL if out of memory.
+ */
+static tree_set_t *__merge(const tree_set_t *set1, const tree_set_t *set2, int keep) {
+    tree_set_t *result = NULL;
+    compare_t compare = NULL;
+    array_t *elems = NULL;
+    iterator_t *iterator1 = NULL;
+    iterator_t *iterator2 = NULL;
+    T elem1 = NULL;
+    T elem2 = NULL;
+    bool appended = true;
+    int cmp;
+
+    compare = set1 != NULL ? set1->compare : set2->compare;
+    elems = array_new(NULL, NULL);
+    return_value_if_fail(elems != NULL, NULL);
+
+    if (!__iterator_new(set1, &iterator1) || !__iterator_new(set2, &iterator2)) {
+        red_black_tree_iterator_delete(iterator1);
+        array_delete(elems);
+        return NULL;
     }
-    return_value_if_fail(union_set != NULL, NULL);
 
-    if (set1 != NULL) {
-        iterator = red_black_tree_iterator_new(set1->tree);
-        while (red_black_tree_iterator_has_next(iterator)) {
-            elem = red_black_tree_iterator_next(iterator);
-            tree_set_add(union_set, elem);
+    elem1 = __next(iterator1);
+    elem2 = __next(iterator2);
+    while (appended && (elem1 != NULL || elem2 != NULL)) {
+        if (elem1 == NULL) {
+            cmp = 1;
+        } else if (elem2 == NULL) {
+            cmp = -1;
+        } else {
+            cmp = compare(elem1, elem2);
         }
-        red_black_tree_iterator_delete(iterator);
-    }
 
-    if (set2 != NULL) {
-        iterator = red_black_tree_iterator_new(set2->tree);
-        return_value_if_fail(iterator != NULL, NULL);
-        while (red_black_tree_iterator_has_next(iterator)) {
-            elem = red_black_tree_iterator_next(iterator);
-            tree_set_add(union_set, elem);
+        if (cmp < 0) {
+            if (keep & ONLY_FIRST) {
+                appended = __append(elems, elem1);
+            }
+            elem1 = __next(iterator1);
+        } else if (cmp > 0) {
+            if (keep & ONLY_SECOND) {
+                appended = __append(elems, elem2);
+            }
+            elem2 = __next(iterator2);
+        } else {
+            if (keep & IN_BOTH) {
+                appended = __append(elems, elem1);
+            }
+            elem1 = __next(iterator1);
+            elem2 = __next(iterator2);
         }
-        red_black_tree_iterator_delete(iterator);
+    }
+    red_black_tree_iterator_delete(iterator1);
+    red_black_tree_iterator_delete(iterator2);
+
+    if (!appended) {
+        array_delete(elems);
+        return NULL;
     }
 
-    return union_set;
+    result = tree_set_from_sorted(compare, NULL, elems);
+    array_delete(elems);
+    return result;
+}
+
+/**
+ * @brief Get the union of two tree_set_t objects.
+ * @param set1 The first tree_set_t object.
+ * @param set2 The second tree_set_t object.
+ * @return Returns the union of two tree_set_t objects.
+ * @note Caller MUST destroy the returned union tree_set_t object.
+ */
+tree_set_t *tree_set_union(const tree_set_t *set1, const tree_set_t *set2) {
+    return_value_if(set1 == NULL && set2 == NULL, NULL);
+    return __merge(set1, set2, ONLY_FIRST | ONLY_SECOND | IN_BOTH);
 }
 
 /**
@@ -169,31 +317,8 @@ tree_set_t *tree_set_union(const tree_set_t *set1, const tree_set_t *set2) {
  * @note Caller MUST destroy the returned intersection tree_set_t object.
  */
 tree_set_t *tree_set_intersection(const tree_set_t *set1, const tree_set_t *set2) {
-    tree_set_t *intersection_set = NULL;
-    iterator_t *iterator = NULL;
-    T elem = NULL;
-
     return_value_if(set1 == NULL && set2 == NULL, NULL);
-
-    if (set1 == NULL) {
-        intersection_set = tree_set_new(set2->compare, NULL);
-    } else {
-        intersection_set = tree_set_new(set1->compare, NULL);
-    }
-    return_value_if_fail(intersection_set != NULL, NULL);
-
-    return_value_if(set1 == NULL || set2 == NULL, intersection_set);
-
-    iterator = red_black_tree_iterator_new(set1->tree);
-    while (red_black_tree_iterator_has_next(iterator)) {
-        elem = red_black_tree_iterator_next(iterator);
-        if (tree_set_contains(set2, elem)) {
-            tree_set_add(intersection_set, elem);
-        }
-    }
-    red_black_tree_iterator_delete(iterator);
-
-    return intersection_set;
+    return __merge(set1, set2, IN_BOTH);
 }
 
 /**
@@ -205,25 +330,8 @@ tree_set_t *tree_set_intersection(const tree_set_t *set1, const tree_set_t *set2
  * @note Caller MUST destroy the returned difference tree_set_t object.
  */
 tree_set_t *tree_set_difference(const tree_set_t *set1, const tree_set_t *set2) {
-    tree_set_t *difference_set = NULL;
-    iterator_t *iterator = NULL;
-    T elem = NULL;
-
     return_value_if_fail(set1 != NULL, NULL);
-
-    difference_set = tree_set_new(set1->compare, NULL);
-    return_value_if_fail(difference_set != NULL, NULL);
-
-    iterator = red_black_tree_iterator_new(set1->tree);
-    while (red_black_tree_iterator_has_next(iterator)) {
-        elem = red_black_tree_iterator_next(iterator);
-        if (!tree_set_contains(set2, elem)) {
-            tree_set_add(difference_set, elem);
-        }
-    }
-    red_black_tree_iterator_delete(iterator);
-
-    return difference_set;
+    return __merge(set1, set2, ONLY_FIRST);
 }
 
 /**
@@ -235,19 +343,8 @@ tree_set_t *tree_set_difference(const tree_set_t *set1, const tree_set_t *set2)
  * @note Caller MUST destroy the returned symmetric difference tree_set_t object.
  */
 tree_set_t *tree_set_symmetric_difference(const tree_set_t *set1, const tree_set_t *set2) {
-    tree_set_t *union_set = NULL;
-    tree_set_t *intersection_set = NULL;
-    tree_set_t *symmetric_difference_set = NULL;
-
     return_value_if(set1 == NULL && set2 == NULL, NULL);
-
-    union_set = tree_set_union(set1, set2);
-    intersection_set = tree_set_intersection(set1, set2);
-    symmetric_difference_set = tree_set_difference(union_set, intersection_set);
-
-    tree_set_delete(union_set);
-    tree_set_delete(intersection_set);
-    return symmetric_difference_set;
+    return __merge(set1, set2, ONLY_FIRST | ONLY_SECOND);
 }
 
 /**
@@ -255,17 +352,39 @@ tree_set_t *tree_set_symmetric_difference(const tree_set_t *set1, const tree_set
  *        Two sets are disjoint if their intersection is empty.
  * @param set1 The first tree_set_t object.
  * @param set2 The second tree_set_t object.
- * @return Returns true if two tree_set_t objects are disjoint, otherwise returns false.
+ * @return Returns true if two tree_set_t objects are disjoint, otherwise returns false,
+ *         including when the iterators cannot be allocated.
  */
 bool tree_set_is_disjoint(const tree_set_t *set1, const tree_set_t *set2) {
-    tree_set_t *intersection_set = NULL;
-    bool is_disjoint = false;
+    iterator_t *iterator1 = NULL;
+    iterator_t *iterator2 = NULL;
+    T elem1 = NULL;
+    T elem2 = NULL;
+    bool is_disjoint = true;
+    int cmp;
 
     return_value_if_fail(set1 != NULL && set2 != NULL, true);
 
-    intersection_set = tree_set_intersection(set1, set2);
-    is_disjoint = tree_set_is_empty(intersection_set);
-    tree_set_delete(intersection_set);
+    if (!__iterator_new(set1, &iterator1) || !__iterator_new(set2, &iterator2)) {
+        red_black_tree_iterator_delete(iterator1);
+        return false;
+    }
+    elem1 = __next(iterator1);
+    elem2 = __next(iterator2);
+    while (elem1 != NULL && elem2 != NULL) {
+        cmp = set1->compare(elem1, elem2);
+        if (cmp < 0) {
+            elem1 = __next(iterator1);
+        } else if (cmp > 0) {
+            elem2 = __next(iterator2);
+        } else {
+            is_disjoint = false;
+            break;
+        }
+    }
+    red_black_tree_iterator_delete(iterator1);
+    red_black_tree_iterator_delete(iterator2);
+
     return is_disjoint;
 }
 
@@ -274,27 +393,41 @@ bool tree_set_is_disjoint(const tree_set_t *set1, const tree_set_t *set2) {
  *        A is a subset B if every element of A is also an element of B.
  * @param set1 The first tree_set_t object.
  * @param set2 The second tree_set_t object.
- * @return Returns true if set1 is a subset of set2, otherwise returns false.
+ * @return Returns true if set1 is a subset of set2, otherwise returns false,
+ *         including when the iterators cannot be allocated.
  */
 bool tree_set_is_subset(const tree_set_t *set1, const tree_set_t *set2) {
-    iterator_t *iterator = NULL;
-    T elem = NULL;
-    bool is_subset = true;
+    iterator_t *iterator1 = NULL;
+    iterator_t *iterator2 = NULL;
+    T elem1 = NULL;
+    T elem2 = NULL;
+    int cmp;
 
     return_value_if(set1 == NULL, true);
     return_value_if(set2 == NULL, false);
+    return_value_if(tree_set_size(set1) > tree_set_size(set2), false);
 
-    iterator = red_black_tree_iterator_new(set1->tree);
-    while (red_black_tree_iterator_has_next(iterator)) {
-        elem = red_black_tree_iterator_next(iterator);
-        if (!tree_set_contains(set2, elem)) {
-            is_subset = false;
+    if (!__iterator_new(set1, &iterator1) || !__iterator_new(set2, &iterator2)) {
+        red_black_tree_iterator_delete(iterator1);
+        return false;
+    }
+    elem1 = __next(iterator1);
+    elem2 = __next(iterator2);
+
+    /* Every element of set1 must be met while walking set2 */
+    while (elem1 != NULL && elem2 != NULL) {
+        cmp = set1->compare(elem1, elem2);
+        if (cmp < 0) {
             break;
+        } else if (cmp == 0) {
+            elem1 = __next(iterator1);
         }
+        elem2 = __next(iterator2);
     }
-    red_black_tree_iterator_delete(iterator);
-    
-    return is_subset;
+    red_black_tree_iterator_delete(iterator1);
+    red_black_tree_iterator_delete(iterator2);
+
+    return elem1 == NULL;
 }
 
 /**
@@ -307,6 +440,29 @@ iterator_t *tree_set_iterator_new(const tree_set_t *set) {
     return red_black_tree_iterator_new(set->tree);
 }
 
+/**
+ * @brief Create an iterator over the elements in [lo, hi) of a tree_set_t object in ascending order.
+ * @param set The tree_set_t object.
+ * @param lo The inclusive lower bound, or NULL for no lower bound.
+ * @param hi The exclusive upper bound, or NULL for no upper bound.
+ * @return Returns the iterator for container.
+ * @note Caller MUST free the parameters `lo` and `hi` (if applicable).
+ */
+iterator_t *tree_set_iterator_range(const tree_set_t *set, T lo, T hi) {
+    return_value_if_fail(set != NULL, NULL);
+    return red_black_tree_iterator_range(set->tree, lo, hi);
+}
+
+/**
+ * @brief Create an iterator for a tree_set_t object in descending order.
+ * @param set The tree_set_t object.
+ * @return Returns the iterator for container.
+ */
+iterator_t *tree_set_iterator_reverse(const tree_set_t *set) {
+    return_value_if_fail(set != NULL, NULL);
+    return red_black_tree_iterator_reverse(set->tree);
+}
+
 /**
  * @brief Destroy an iterator.
  * @param iterator The iterator_t object.
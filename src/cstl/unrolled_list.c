@@ -0,0 +1,597 @@
+#include "cstl/unrolled_list.h"
+#include <string.h>
+
+#define CHUNK_CAPACITY 16
+
+typedef struct chunk_t {
+    struct chunk_t *prev;
+    struct chunk_t *next;
+    size_t count;
+    T data[CHUNK_CAPACITY];
+} chunk_t;
+
+struct unrolled_list_t {
+    chunk_t *head;
+    chunk_t *tail;
+    size_t size;
+    compare_t compare;
+    destroy_t destroy;
+    pool_t *pool;
+};
+
+typedef struct unrolled_list_iterator_t {
+    iterator_t iterator;
+    size_t offset;
+} unrolled_list_iterator_t;
+
+/**
+ * @brief Create an empty chunk_t object and link it after the specified chunk.
+ * @param list The unrolled_list_t object which owns the chunk.
+ * @param chunk The chunk_t object to link after, or NULL to link at the beginning.
+ * @return Returns the created chunk_t object if successful, otherwise returns NULL.
+ */
+static chunk_t *__chunk_new_after(unrolled_list_t *list, chunk_t *chunk) {
+    chunk_t *new_chunk = (chunk_t *)pool_alloc(list->pool);
+    return_value_if_fail(new_chunk != NULL, NULL);
+
+    new_chunk->count = 0;
+    new_chunk->prev = chunk;
+    new_chunk->next = chunk == NULL ? list->head : chunk->next;
+
+    if (new_chunk->prev == NULL) {
+        list->head = new_chunk;
+    } else {
+        new_chunk->prev->next = new_chunk;
+    }
+
+    if (new_chunk->next == NULL) {
+        list->tail = new_chunk;
+    } else {
+        new_chunk->next->prev = new_chunk;
+    }
+
+    return new_chunk;
+}
+
+/**
+ * @brief Unlink a chunk_t object from the unrolled_list_t object and destroy it without destroying its elements.
+ * @param list The unrolled_list_t object which owns the chunk.
+ * @param chunk The chunk_t object.
+ */
+static void __chunk_delete(unrolled_list_t *list, chunk_t *chunk) {
+    if (chunk->prev == NULL) {
+        list->head = chunk->next;
+    } else {
+        chunk->prev->next = chunk->next;
+    }
+
+    if (chunk->next == NULL) {
+        list->tail = chunk->prev;
+    } else {
+        chunk->next->prev = chunk->prev;
+    }
+
+    pool_free(list->pool, chunk);
+}
+
+/**
+ * @brief Get the chunk_t object holding the specified position.
+ * @param list The unrolled_list_t object.
+ * @param index The index.
+ * @param offset Receives the position of the element inside the returned chunk.
+ * @return Returns the chunk_t object if successful, otherwise returns NULL.
+ */
+static chunk_t *__chunk_get(const unrolled_list_t *list, size_t index, size_t *offset) {
+    chunk_t *chunk = NULL;
+    size_t start = 0;
+
+    return_value_if_fail(list != NULL && offset != NULL, NULL);
+    return_value_if_fail(index >= 0 && index < list->size, NULL);
+
+    if (index <= list->size / 2) {
+        chunk = list->head;
+        while (index >= start + chunk->count) {
+            start += chunk->count;
+            chunk = chunk->next;
+        }
+    } else {
+        chunk = list->tail;
+        start = list->size - chunk->count;
+        while (index < start) {
+            chunk = chunk->prev;
+            start -= chunk->count;
+        }
+    }
+
+    *offset = index - start;
+    return chunk;
+}
+
+/**
+ * @brief Create an unrolled_list_t object.
+ * @param compare Callback function for comparing two data items.
+ * @param destroy Callback function for destroying a data item.
+ * @return Returns the created unrolled_list_t object if successful, otherwise returns NULL.
+ */
+unrolled_list_t *unrolled_list_new(compare_t compare, destroy_t destroy) {
+    unrolled_list_t *list = (unrolled_list_t *)malloc(sizeof(unrolled_list_t));
+    return_value_if_fail(list != NULL, NULL);
+
+    list->pool = pool_new(sizeof(chunk_t));
+    if (list->pool == NULL) {
+        free(list);
+        return NULL;
+    }
+
+    list->head = NULL;
+    list->tail = NULL;
+    list->size = 0;
+    list->compare = compare;
+    list->destroy = destroy;
+    return list;
+}
+
+/**
+ * @brief Destroy an unrolled_list_t object.
+ * @param list The unrolled_list_t object.
+ */
+void unrolled_list_delete(unrolled_list_t *list) {
+    return_if_fail(list != NULL);
+    unrolled_list_clear(list);
+    pool_delete(list->pool);
+    free(list);
+}
+
+/**
+ * @brief Determine whether the unrolled_list_t object is empty.
+ * @param list The unrolled_list_t object.
+ * @return Returns true if the unrolled_list_t object is empty, otherwise returns false.
+ */
+bool unrolled_list_is_empty(const unrolled_list_t *list) {
+    return_value_if_fail(list != NULL, true);
+    return list->size == 0;
+}
+
+/**
+ * @brief Get the size of the unrolled_list_t object.
+ * @param list The unrolled_list_t object.
+ * @return Returns the size of the unrolled_list_t object.
+ */
+size_t unrolled_list_size(const unrolled_list_t *list) {
+    return_value_if_fail(list != NULL, 0);
+    return list->size;
+}
+
+/**
+ * @brief Traverse the unrolled_list_t object.
+ * @param list The unrolled_list_t object.
+ * @param visit Callback function for visiting a data item.
+ */
+void unrolled_list_foreach(unrolled_list_t *list, visit_t visit) {
+    chunk_t *chunk = NULL;
+    size_t i = 0;
+
+    return_if_fail(list != NULL && visit != NULL);
+
+    for (chunk = list->head; chunk != NULL; chunk = chunk->next) {
+        for (i = 0; i < chunk->count; i++) {
+            visit(chunk->data[i]);
+        }
+    }
+}
+
+/**
+ * @brief Clear the unrolled_list_t object.
+ * @param list The unrolled_list_t object.
+ * @return Returns the modified unrolled_list_t object.
+ */
+unrolled_list_t *unrolled_list_clear(unrolled_list_t *list) {
+    chunk_t *chunk = NULL;
+    size_t i = 0;
+
+    return_value_if_fail(list != NULL, NULL);
+
+    if (list->destroy != NULL) {
+        for (chunk = list->head; chunk != NULL; chunk = chunk->next) {
+            for (i = 0; i < chunk->count; i++) {
+                list->destroy(chunk->data[i]);
+            }
+        }
+    }
+
+    /* Chunks come from a private pool, so they are released in bulk */
+    pool_clear(list->pool);
+
+    list->head = NULL;
+    list->tail = NULL;
+    list->size = 0;
+    return list;
+}
+
+/**
+ * @brief Get the element at the specified position in the unrolled_list_t object.
+ * @param list The unrolled_list_t object.
+ * @param index The index.
+ * @return Returns the element at the specified position if successful, otherwise returns NULL.
+ */
+T unrolled_list_get(const unrolled_list_t *list, size_t index) {
+    chunk_t *chunk = NULL;
+    size_t offset = 0;
+
+    return_value_if_fail(list != NULL, NULL);
+    return_value_if_fail(index >= 0 && index < list->size, NULL);
+
+    chunk = __chunk_get(list, index, &offset);
+    return_value_if_fail(chunk != NULL, NULL);
+    return chunk->data[offset];
+}
+
+/**
+ * @brief Set the element at the specified position in the unrolled_list_t object.
+ * @param list The unrolled_list_t object.
+ * @param index The index.
+ * @param elem The element.
+ * @return Returns the modified unrolled_list_t object.
+ */
+unrolled_list_t *unrolled_list_set(unrolled_list_t *list, size_t index, T elem) {
+    chunk_t *chunk = NULL;
+    size_t offset = 0;
+
+    return_value_if_fail(list != NULL, NULL);
+    return_value_if_fail(index >= 0 && index < list->size, list);
+    return_value_if_fail(elem != NULL, list);
+
+    chunk = __chunk_get(list, index, &offset);
+    return_value_if_fail(chunk != NULL, list);
+
+    if (list->destroy != NULL) {
+        list->destroy(chunk->data[offset]);
+    }
+
+    chunk->data[offset] = elem;
+    return list;
+}
+
+/**
+ * @brief Get the index of the specified element in the unrolled_list_t object.
+ * @param list The unrolled_list_t object.
+ * @param elem The element.
+ * @return Returns the index of the specified element if found, otherwise returns -1.
+ */
+int unrolled_list_index_of(const unrolled_list_t *list, T elem) {
+    chunk_t *chunk = NULL;
+    size_t i = 0;
+    int index = 0;
+
+    return_value_if_fail(list != NULL && elem != NULL, -1);
+    return_value_if_fail(list->compare != NULL, -1);
+
+    for (chunk = list->head; chunk != NULL; chunk = chunk->next) {
+        for (i = 0; i < chunk->count; i++) {
+            if (list->compare(chunk->data[i], elem) == 0) {
+                return index + (int)i;
+            }
+        }
+        index += (int)chunk->count;
+    }
+
+    return -1;
+}
+
+/**
+ * @brief Determine whether the unrolled_list_t object contains the specified element.
+ * @param list The unrolled_list_t object.
+ * @param elem The element.
+ * @return Returns true if the unrolled_list_t object contains the specified element, otherwise returns false.
+ */
+bool unrolled_list_contains(const unrolled_list_t *list, T elem) {
+    return_value_if_fail(list != NULL && elem != NULL, false);
+    return unrolled_list_index_of(list, elem) != -1;
+}
+
+/**
+ * @brief Count the number of occurrences of the specified element in the unrolled_list_t object.
+ * @param list The unrolled_list_t object.
+ * @param elem The element.
+ * @return Returns the number of occurrences of the specified element.
+ */
+size_t unrolled_list_count(const unrolled_list_t *list, T elem) {
+    size_t count = 0;
+    chunk_t *chunk = NULL;
+    size_t i = 0;
+
+    return_value_if_fail(list != NULL && elem != NULL, 0);
+    return_value_if_fail(list->compare != NULL, 0);
+
+    for (chunk = list->head; chunk != NULL; chunk = chunk->next) {
+        for (i = 0; i < chunk->count; i++) {
+            if (list->compare(chunk->data[i], elem) == 0) {
+                count++;
+            }
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Get the first element of the unrolled_list_t object.
+ * @param list The unrolled_list_t object.
+ * @return Returns the first element if successful, otherwise returns NULL.
+ */
+T unrolled_list_get_front(const unrolled_list_t *list) {
+    return_value_if_fail(list != NULL, NULL);
+    return_value_if_fail(list->size > 0, NULL);
+    return list->head->data[0];
+}
+
+/**
+ * @brief Get the last element of the unrolled_list_t object.
+ * @param list The unrolled_list_t object.
+ * @return Returns the last element if successful, otherwise returns NULL.
+ */
+T unrolled_list_get_back(const unrolled_list_t *list) {
+    return_value_if_fail(list != NULL, NULL);
+    return_value_if_fail(list->size > 0, NULL);
+    return list->tail->data[list->tail->count - 1];
+}
+
+/**
+ * @brief Insert the specified element at the beginning of the unrolled_list_t object.
+ * @param list The unrolled_list_t object.
+ * @param elem The element.
+ * @return Returns the modified unrolled_list_t object.
+ */
+unrolled_list_t *unrolled_list_push_front(unrolled_list_t *list, T elem) {
+    chunk_t *chunk = NULL;
+
+    return_value_if_fail(list != NULL, NULL);
+    return_value_if_fail(elem != NULL, list);
+
+    chunk = list->head;
+    if (chunk == NULL || chunk->count == CHUNK_CAPACITY) {
+        chunk = __chunk_new_after(list, NULL);
+        return_value_if_fail(chunk != NULL, list);
+    }
+
+    memmove(chunk->data + 1, chunk->data, chunk->count * sizeof(T));
+    chunk->data[0] = elem;
+    chunk->count++;
+    list->size++;
+    return list;
+}
+
+/**
+ * @brief Insert the specified element at the end of the unrolled_list_t object.
+ * @param list The unrolled_list_t object.
+ * @param elem The element.
+ * @return Returns the modified unrolled_list_t object.
+ */
+unrolled_list_t *unrolled_list_push_back(unrolled_list_t *list, T elem) {
+    chunk_t *chunk = NULL;
+
+    return_value_if_fail(list != NULL, NULL);
+    return_value_if_fail(elem != NULL, list);
+
+    chunk = list->tail;
+    if (chunk == NULL || chunk->count == CHUNK_CAPACITY) {
+        chunk = __chunk_new_after(list, list->tail);
+        return_value_if_fail(chunk != NULL, list);
+    }
+
+    chunk->data[chunk->count++] = elem;
+    list->size++;
+    return list;
+}
+
+/**
+ * @brief Remove the first element of the unrolled_list_t object.
+ * @param list The unrolled_list_t object.
+ * @return Returns the removed element if successful, otherwise returns NULL.
+ * @note Caller MUST free the returned element (if applicable).
+ */
+T unrolled_list_pop_front(unrolled_list_t *list) {
+    return_value_if_fail(list != NULL, NULL);
+    return_value_if_fail(list->size > 0, NULL);
+    return unrolled_list_remove(list, 0);
+}
+
+/**
+ * @brief Remove the last element of the unrolled_list_t object.
+ * @param list The unrolled_list_t object.
+ * @return Returns the removed element if successful, otherwise returns NULL.
+ * @note Caller MUST free the returned element (if applicable).
+ */
+T unrolled_list_pop_back(unrolled_list_t *list) {
+    chunk_t *chunk = NULL;
+    T elem = NULL;
+
+    return_value_if_fail(list != NULL, NULL);
+    return_value_if_fail(list->size > 0, NULL);
+
+    chunk = list->tail;
+    elem = chunk->data[--chunk->count];
+    if (chunk->count == 0) {
+        __chunk_delete(list, chunk);
+    }
+
+    list->size--;
+    return elem;
+}
+
+/**
+ * @brief Insert the specified element at the specified position in the unrolled_list_t object.
+ * @param list The unrolled_list_t object.
+ * @param index The index.
+ * @param elem The element.
+ * @return Returns the modified unrolled_list_t object.
+ */
+unrolled_list_t *unrolled_list_insert(unrolled_list_t *list, size_t index, T elem) {
+    chunk_t *chunk = NULL;
+    chunk_t *new_chunk = NULL;
+    size_t offset = 0;
+
+    return_value_if_fail(list != NULL, NULL);
+    return_value_if_fail(index >= 0 && index <= list->size, list);
+    return_value_if_fail(elem != NULL, list);
+
+    if (index == 0) {
+        return unrolled_list_push_front(list, elem);
+    } else if (index == list->size) {
+        return unrolled_list_push_back(list, elem);
+    }
+
+    chunk = __chunk_get(list, index, &offset);
+    return_value_if_fail(chunk != NULL, list);
+
+    /* Split a full chunk in half, so later inserts nearby do not split again */
+    if (chunk->count == CHUNK_CAPACITY) {
+        new_chunk = __chunk_new_after(list, chunk);
+        return_value_if_fail(new_chunk != NULL, list);
+
+        new_chunk->count = CHUNK_CAPACITY - CHUNK_CAPACITY / 2;
+        chunk->count = CHUNK_CAPACITY / 2;
+        memcpy(new_chunk->data, chunk->data + chunk->count, new_chunk->count * sizeof(T));
+
+        if (offset > chunk->count) {
+            offset -= chunk->count;
+            chunk = new_chunk;
+        }
+    }
+
+    memmove(chunk->data + offset + 1, chunk->data + offset, (chunk->count - offset) * sizeof(T));
+    chunk->data[offset] = elem;
+    chunk->count++;
+    list->size++;
+    return list;
+}
+
+/**
+ * @brief Removes the element at the specified position in the unrolled_list_t object.
+ * @param list The unrolled_list_t object.
+ * @param index The index.
+ * @return Returns the removed element if successful, otherwise returns NULL.
+ * @note Caller MUST free the returned element (if applicable).
+ */
+T unrolled_list_remove(unrolled_list_t *list, size_t index) {
+    chunk_t *chunk = NULL;
+    chunk_t *next_chunk = NULL;
+    size_t offset = 0;
+    T elem = NULL;
+
+    return_value_if_fail(list != NULL, NULL);
+    return_value_if_fail(index >= 0 && index < list->size, NULL);
+
+    chunk = __chunk_get(list, index, &offset);
+    return_value_if_fail(chunk != NULL, NULL);
+
+    elem = chunk->data[offset];
+    chunk->count--;
+    memmove(chunk->data + offset, chunk->data + offset + 1, (chunk->count - offset) * sizeof(T));
+    list->size--;
+
+    /* Drop empty chunks and merge sparse neighbours to keep the chunks dense */
+    next_chunk = chunk->next;
+    if (chunk->count == 0) {
+        __chunk_delete(list, chunk);
+    } else if (next_chunk != NULL && chunk->count + next_chunk->count <= CHUNK_CAPACITY / 2) {
+        memcpy(chunk->data + chunk->count, next_chunk->data, next_chunk->count * sizeof(T));
+        chunk->count += next_chunk->count;
+        __chunk_delete(list, next_chunk);
+    }
+
+    return elem;
+}
+
+/**
+ * @brief Reverse the unrolled_list_t object.
+ * @param list The unrolled_list_t object.
+ * @return Returns the modified unrolled_list_t object.
+ */
+unrolled_list_t *unrolled_list_reverse(unrolled_list_t *list) {
+    chunk_t *chunk = NULL;
+    chunk_t *temp = NULL;
+    size_t i = 0;
+    T elem = NULL;
+
+    return_value_if_fail(list != NULL, NULL);
+
+    chunk = list->head;
+    while (chunk != NULL) {
+        for (i = 0; i < chunk->count / 2; i++) {
+            elem = chunk->data[i];
+            chunk->data[i] = chunk->data[chunk->count - i - 1];
+            chunk->data[chunk->count - i - 1] = elem;
+        }
+
+        temp = chunk->next;
+        chunk->next = chunk->prev;
+        chunk->prev = temp;
+        chunk = temp;
+    }
+
+    temp = list->head;
+    list->head = list->tail;
+    list->tail = temp;
+    return list;
+}
+
+/**
+ * @brief Create an iterator for an unrolled_list_t object.
+ * @param list The unrolled_list_t object.
+ * @return Returns the iterator for container.
+ */
+iterator_t *unrolled_list_iterator_new(const unrolled_list_t *list) {
+    unrolled_list_iterator_t *iterator = NULL;
+
+    return_value_if_fail(list != NULL, NULL);
+
+    iterator = (unrolled_list_iterator_t *)malloc(sizeof(unrolled_list_iterator_t));
+    return_value_if_fail(iterator != NULL, NULL);
+
+    iterator->iterator.container = (void *)list;
+    iterator->iterator.current = list->head;
+    iterator->offset = 0;
+    return &iterator->iterator;
+}
+
+/**
+ * @brief Destroy an iterator.
+ * @param iterator The iterator_t object.
+ */
+void unrolled_list_iterator_delete(iterator_t *iterator) {
+    return_if_fail(iterator != NULL);
+    free(iterator);
+}
+
+/**
+ * @brief Determine whether an iterator has the next element.
+ * @param iterator The iterator_t object.
+ * @return Returns true if the iterator has the next element, otherwise returns false.
+ */
+bool unrolled_list_iterator_has_next(const iterator_t *iterator) {
+    return_value_if_fail(iterator != NULL, false);
+    /* Chunks are never empty, so a current chunk always has an element left */
+    return iterator->current != NULL;
+}
+
+/**
+ * @brief Get the next element of an iterator.
+ * @param iterator The iterator_t object.
+ * @return Returns the next element of the iterator.
+ */
+T unrolled_list_iterator_next(iterator_t *iterator) {
+    unrolled_list_iterator_t *unrolled_iterator = (unrolled_list_iterator_t *)iterator;
+    chunk_t *chunk = NULL;
+    T elem = NULL;
+
+    return_value_if_fail(iterator != NULL, NULL);
+    return_value_if_fail(unrolled_list_iterator_has_next(iterator), NULL);
+
+    chunk = (chunk_t *)iterator->current;
+    elem = chunk->data[unrolled_iterator->offset++];
+    if (unrolled_iterator->offset == chunk->count) {
+        iterator->current = chunk->next;
+        unrolled_iterator->offset = 0;
+    }
+    return elem;
+}
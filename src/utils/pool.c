@@ -0,0 +1,221 @@
+#include "utils/pool.h"
+#include "utils/exception.h"
+#include "utils/numeric.h"
+
+#define MIN_SLAB_BLOCKS 8
+#define MAX_SLAB_BLOCKS 1024
+#define GROWTH_FACTOR 2
+
+/**
+ * @brief Types with the strictest alignment, used to align blocks.
+ */
+typedef union align_t {
+    long l;
+    double d;
+    void *p;
+} align_t;
+
+typedef struct slab_t {
+    struct slab_t *next;
+} slab_t;
+
+typedef struct block_t {
+    struct block_t *next;
+} block_t;
+
+struct pool_t {
+    size_t block_size;
+    size_t slab_blocks;
+    slab_t *slabs;
+    block_t *free_list;
+    block_t *free_tail;
+};
+
+/**
+ * @brief Round a size up to the alignment of align_t.
+ * @param size The size in bytes.
+ * @return Returns the aligned size.
+ */
+static size_t __align(size_t size) {
+    return (size + sizeof(align_t) - 1) / sizeof(align_t) * sizeof(align_t);
+}
+
+/**
+ * @brief Create a pool_t object.
+ * @param block_size The size of each block in bytes.
+ * @return Returns the created pool_t object if successful, otherwise returns NULL.
+ */
+pool_t *pool_new(size_t block_size) {
+    pool_t *pool = NULL;
+
+    return_value_if_fail(block_size > 0, NULL);
+
+    pool = (pool_t *)malloc(sizeof(pool_t));
+    return_value_if_fail(pool != NULL, NULL);
+
+    pool->block_size = __align(max(block_size, sizeof(block_t)));
+    pool->slab_blocks = MIN_SLAB_BLOCKS;
+    pool->slabs = NULL;
+    pool->free_list = NULL;
+    pool->free_tail = NULL;
+    return pool;
+}
+
+/**
+ * @brief Destroy a pool_t object and release all of its slabs.
+ * @param pool The pool_t object.
+ * @note All blocks allocated from the pool become invalid.
+ */
+void pool_delete(pool_t *pool) {
+    return_if_fail(pool != NULL);
+    pool_clear(pool);
+    free(pool);
+}
+
+/**
+ * @brief Get the size of each block of a pool_t object.
+ * @param pool The pool_t object.
+ * @return Returns the block size in bytes.
+ */
+size_t pool_block_size(const pool_t *pool) {
+    return_value_if_fail(pool != NULL, 0);
+    return pool->block_size;
+}
+
+/**
+ * @brief Allocate a new slab and thread its blocks onto the free list in address order.
+ *        Each slab is twice as large as the previous one, up to MAX_SLAB_BLOCKS blocks.
+ * @param pool The pool_t object.
+ * @return Returns true if memory allocation is successful, otherwise returns false.
+ */
+static bool __pool_grow(pool_t *pool) {
+    slab_t *slab = NULL;
+    char *blocks = NULL;
+    block_t *block = NULL;
+    size_t i = 0;
+
+    return_value_if_fail(pool != NULL, false);
+
+    slab = (slab_t *)malloc(__align(sizeof(slab_t)) + pool->block_size * pool->slab_blocks);
+    return_value_if_fail(slab != NULL, false);
+
+    slab->next = pool->slabs;
+    pool->slabs = slab;
+
+    blocks = (char *)slab + __align(sizeof(slab_t));
+    for (i = 0; i < pool->slab_blocks; i++) {
+        block = (block_t *)(blocks + i * pool->block_size);
+        block->next = (block_t *)(blocks + (i + 1) * pool->block_size);
+    }
+    block->next = NULL;
+
+    pool->free_list = (block_t *)blocks;
+    pool->free_tail = block;
+    pool->slab_blocks = min(pool->slab_blocks * GROWTH_FACTOR, MAX_SLAB_BLOCKS);
+    return true;
+}
+
+/**
+ * @brief Allocate a block from a pool_t object.
+ * @param pool The pool_t object.
+ * @return Returns the allocated block if successful, otherwise returns NULL.
+ */
+void *pool_alloc(pool_t *pool) {
+    block_t *block = NULL;
+
+    return_value_if_fail(pool != NULL, NULL);
+
+    if (pool->free_list == NULL) {
+        return_value_if_fail(__pool_grow(pool), NULL);
+    }
+
+    block = pool->free_list;
+    pool->free_list = block->next;
+    if (pool->free_list == NULL) {
+        pool->free_tail = NULL;
+    }
+    return block;
+}
+
+/**
+ * @brief Return a block to a pool_t object.
+ * @param pool The pool_t object.
+ * @param block The block previously allocated from the same pool.
+ */
+void pool_free(pool_t *pool, void *block) {
+    block_t *free_block = (block_t *)block;
+
+    return_if_fail(pool != NULL && block != NULL);
+
+    if (pool->free_list == NULL) {
+        pool->free_tail = free_block;
+    }
+    free_block->next = pool->free_list;
+    pool->free_list = free_block;
+}
+
+/**
+ * @brief Release all slabs of a pool_t object at once.
+ * @param pool The pool_t object.
+ * @return Returns the modified pool_t object.
+ * @note All blocks allocated from the pool become invalid.
+ */
+pool_t *pool_clear(pool_t *pool) {
+    slab_t *slab = NULL;
+    slab_t *next_slab = NULL;
+
+    return_value_if_fail(pool != NULL, NULL);
+
+    slab = pool->slabs;
+    while (slab != NULL) {
+        next_slab = slab->next;
+        free(slab);
+        slab = next_slab;
+    }
+
+    pool->slab_blocks = MIN_SLAB_BLOCKS;
+    pool->slabs = NULL;
+    pool->free_list = NULL;
+    pool->free_tail = NULL;
+    return pool;
+}
+
+/**
+ * @brief Move all slabs and free blocks of `other` into `pool`.
+ *        Blocks allocated from `other` stay valid and are owned by `pool` afterwards.
+ * @param pool The pool_t object.
+ * @param other The pool_t object to be drained. It MUST have the same block size.
+ * @return Returns the modified pool_t object.
+ */
+pool_t *pool_merge(pool_t *pool, pool_t *other) {
+    slab_t *slab = NULL;
+
+    return_value_if_fail(pool != NULL, NULL);
+    return_value_if_fail(other != NULL && other != pool, pool);
+    return_value_if_fail(pool->block_size == other->block_size, pool);
+
+    if (other->slabs != NULL) {
+        slab = other->slabs;
+        while (slab->next != NULL) {
+            slab = slab->next;
+        }
+        slab->next = pool->slabs;
+        pool->slabs = other->slabs;
+    }
+
+    if (other->free_list != NULL) {
+        other->free_tail->next = pool->free_list;
+        if (pool->free_list == NULL) {
+            pool->free_tail = other->free_tail;
+        }
+        pool->free_list = other->free_list;
+    }
+
+    pool->slab_blocks = max(pool->slab_blocks, other->slab_blocks);
+
+    other->slab_blocks = MIN_SLAB_BLOCKS;
+    other->slabs = NULL;
+    other->free_list = NULL;
+    other->free_tail = NULL;
+    return pool;
+}
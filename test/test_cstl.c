@@ -3,19 +3,30 @@
 #include "test_utils/test_random.h"
 #include "test_utils/test_c_str.h"
 #include "test_utils/test_wrapper.h"
+#include "test_utils/test_pool.h"
 #include "test_cstl/test_str.h"
+#include "test_cstl/test_string_pool.h"
 #include "test_cstl/test_array.h"
 #include "test_cstl/test_list.h"
+#include "test_cstl/test_unrolled_list.h"
 #include "test_cstl/test_stack.h"
 #include "test_cstl/test_queue.h"
 #include "test_cstl/test_deque.h"
 #include "test_cstl/test_heap.h"
+#include "test_cstl/test_indexed_heap.h"
+#include "test_cstl/test_pairing_heap.h"
+#include "test_cstl/test_radix_heap.h"
+#include "test_cstl/test_timer_wheel.h"
 #include "test_cstl/test_red_black_tree.h"
+#include "test_cstl/test_btree.h"
 #include "test_cstl/test_hash_table.h"
 #include "test_cstl/test_tree_set.h"
+#include "test_cstl/test_btree_set.h"
 #include "test_cstl/test_hash_set.h"
 #include "test_cstl/test_tree_map.h"
+#include "test_cstl/test_btree_map.h"
 #include "test_cstl/test_hash_map.h"
+#include "test_cstl/test_persistent_map.h"
 
 void test_numeric() {
     test_min();
@@ -78,11 +89,23 @@ void test_wrapper() {
     printf("[PASS] wrapper\n");
 }
 
+void test_pool() {
+    test_pool_new();
+    test_pool_delete();
+    test_pool_alloc();
+    test_pool_free();
+    test_pool_clear();
+    test_pool_merge();
+
+    printf("[PASS] pool\n");
+}
+
 void test_utils() {
     test_numeric();
     test_random();
     test_c_str();
     test_wrapper();
+    test_pool();
 }
 
 void test_str() {
@@ -91,6 +114,9 @@ void test_str() {
     test_string_clone();
     test_string_length();
     test_string_is_empty();
+    test_string_capacity();
+    test_string_reserve();
+    test_string_shrink_to_fit();
     test_string_get();
     test_string_char_at();
     test_string_set_char_at();
@@ -112,6 +138,7 @@ void test_str() {
     test_string_append_char();
     test_string_insert_char();
     test_string_concat();
+    test_string_append_n();
     test_string_insert_string();
     test_string_remove_char();
     test_string_remove_string();
@@ -122,6 +149,22 @@ void test_str() {
     printf("[PASS] str\n");
 }
 
+void test_string_pool() {
+    test_string_pool_new();
+    test_string_pool_delete();
+    test_string_pool_is_empty();
+    test_string_pool_size();
+    test_string_pool_clear();
+    test_string_pool_intern();
+    test_string_pool_lookup();
+    test_string_pool_length();
+    test_string_pool_hash();
+    test_string_pool_compare();
+    test_string_pool_hash_map();
+
+    printf("[PASS] string_pool\n");
+}
+
 void test_array() {
     test_array_new();
     test_array_delete();
@@ -147,6 +190,7 @@ void test_array() {
 
 void test_list() {
     test_list_new();
+    test_list_new_with_pool();
     test_list_delete();
     test_list_is_empty();
     test_list_size();
@@ -166,11 +210,43 @@ void test_list() {
     test_list_remove();
     test_list_count();
     test_list_reverse();
+    test_list_sort();
+    test_list_splice();
+    test_list_merge();
     test_list_iterator();
+    test_list_iterator_remove();
+    test_list_iterator_set();
+    test_list_iterator_insert();
 
     printf("[PASS] list\n");
 }
 
+void test_unrolled_list() {
+    test_unrolled_list_new();
+    test_unrolled_list_delete();
+    test_unrolled_list_is_empty();
+    test_unrolled_list_size();
+    test_unrolled_list_foreach();
+    test_unrolled_list_clear();
+    test_unrolled_list_get();
+    test_unrolled_list_set();
+    test_unrolled_list_index_of();
+    test_unrolled_list_contains();
+    test_unrolled_list_count();
+    test_unrolled_list_get_front();
+    test_unrolled_list_get_back();
+    test_unrolled_list_push_front();
+    test_unrolled_list_push_back();
+    test_unrolled_list_pop_front();
+    test_unrolled_list_pop_back();
+    test_unrolled_list_insert();
+    test_unrolled_list_remove();
+    test_unrolled_list_reverse();
+    test_unrolled_list_iterator();
+
+    printf("[PASS] unrolled_list\n");
+}
+
 void test_stack() {
     test_stack_new();
     test_stack_delete();
@@ -215,6 +291,9 @@ void test_deque() {
 
 void test_heap() {
     test_heap_new();
+    test_heap_new_with_arity();
+    test_heap_new_from_array();
+    test_heap_new_from_array_ownership();
     test_heap_delete();
     test_heap_is_empty();
     test_heap_size();
@@ -222,12 +301,81 @@ void test_heap() {
     test_heap_push();
     test_heap_pop();
     test_heap_peek();
+    test_heap_push_many();
+    test_heap_pushpop();
+    test_heap_replace();
 
     printf("[PASS] heap\n");
 }
 
+void test_indexed_heap() {
+    test_indexed_heap_new();
+    test_indexed_heap_delete();
+    test_indexed_heap_is_empty();
+    test_indexed_heap_size();
+    test_indexed_heap_clear();
+    test_indexed_heap_push();
+    test_indexed_heap_pop();
+    test_indexed_heap_peek();
+    test_indexed_heap_get();
+    test_indexed_heap_update();
+    test_indexed_heap_decrease_key();
+    test_indexed_heap_remove();
+
+    printf("[PASS] indexed_heap\n");
+}
+
+void test_pairing_heap() {
+    test_pairing_heap_new();
+    test_pairing_heap_delete();
+    test_pairing_heap_is_empty();
+    test_pairing_heap_size();
+    test_pairing_heap_clear();
+    test_pairing_heap_push();
+    test_pairing_heap_pop();
+    test_pairing_heap_peek();
+    test_pairing_heap_meld();
+    test_pairing_heap_decrease_key();
+    test_pairing_heap_remove();
+
+    printf("[PASS] pairing_heap\n");
+}
+
+void test_radix_heap() {
+    test_radix_heap_new();
+    test_radix_heap_delete();
+    test_radix_heap_is_empty();
+    test_radix_heap_size();
+    test_radix_heap_clear();
+    test_radix_heap_push();
+    test_radix_heap_pop();
+    test_radix_heap_pop_key();
+    test_radix_heap_peek();
+    test_radix_heap_monotone();
+
+    printf("[PASS] radix_heap\n");
+}
+
+void test_timer_wheel() {
+    test_timer_wheel_new();
+    test_timer_wheel_delete();
+    test_timer_wheel_is_empty();
+    test_timer_wheel_size();
+    test_timer_wheel_clear();
+    test_timer_wheel_arm();
+    test_timer_wheel_rearm();
+    test_timer_wheel_cancel();
+    test_timer_wheel_advance();
+    test_timer_wheel_advance_reentrant();
+
+    printf("[PASS] timer_wheel\n");
+}
+
 void test_red_black_tree() {
     test_red_black_tree_new();
+    test_red_black_tree_new_with_key();
+    test_red_black_tree_new_from_sorted();
+    test_red_black_tree_new_from_array();
     test_red_black_tree_delete();
     test_red_black_tree_is_empty();
     test_red_black_tree_size();
@@ -235,12 +383,54 @@ void test_red_black_tree() {
     test_red_black_tree_contains();
     test_red_black_tree_foreach();
     test_red_black_tree_insert();
+    test_red_black_tree_put();
     test_red_black_tree_remove();
+    test_red_black_tree_find();
+    test_red_black_tree_floor();
+    test_red_black_tree_ceiling();
+    test_red_black_tree_lower();
+    test_red_black_tree_higher();
+    test_red_black_tree_min();
+    test_red_black_tree_max();
+    test_red_black_tree_select();
+    test_red_black_tree_rank();
+    test_red_black_tree_is_valid();
     test_red_black_tree_iterator();
+    test_red_black_tree_iterator_range();
+    test_red_black_tree_iterator_reverse();
 
     printf("[PASS] red_black_tree\n");
 }
 
+void test_btree() {
+    test_btree_new();
+    test_btree_new_with_key();
+    test_btree_new_from_sorted();
+    test_btree_delete();
+    test_btree_is_empty();
+    test_btree_size();
+    test_btree_clear();
+    test_btree_contains();
+    test_btree_foreach();
+    test_btree_insert();
+    test_btree_put();
+    test_btree_remove();
+    test_btree_find();
+    test_btree_floor();
+    test_btree_ceiling();
+    test_btree_lower();
+    test_btree_higher();
+    test_btree_min();
+    test_btree_max();
+    test_btree_select();
+    test_btree_rank();
+    test_btree_iterator();
+    test_btree_iterator_range();
+    test_btree_iterator_reverse();
+
+    printf("[PASS] btree\n");
+}
+
 void test_hash_table() {
     test_hash_table_new();
     test_hash_table_delete();
@@ -253,12 +443,16 @@ void test_hash_table() {
     test_hash_table_remove();
     test_hash_table_get();
     test_hash_table_iterator();
+    test_hash_table_reserve();
+    test_hash_table_iterator_remove();
 
     printf("[PASS] hash_table\n");
 }
 
 void test_tree_set() {
     test_tree_set_new();
+    test_tree_set_from_sorted();
+    test_tree_set_from_array();
     test_tree_set_delete();
     test_tree_set_is_empty();
     test_tree_set_size();
@@ -267,17 +461,47 @@ void test_tree_set() {
     test_tree_set_contains();
     test_tree_set_add();
     test_tree_set_remove();
+    test_tree_set_select();
+    test_tree_set_rank();
     test_tree_set_union();
     test_tree_set_intersection();
     test_tree_set_difference();
     test_tree_set_symmetric_difference();
     test_tree_set_is_disjoint();
     test_tree_set_is_subset();
+    test_tree_set_interleaved();
     test_tree_set_iterator();
+    test_tree_set_iterator_range();
+    test_tree_set_iterator_reverse();
 
     printf("[PASS] tree_set\n");
 }
 
+void test_btree_set() {
+    test_btree_set_new();
+    test_btree_set_delete();
+    test_btree_set_is_empty();
+    test_btree_set_size();
+    test_btree_set_foreach();
+    test_btree_set_clear();
+    test_btree_set_contains();
+    test_btree_set_add();
+    test_btree_set_remove();
+    test_btree_set_select();
+    test_btree_set_rank();
+    test_btree_set_union();
+    test_btree_set_intersection();
+    test_btree_set_difference();
+    test_btree_set_symmetric_difference();
+    test_btree_set_is_disjoint();
+    test_btree_set_is_subset();
+    test_btree_set_iterator();
+    test_btree_set_iterator_range();
+    test_btree_set_iterator_reverse();
+
+    printf("[PASS] btree_set\n");
+}
+
 void test_hash_set() {
     test_hash_set_new();
     test_hash_set_delete();
@@ -294,6 +518,9 @@ void test_hash_set() {
     test_hash_set_symmetric_difference();
     test_hash_set_is_disjoint();
     test_hash_set_is_subset();
+    test_hash_set_union_into();
+    test_hash_set_retain_all();
+    test_hash_set_remove_all();
     test_hash_set_iterator();
 
     printf("[PASS] hash_set\n");
@@ -301,6 +528,9 @@ void test_hash_set() {
 
 void test_tree_map() {
     test_tree_map_new();
+    test_tree_map_new_independent();
+    test_tree_map_from_sorted();
+    test_tree_map_from_array();
     test_tree_map_delete();
     test_tree_map_is_empty();
     test_tree_map_size();
@@ -310,11 +540,48 @@ void test_tree_map() {
     test_tree_map_put();
     test_tree_map_remove();
     test_tree_map_get();
+    test_tree_map_floor();
+    test_tree_map_ceiling();
+    test_tree_map_lower();
+    test_tree_map_higher();
+    test_tree_map_first();
+    test_tree_map_last();
+    test_tree_map_select();
+    test_tree_map_rank();
     test_tree_map_iterator();
+    test_tree_map_iterator_range();
+    test_tree_map_iterator_reverse();
 
     printf("[PASS] tree_map\n");
 }
 
+void test_btree_map() {
+    test_btree_map_new();
+    test_btree_map_new_independent();
+    test_btree_map_delete();
+    test_btree_map_is_empty();
+    test_btree_map_size();
+    test_btree_map_foreach();
+    test_btree_map_clear();
+    test_btree_map_contains();
+    test_btree_map_put();
+    test_btree_map_remove();
+    test_btree_map_get();
+    test_btree_map_floor();
+    test_btree_map_ceiling();
+    test_btree_map_lower();
+    test_btree_map_higher();
+    test_btree_map_first();
+    test_btree_map_last();
+    test_btree_map_select();
+    test_btree_map_rank();
+    test_btree_map_iterator();
+    test_btree_map_iterator_range();
+    test_btree_map_iterator_reverse();
+
+    printf("[PASS] btree_map\n");
+}
+
 void test_hash_map() {
     test_hash_map_new();
     test_hash_map_delete();
@@ -331,20 +598,46 @@ void test_hash_map() {
     printf("[PASS] hash_map\n");
 }
 
+void test_persistent_map() {
+    test_persistent_map_new();
+    test_persistent_map_delete();
+    test_persistent_map_is_empty();
+    test_persistent_map_size();
+    test_persistent_map_foreach();
+    test_persistent_map_contains();
+    test_persistent_map_put();
+    test_persistent_map_remove();
+    test_persistent_map_get();
+    test_persistent_map_snapshot();
+    test_persistent_map_iterator();
+
+    printf("[PASS] persistent_map\n");
+}
+
 void test_cstl() {
     test_str();
+    test_string_pool();
     test_array();
     test_list();
+    test_unrolled_list();
     test_stack();
     test_queue();
     test_deque();
     test_heap();
+    test_indexed_heap();
+    test_pairing_heap();
+    test_radix_heap();
+    test_timer_wheel();
     test_red_black_tree();
+    test_btree();
     test_hash_table();
     test_tree_set();
+    test_btree_set();
     test_hash_set();
     test_tree_map();
+    test_btree_map();
     test_hash_map();
+    test_persistent_map();
 }
 
 int main() {
@@ -338,6 +338,10 @@ void test_array_reverse() {
     array_delete(array);
 }
 
+static int Integer_compare_hundreds(const void *ptr1, const void *ptr2) {
+    return Integer_get((Integer *)ptr1) / 100 - Integer_get((Integer *)ptr2) / 100;
+}
+
 void test_array_sort() {
     int i = 0;
     array_t *array = NULL;
@@ -370,6 +374,22 @@ void test_array_sort() {
         assert(Double_get(double1) <= Double_get(double2));
     }
     array_delete(array);
+
+    /* Elements with equal keys keep their original order */
+    array = array_new(Integer_compare_hundreds, Integer_delete);
+    for (i = 0; i < N; i++) {
+        array_append(array, Integer_new((N - i - 1) % 10 * 100 + i / 10));
+    }
+    array_sort(array);
+    for (i = 0; i < N; i++) {
+        integer1 = (Integer *)array_get(array, i);
+        assert(Integer_get(integer1) / 100 == i / (N / 10));
+        if (i % (N / 10) != 0) {
+            integer2 = (Integer *)array_get(array, i - 1);
+            assert(Integer_get(integer1) > Integer_get(integer2));
+        }
+    }
+    array_delete(array);
 }
 
 void test_array_iterator() {
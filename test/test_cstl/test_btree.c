@@ -0,0 +1,693 @@
+#include "test_btree.h"
+#include "cstl.h"
+#include <assert.h>
+
+#define N 1000
+
+void test_btree_new() {
+    btree_t *tree = btree_new(UnsignedCharacter_compare, UnsignedCharacter_delete);
+    assert(tree != NULL);
+    assert(btree_is_empty(tree) == true);
+    assert(btree_size(tree) == 0);
+    btree_delete(tree);
+}
+
+static T pair_key(const T data) {
+    return pair_get_key((pair_t *)data);
+}
+
+void test_btree_new_with_key() {
+    int i = 0;
+    pair_t *pair = NULL;
+    Integer *key = NULL;
+    btree_t *tree = btree_new_with_key(Integer_compare, pair_key, (destroy_t)pair_delete);
+    assert(tree != NULL);
+
+    /* Pairs are ordered by their keys only */
+    for (i = 0; i < N; i++) {
+        btree_insert(tree, pair_new(Integer_new(N - i - 1), Integer_new(i), Integer_delete, Integer_delete));
+    }
+    assert(btree_size(tree) == N);
+
+    /* Lookups take the raw key */
+    key = Integer_new(N / 2);
+    assert(btree_contains(tree, key) == true);
+    assert(Integer_get(pair_get_value(btree_find(tree, key))) == N - N / 2 - 1);
+    btree_remove(tree, key);
+    assert(btree_contains(tree, key) == false);
+    Integer_delete(key);
+
+    /* Putting an equal key replaces the data item in place */
+    btree_put(tree, pair_new(Integer_new(0), Integer_new(-1), Integer_delete, Integer_delete));
+    assert(btree_size(tree) == N - 1);
+    pair = (pair_t *)btree_min(tree);
+    assert(Integer_get(pair_get_value(pair)) == -1);
+
+    assert(Integer_get(pair_get_key(btree_min(tree))) == 0);
+    assert(Integer_get(pair_get_key(btree_max(tree))) == N - 1);
+
+    btree_delete(tree);
+}
+
+void test_btree_new_from_sorted() {
+    size_t sizes[] = {0, 1, 31, 32, 33, 1023, 1024, 20 * N};
+    array_t *array = NULL;
+    btree_t *tree = NULL;
+    Integer *integer = NULL;
+    int n = 0;
+    int i = 0;
+    int k = 0;
+
+    for (k = 0; k < (int)(sizeof(sizes) / sizeof(sizes[0])); k++) {
+        n = (int)sizes[k];
+        array = array_new(Integer_compare, NULL);
+        for (i = 0; i < n; i++) {
+            array_append(array, Integer_new(i));
+        }
+
+        tree = btree_new_from_sorted(Integer_compare, NULL, Integer_delete, array);
+        assert(tree != NULL);
+        assert(btree_size(tree) == (size_t)n);
+        for (i = 0; i < n; i++) {
+            assert(Integer_get(btree_select(tree, i)) == i);
+        }
+
+        /* Every node is within the key bounds, so removals keep working down to an empty tree */
+        integer = Integer_new(0);
+        for (i = 0; i < n; i += 2) {
+            Integer_set(integer, i);
+            btree_remove(tree, integer);
+        }
+        assert(btree_size(tree) == (size_t)(n / 2));
+        for (i = 0; i < n; i++) {
+            Integer_set(integer, i);
+            assert(btree_contains(tree, integer) == (i % 2 == 1));
+        }
+        for (i = 1; i < n; i += 2) {
+            Integer_set(integer, i);
+            btree_remove(tree, integer);
+        }
+        Integer_delete(integer);
+        assert(btree_is_empty(tree));
+        btree_delete(tree);
+        array_delete(array);
+    }
+
+    /* Unsorted input is rejected and left to the caller */
+    array = array_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        array_append(array, Integer_new(i % 10));
+    }
+    assert(btree_new_from_sorted(Integer_compare, NULL, Integer_delete, array) == NULL);
+    array_delete(array);
+}
+
+void test_btree_delete() {
+    btree_t *tree = btree_new(UnsignedShort_compare, UnsignedShort_delete);
+    assert(tree != NULL);
+    btree_delete(tree);
+}
+
+void test_btree_is_empty() {
+    btree_t *tree = btree_new(UnsignedInteger_compare, UnsignedInteger_delete);
+    assert(btree_is_empty(tree) == true);
+    btree_insert(tree, UnsignedInteger_new(0));
+    assert(btree_is_empty(tree) == false);
+    btree_delete(tree);
+}
+
+void test_btree_size() {
+    int i = 0;
+    btree_t *tree = NULL;
+
+    tree = btree_new(UnsignedLong_compare, UnsignedLong_delete);
+    assert(btree_size(tree) == 0);
+    for (i = 0; i < N; i++) {
+        btree_insert(tree, UnsignedLong_new(i));
+    }
+    assert(btree_size(tree) == N);
+    btree_delete(tree);
+
+    tree = btree_new(Short_compare, Short_delete);
+    assert(btree_size(tree) == 0);
+    for (i = 0; i < N; i++) {
+        btree_insert(tree, Short_new(N - i - 1));
+    }
+    assert(btree_size(tree) == N);
+    btree_delete(tree);
+
+    tree = btree_new(Integer_compare, Integer_delete);
+    assert(btree_size(tree) == 0);
+    for (i = 0; i < N; i++) {
+        btree_insert(tree, Integer_new(i));
+        btree_insert(tree, Integer_new(N - i - 1));
+    }
+    assert(btree_size(tree) == N);
+    btree_delete(tree);
+}
+
+void test_btree_clear() {
+    int i = 0;
+    Integer *integer = NULL;
+    btree_t *tree = btree_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_insert(tree, Integer_new(i));
+    }
+    assert(btree_size(tree) == N);
+    btree_clear(tree);
+    assert(btree_is_empty(tree) == true);
+
+    /* The tree stays usable after its nodes are released */
+    for (i = 0; i < N; i++) {
+        btree_insert(tree, Integer_new(N - i));
+    }
+    assert(btree_size(tree) == N);
+    for (i = 1; i <= N; i++) {
+        integer = Integer_new(i);
+        assert(btree_contains(tree, integer) == true);
+        Integer_delete(integer);
+    }
+    btree_delete(tree);
+}
+
+void test_btree_contains() {
+    int i = 0;
+    btree_t *tree = NULL;
+    Integer *integer;
+
+    tree = btree_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_insert(tree, Integer_new(i));
+    }
+
+    for (i = 0; i < N; i++) {
+        integer = Integer_new(randint(0, 3 * N));
+        if (Integer_get(integer) < N) {
+            assert(btree_contains(tree, integer) == true);
+        } else {
+            assert(btree_contains(tree, integer) == false);
+        }
+        Integer_delete(integer);
+    }
+
+    btree_delete(tree);
+}
+
+static int buffer[N] = {0};
+static int n = 0;
+
+static void Integer_store(T elem) {
+    Integer *integer = (Integer *)elem;
+    buffer[n] = Integer_get(integer);
+    n++;
+}
+
+static void Integer_triple(T elem) {
+    Integer *integer = (Integer *)elem;
+    Integer_set(integer, Integer_get(integer) * 3);
+}
+
+void test_btree_foreach() {
+    int i = 0;
+    btree_t *tree = NULL;
+
+    tree = btree_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_insert(tree, Integer_new(i));
+    }
+
+    n = 0;
+    btree_foreach(tree, Integer_store);
+
+    assert(n == N);
+    for (i = 0; i < N; i++) {
+        assert(buffer[i] == i);
+    }
+
+    n = 0;
+    btree_foreach(tree, Integer_triple);
+    btree_foreach(tree, Integer_store);
+
+    assert(n == N);
+    for (i = 0; i < N; i++) {
+        assert(buffer[i] == 3 * i);
+    }
+
+    btree_delete(tree);
+}
+
+void test_btree_insert() {
+    int i = 0;
+    btree_t *tree = NULL;
+
+    tree = btree_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_insert(tree, Integer_new(i));
+    }
+    assert(btree_size(tree) == N);
+    btree_delete(tree);
+
+    tree = btree_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_insert(tree, Integer_new(i));
+        btree_insert(tree, Integer_new(i));
+    }
+    assert(btree_size(tree) == N);
+    btree_delete(tree);
+
+    tree = btree_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i += 2) {
+        btree_insert(tree, Integer_new(i));
+    }
+    for (i = 1; i < N; i += 2) {
+        btree_insert(tree, Integer_new(i));
+    }
+    assert(btree_size(tree) == N);
+    btree_delete(tree);
+}
+
+void test_btree_put() {
+    int i = 0;
+    btree_t *tree = NULL;
+    pair_t *pair = NULL;
+    Integer *key = NULL;
+
+    tree = btree_new_with_key(Integer_compare, pair_key, (destroy_t)pair_delete);
+    for (i = 0; i < N; i++) {
+        btree_put(tree, pair_new(Integer_new(i), Integer_new(i), Integer_delete, Integer_delete));
+    }
+    for (i = 0; i < N; i++) {
+        btree_put(tree, pair_new(Integer_new(i), Integer_new(i * 2), Integer_delete, Integer_delete));
+    }
+    assert(btree_size(tree) == N);
+
+    for (i = 0; i < N; i++) {
+        key = Integer_new(i);
+        pair = (pair_t *)btree_find(tree, key);
+        assert(Integer_get(pair_get_value(pair)) == i * 2);
+        Integer_delete(key);
+    }
+    btree_delete(tree);
+}
+
+void test_btree_remove() {
+    int i = 0;
+    btree_t *tree = NULL;
+    Integer *integer;
+
+    tree = btree_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_insert(tree, Integer_new(i));
+    }
+    for (i = 0; i < N; i++) {
+        integer = Integer_new(i);
+        btree_remove(tree, integer);
+        Integer_delete(integer);
+    }
+    assert(btree_is_empty(tree) == true);
+    btree_delete(tree);
+
+    tree = btree_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_insert(tree, Integer_new(i));
+    }
+    for (i = 0; i < N; i++) {
+        integer = Integer_new(i);
+        btree_remove(tree, integer);
+        btree_remove(tree, integer);
+        Integer_delete(integer);
+    }
+    assert(btree_is_empty(tree) == true);
+    btree_delete(tree);
+
+    tree = btree_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_insert(tree, Integer_new(i));
+    }
+    for (i = 0; i < N / 2; i++) {
+        integer = Integer_new(N - 1 - i);
+        btree_remove(tree, integer);
+        Integer_delete(integer);
+    }
+    assert(btree_size(tree) == N / 2);
+    btree_delete(tree);
+
+    tree = btree_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_insert(tree, Integer_new(i));
+    }
+    for (i = 0; i < N; i++) {
+        integer = Integer_new(-1 * i);
+        btree_remove(tree, integer);
+        Integer_delete(integer);
+    }
+    assert(btree_size(tree) == N - 1);
+    btree_delete(tree);
+
+    /* Remove in shuffled order, the tree must stay ordered and searchable */
+    tree = btree_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        buffer[i] = i;
+        btree_insert(tree, Integer_new((i * 7) % N));
+    }
+    shuffle(buffer, N, int);
+    for (i = 0; i < N / 2; i++) {
+        integer = Integer_new(buffer[i]);
+        btree_remove(tree, integer);
+        assert(btree_contains(tree, integer) == false);
+        Integer_delete(integer);
+    }
+    assert(btree_size(tree) == N - N / 2);
+    for (i = N / 2; i < N; i++) {
+        integer = Integer_new(buffer[i]);
+        assert(btree_contains(tree, integer) == true);
+        Integer_delete(integer);
+    }
+    btree_delete(tree);
+}
+
+void test_btree_find() {
+    int i = 0;
+    Integer *key = NULL;
+    Integer *found = NULL;
+    btree_t *tree = btree_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_insert(tree, Integer_new(i * 2));
+    }
+
+    for (i = 0; i < N; i++) {
+        key = Integer_new(i * 2);
+        found = (Integer *)btree_find(tree, key);
+        assert(found != NULL && found != key);
+        assert(Integer_get(found) == i * 2);
+        Integer_delete(key);
+    }
+
+    key = Integer_new(1);
+    assert(btree_find(tree, key) == NULL);
+    Integer_delete(key);
+
+    key = Integer_new(-1);
+    assert(btree_find(tree, key) == NULL);
+    Integer_delete(key);
+
+    key = Integer_new(N * 2);
+    assert(btree_find(tree, key) == NULL);
+    Integer_delete(key);
+
+    btree_delete(tree);
+}
+
+void test_btree_floor() {
+    int i = 0;
+    Integer *key = NULL;
+    Integer *found = NULL;
+    btree_t *tree = btree_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_insert(tree, Integer_new(i * 2));
+    }
+
+    for (i = 0; i < N; i++) {
+        key = Integer_new(i * 2 + 1);
+        found = (Integer *)btree_floor(tree, key);
+        assert(found != NULL && found != key);
+        assert(Integer_get(found) == i * 2);
+        Integer_delete(key);
+    }
+
+    key = Integer_new(0);
+    assert(Integer_get(btree_floor(tree, key)) == 0);
+    Integer_delete(key);
+
+    key = Integer_new(-1);
+    assert(btree_floor(tree, key) == NULL);
+    Integer_delete(key);
+
+    btree_delete(tree);
+}
+
+void test_btree_ceiling() {
+    int i = 0;
+    Integer *key = NULL;
+    Integer *found = NULL;
+    btree_t *tree = btree_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_insert(tree, Integer_new(i * 2));
+    }
+
+    for (i = 0; i < N; i++) {
+        key = Integer_new(i * 2 - 1);
+        found = (Integer *)btree_ceiling(tree, key);
+        assert(found != NULL && found != key);
+        assert(Integer_get(found) == i * 2);
+        Integer_delete(key);
+    }
+
+    key = Integer_new(N * 2 - 2);
+    assert(Integer_get(btree_ceiling(tree, key)) == N * 2 - 2);
+    Integer_delete(key);
+
+    key = Integer_new(N * 2 - 1);
+    assert(btree_ceiling(tree, key) == NULL);
+    Integer_delete(key);
+
+    btree_delete(tree);
+}
+
+void test_btree_lower() {
+    int i = 0;
+    Integer *key = NULL;
+    Integer *found = NULL;
+    btree_t *tree = btree_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_insert(tree, Integer_new(i * 2));
+    }
+
+    for (i = 0; i < N; i++) {
+        key = Integer_new(i * 2 + 2);
+        found = (Integer *)btree_lower(tree, key);
+        assert(found != NULL && found != key);
+        assert(Integer_get(found) == i * 2);
+        Integer_delete(key);
+    }
+
+    key = Integer_new(1);
+    assert(Integer_get(btree_lower(tree, key)) == 0);
+    Integer_delete(key);
+
+    key = Integer_new(0);
+    assert(btree_lower(tree, key) == NULL);
+    Integer_delete(key);
+
+    btree_delete(tree);
+}
+
+void test_btree_higher() {
+    int i = 0;
+    Integer *key = NULL;
+    Integer *found = NULL;
+    btree_t *tree = btree_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_insert(tree, Integer_new(i * 2));
+    }
+
+    for (i = 0; i < N; i++) {
+        key = Integer_new(i * 2 - 2);
+        found = (Integer *)btree_higher(tree, key);
+        assert(found != NULL && found != key);
+        assert(Integer_get(found) == i * 2);
+        Integer_delete(key);
+    }
+
+    key = Integer_new(N * 2 - 3);
+    assert(Integer_get(btree_higher(tree, key)) == N * 2 - 2);
+    Integer_delete(key);
+
+    key = Integer_new(N * 2 - 2);
+    assert(btree_higher(tree, key) == NULL);
+    Integer_delete(key);
+
+    btree_delete(tree);
+}
+
+void test_btree_min() {
+    int i = 0;
+    btree_t *tree = btree_new(Integer_compare, Integer_delete);
+    assert(btree_min(tree) == NULL);
+    for (i = 0; i < N; i++) {
+        btree_insert(tree, Integer_new((i * 7) % N));
+        assert(Integer_get(btree_min(tree)) == 0);
+    }
+    btree_delete(tree);
+}
+
+void test_btree_max() {
+    int i = 0;
+    int maximum = 0;
+    btree_t *tree = btree_new(Integer_compare, Integer_delete);
+    assert(btree_max(tree) == NULL);
+    for (i = 0; i < N; i++) {
+        btree_insert(tree, Integer_new((i * 7) % N));
+        maximum = max(maximum, (i * 7) % N);
+        assert(Integer_get(btree_max(tree)) == maximum);
+    }
+    btree_delete(tree);
+}
+
+void test_btree_select() {
+    int i = 0;
+    Integer *key = NULL;
+    btree_t *tree = btree_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_insert(tree, Integer_new((i * 7) % N * 2));
+    }
+
+    for (i = 0; i < N; i++) {
+        assert(Integer_get(btree_select(tree, i)) == i * 2);
+    }
+    assert(btree_select(tree, N) == NULL);
+
+    /* Ranks shift after removing the smaller half */
+    for (i = 0; i < N / 2; i++) {
+        key = Integer_new(i * 2);
+        btree_remove(tree, key);
+        Integer_delete(key);
+    }
+    for (i = 0; i < N - N / 2; i++) {
+        assert(Integer_get(btree_select(tree, i)) == (N / 2 + i) * 2);
+    }
+
+    btree_delete(tree);
+}
+
+void test_btree_rank() {
+    int i = 0;
+    Integer *key = NULL;
+    btree_t *tree = btree_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_insert(tree, Integer_new((i * 7) % N * 2));
+    }
+
+    for (i = 0; i < N; i++) {
+        key = Integer_new(i * 2);
+        assert(btree_rank(tree, key) == (size_t)i);
+        Integer_set(key, i * 2 + 1);
+        assert(btree_rank(tree, key) == (size_t)i + 1);
+        Integer_delete(key);
+    }
+
+    key = Integer_new(-1);
+    assert(btree_rank(tree, key) == 0);
+    Integer_delete(key);
+
+    btree_delete(tree);
+}
+
+void test_btree_iterator() {
+    int i = 0;
+    btree_t *tree = NULL;
+    iterator_t *iterator = NULL;
+    Integer *integer;
+
+    tree = btree_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_insert(tree, Integer_new(i));
+    }
+
+    iterator = btree_iterator_new(tree);
+
+    i = 0;
+    while (btree_iterator_has_next(iterator)) {
+        integer = (Integer *)btree_iterator_next(iterator);
+        assert(Integer_get(integer) == i);
+        i++;
+    }
+
+    btree_iterator_delete(iterator);
+    btree_delete(tree);
+}
+
+void test_btree_iterator_range() {
+    int i = 0;
+    btree_t *tree = NULL;
+    iterator_t *iterator = NULL;
+    Integer *lo = NULL;
+    Integer *hi = NULL;
+    Integer *integer;
+
+    tree = btree_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_insert(tree, Integer_new(i * 2));
+    }
+
+    lo = Integer_new(N / 2 - 1);
+    hi = Integer_new(N);
+    iterator = btree_iterator_range(tree, lo, hi);
+    i = N / 2;
+    while (btree_iterator_has_next(iterator)) {
+        integer = (Integer *)btree_iterator_next(iterator);
+        assert(Integer_get(integer) == i);
+        i += 2;
+    }
+    assert(i == N);
+    btree_iterator_delete(iterator);
+
+    iterator = btree_iterator_range(tree, NULL, hi);
+    i = 0;
+    while (btree_iterator_has_next(iterator)) {
+        integer = (Integer *)btree_iterator_next(iterator);
+        assert(Integer_get(integer) == i);
+        i += 2;
+    }
+    assert(i == N);
+    btree_iterator_delete(iterator);
+
+    iterator = btree_iterator_range(tree, lo, NULL);
+    i = N / 2;
+    while (btree_iterator_has_next(iterator)) {
+        integer = (Integer *)btree_iterator_next(iterator);
+        assert(Integer_get(integer) == i);
+        i += 2;
+    }
+    assert(i == N * 2);
+    btree_iterator_delete(iterator);
+
+    iterator = btree_iterator_range(tree, hi, lo);
+    assert(!btree_iterator_has_next(iterator));
+    btree_iterator_delete(iterator);
+
+    Integer_set(lo, 1);
+    Integer_set(hi, 2);
+    iterator = btree_iterator_range(tree, lo, hi);
+    assert(!btree_iterator_has_next(iterator));
+    btree_iterator_delete(iterator);
+
+    Integer_delete(lo);
+    Integer_delete(hi);
+    btree_delete(tree);
+}
+
+void test_btree_iterator_reverse() {
+    int i = 0;
+    btree_t *tree = NULL;
+    iterator_t *iterator = NULL;
+    Integer *integer;
+
+    tree = btree_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_insert(tree, Integer_new(i));
+    }
+
+    iterator = btree_iterator_reverse(tree);
+
+    i = N - 1;
+    while (btree_iterator_has_next(iterator)) {
+        integer = (Integer *)btree_iterator_next(iterator);
+        assert(Integer_get(integer) == i);
+        i--;
+    }
+    assert(i == -1);
+
+    btree_iterator_delete(iterator);
+    btree_delete(tree);
+}
@@ -0,0 +1,29 @@
+#ifndef _TEST_BTREE_H_
+#define _TEST_BTREE_H_
+
+void test_btree_new();
+void test_btree_new_with_key();
+void test_btree_new_from_sorted();
+void test_btree_delete();
+void test_btree_is_empty();
+void test_btree_size();
+void test_btree_clear();
+void test_btree_contains();
+void test_btree_foreach();
+void test_btree_insert();
+void test_btree_put();
+void test_btree_remove();
+void test_btree_find();
+void test_btree_floor();
+void test_btree_ceiling();
+void test_btree_lower();
+void test_btree_higher();
+void test_btree_min();
+void test_btree_max();
+void test_btree_select();
+void test_btree_rank();
+void test_btree_iterator();
+void test_btree_iterator_range();
+void test_btree_iterator_reverse();
+
+#endif
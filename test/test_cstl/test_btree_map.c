@@ -0,0 +1,861 @@
+#include "test_btree_map.h"
+#include "cstl.h"
+#include <assert.h>
+
+#define N 1000
+
+void test_btree_map_new() {
+    btree_map_t *map = btree_map_new(UnsignedLong_compare);
+    assert(map != NULL);
+    assert(btree_map_is_empty(map) == true);
+    assert(btree_map_size(map) == 0);
+    btree_map_delete(map);
+}
+
+static int Integer_compare_reverse(const void *ptr1, const void *ptr2) {
+    return Integer_compare(ptr2, ptr1);
+}
+
+void test_btree_map_new_independent() {
+    int i = 0;
+    btree_map_t *ascending = btree_map_new(Integer_compare);
+    btree_map_t *descending = btree_map_new(Integer_compare_reverse);
+    btree_map_t *more = NULL;
+    pair_t *pair;
+
+    /* Each map keeps its own comparator, no matter how many maps are created */
+    for (i = 0; i < N; i++) {
+        btree_map_put(ascending, pair_new(Integer_new(i), Integer_new(i), Integer_delete, Integer_delete));
+        more = btree_map_new(Integer_compare);
+        btree_map_put(descending, pair_new(Integer_new(i), Integer_new(i), Integer_delete, Integer_delete));
+        btree_map_delete(more);
+    }
+
+    assert(btree_map_size(ascending) == N);
+    assert(btree_map_size(descending) == N);
+    assert(Integer_get(pair_get_key(btree_map_first(ascending))) == 0);
+    assert(Integer_get(pair_get_key(btree_map_first(descending))) == N - 1);
+
+    pair = btree_map_first(descending);
+    for (i = N - 1; i >= 0; i--) {
+        assert(Integer_get(pair_get_key(pair)) == i);
+        pair = btree_map_higher(descending, pair_get_key(pair));
+    }
+    assert(pair == NULL);
+
+    btree_map_delete(ascending);
+    btree_map_delete(descending);
+}
+
+void test_btree_map_delete() {
+    btree_map_t *map = btree_map_new(UnsignedShort_compare);
+    assert(map != NULL);
+    btree_map_delete(map);
+}
+
+void test_btree_map_is_empty() {
+    btree_map_t *map = NULL;
+    pair_t *pair;
+
+    map = btree_map_new(UnsignedInteger_compare);
+    assert(btree_map_is_empty(map) == true);
+    pair = pair_new(UnsignedInteger_new(0), UnsignedInteger_new(0), UnsignedInteger_delete, UnsignedInteger_delete);
+    btree_map_put(map, pair);
+    assert(btree_map_is_empty(map) == false);
+    btree_map_delete(map);
+}
+
+void test_btree_map_size() {
+    int i = 0;
+    btree_map_t *map = NULL;
+    pair_t *pair;
+
+    map = btree_map_new(UnsignedInteger_compare);
+    assert(btree_map_size(map) == 0);
+    for (i = 0; i < N; i++) {
+        pair = pair_new(UnsignedInteger_new(i), UnsignedInteger_new(i), UnsignedInteger_delete, UnsignedInteger_delete);
+        btree_map_put(map, pair);
+    }
+    assert(btree_map_size(map) == N);
+    btree_map_delete(map);
+
+    map = btree_map_new(Integer_compare);
+    assert(btree_map_size(map) == 0);
+    for (i = 0; i < N; i++) {
+        pair = pair_new(Integer_new(i), Integer_new(i), Integer_delete, Integer_delete);
+        btree_map_put(map, pair);
+        pair = pair_new(Integer_new(i), Integer_new(i), Integer_delete, Integer_delete);
+        btree_map_put(map, pair);
+    }
+    assert(btree_map_size(map) == N);
+    btree_map_delete(map);
+}
+
+static int keys[N] = {0};
+static int values[N] = {0};
+static int n = 0;
+
+static void key_value_store(T pair) {
+    Integer *key;
+    Integer *value;
+
+    pair = (pair_t *)pair;
+    key = pair_get_key(pair);
+    value = pair_get_value(pair);
+    keys[n] = Integer_get(key);
+    values[n] = Integer_get(value);
+    n++;
+}
+
+void test_btree_map_foreach() {
+    int i = 0;
+    btree_map_t *map = NULL;
+    pair_t *pair;
+
+    map = btree_map_new(Integer_compare);
+
+    for (i = 0; i < N; i++) {
+        pair = pair_new(Integer_new(i), Integer_new(i * i), Integer_delete, Integer_delete);
+        btree_map_put(map, pair);
+    }
+
+    n = 0;
+    btree_map_foreach(map, key_value_store);
+
+    assert(n == N);
+    for (i = 0; i < N; i++) {
+        assert(keys[i] == i);
+        assert(values[i] == i * i);
+    }
+
+    btree_map_delete(map);
+}
+
+void test_btree_map_clear() {
+    int i = 0;
+    btree_map_t *map = NULL;
+    pair_t *pair;
+
+    map = btree_map_new(Integer_compare);
+    assert(btree_map_is_empty(map) == true);
+    for (i = 0; i < N; i++) {
+        pair = pair_new(Integer_new(i), Integer_new(i), Integer_delete, Integer_delete);
+        btree_map_put(map, pair);
+    }
+    assert(btree_map_size(map) == N);
+    btree_map_clear(map);
+    assert(btree_map_is_empty(map) == true);
+    btree_map_delete(map);
+}
+
+void test_btree_map_contains() {
+    int i = 0;
+    btree_map_t *map = NULL;
+    pair_t *pair;
+    Integer *key;
+
+    map = btree_map_new(Integer_compare);
+    
+    for (i = 0; i < N; i++) {
+        pair = pair_new(Integer_new(i), Integer_new(i), Integer_delete, Integer_delete);
+        btree_map_put(map, pair);
+    }
+
+    for (i = 0; i < N; i++) {
+        key = Integer_new(randint(0, 3 * N));
+        if (Integer_get(key) < N) {
+            assert(btree_map_contains(map, key) == true);
+        } else {
+            assert(btree_map_contains(map, key) == false);
+        }
+        Integer_delete(key);
+    }
+
+    btree_map_delete(map);
+}
+
+typedef struct Point {
+    int x;
+    int y;
+} Point;
+
+static Point *Point_new(int x, int y) {
+    Point *point = (Point *)malloc(sizeof(Point));
+    point->x = x;
+    point->y = y;
+    return point;
+}
+
+static void Point_delete(void *ptr) {
+    Point *point = ptr;
+    free(point);
+}
+
+static int Point_compare(const void *ptr1, const void *ptr2) {
+    const Point *point1 = ptr1;
+    const Point *point2 = ptr2;
+    if (point1->x < point2->x) {
+        return -1;
+    } else if (point1->x > point2->x) {
+        return 1;
+    } else {
+        if (point1->y < point2->y) {
+            return -1;
+        } else if (point1->y > point2->y) {
+            return 1;
+        } else {
+            return 0;
+        }
+    }
+}
+
+void test_btree_map_put() {
+    int i = 0;
+    btree_map_t *map = NULL;
+    pair_t *pair;
+    Integer *key;
+    Integer *integer;
+    char *string;
+    Character *character;
+    Point *point;
+
+    map = btree_map_new(Integer_compare);
+    for (i = 0; i < N; i++) {
+        pair = pair_new(Integer_new(i), Integer_new(i), Integer_delete, Integer_delete);
+        btree_map_put(map, pair);
+    }
+    assert(btree_map_size(map) == N);
+
+    for (i = 0; i < N; i++) {
+        key = Integer_new(i);
+        integer = (Integer *)btree_map_get(map, key);
+        assert(integer != NULL);
+        assert(Integer_get(integer) == i);
+        Integer_delete(key);
+    }
+    btree_map_delete(map);
+
+    map = btree_map_new(Integer_compare);
+
+    pair = pair_new(Integer_new(0), "hello", Integer_delete, NULL);
+    btree_map_put(map, pair);
+    pair = pair_new(Integer_new(1), "world", Integer_delete, NULL);
+    btree_map_put(map, pair);
+    pair = pair_new(Integer_new(2), "test", Integer_delete, NULL);
+    btree_map_put(map, pair);
+
+    assert(btree_map_size(map) == 3);
+
+    key = Integer_new(0);
+    string = (char *)btree_map_get(map, key);
+    assert(string != NULL);
+    assert(strcmp(string, "hello") == 0);
+    Integer_delete(key);
+
+    key = Integer_new(1);
+    string = (char *)btree_map_get(map, key);
+    assert(string != NULL);
+    assert(strcmp(string, "world") == 0);
+    Integer_delete(key);
+
+    key = Integer_new(2);
+    string = (char *)btree_map_get(map, key);
+    assert(string != NULL);
+    assert(strcmp(string, "test") == 0);
+    Integer_delete(key);
+
+    pair = pair_new(Integer_new(0), "HELLO", Integer_delete, NULL);
+    btree_map_put(map, pair);
+    pair = pair_new(Integer_new(1), "WORLD", Integer_delete, NULL);
+    btree_map_put(map, pair);
+
+    assert(btree_map_size(map) == 3);
+
+    key = Integer_new(0);
+    string = (char *)btree_map_get(map, key);
+    assert(string != NULL);
+    assert(strcmp(string, "HELLO") == 0);
+    Integer_delete(key);
+
+    key = Integer_new(1);
+    string = (char *)btree_map_get(map, key);
+    assert(string != NULL);
+    assert(strcmp(string, "WORLD") == 0);
+    Integer_delete(key);
+
+    key = Integer_new(2);
+    string = (char *)btree_map_get(map, key);
+    assert(string != NULL);
+    assert(strcmp(string, "test") == 0);
+    Integer_delete(key);
+
+    btree_map_delete(map);
+
+    map = btree_map_new(Point_compare);
+    pair = pair_new(Point_new(1, 1), Character_new('A'), Point_delete, Character_delete);
+    btree_map_put(map, pair);
+    pair = pair_new(Point_new(1, 2), Character_new('B'), Point_delete, Character_delete);
+    btree_map_put(map, pair);
+    pair = pair_new(Point_new(2, 1), Character_new('C'), Point_delete, Character_delete);
+    btree_map_put(map, pair);
+    pair = pair_new(Point_new(2, 2), Character_new('D'), Point_delete, Character_delete);
+    btree_map_put(map, pair);
+    assert(btree_map_size(map) == 4);
+
+    point = Point_new(1, 1);
+    character = (Character *)btree_map_get(map, point);
+    assert(character != NULL);
+    assert(Character_get(character) == 'A');
+    Point_delete(point);
+
+    point = Point_new(1, 2);
+    character = (Character *)btree_map_get(map, point);
+    assert(character != NULL);
+    assert(Character_get(character) == 'B');
+    Point_delete(point);
+
+    point = Point_new(2, 1);
+    character = (Character *)btree_map_get(map, point);
+    assert(character != NULL);
+    assert(Character_get(character) == 'C');
+    Point_delete(point);
+
+    point = Point_new(2, 2);
+    character = (Character *)btree_map_get(map, point);
+    assert(character != NULL);
+    assert(Character_get(character) == 'D');
+    Point_delete(point);
+
+    pair = pair_new(Point_new(1, 1), Character_new('a'), Point_delete, Character_delete);
+    btree_map_put(map, pair);
+    pair = pair_new(Point_new(2, 1), Character_new('c'), Point_delete, Character_delete);
+    btree_map_put(map, pair);
+    pair = pair_new(Point_new(3, 3), Character_new('E'), Point_delete, Character_delete);
+    btree_map_put(map, pair);
+
+    assert(btree_map_size(map) == 5);
+
+    point = Point_new(1, 1);
+    character = (Character *)btree_map_get(map, point);
+    assert(character != NULL);
+    assert(Character_get(character) == 'a');
+    Point_delete(point);
+
+    point = Point_new(1, 2);
+    character = (Character *)btree_map_get(map, point);
+    assert(character != NULL);
+    assert(Character_get(character) == 'B');
+    Point_delete(point);
+
+    point = Point_new(2, 1);
+    character = (Character *)btree_map_get(map, point);
+    assert(character != NULL);
+    assert(Character_get(character) == 'c');
+    Point_delete(point);
+
+    point = Point_new(2, 2);
+    character = (Character *)btree_map_get(map, point);
+    assert(character != NULL);
+    assert(Character_get(character) == 'D');
+    Point_delete(point);
+
+    point = Point_new(3, 3);
+    character = (Character *)btree_map_get(map, point);
+    assert(character != NULL);
+    assert(Character_get(character) == 'E');
+    Point_delete(point);
+
+    btree_map_delete(map);
+}
+
+void test_btree_map_remove() {
+    int i = 0;
+    btree_map_t *map = NULL;
+    pair_t *pair;
+    Integer *key;
+    char *string;
+    Character *character;
+    Point *point;
+
+    map = btree_map_new(Integer_compare);
+    for (i = 0; i < N; i++) {
+        pair = pair_new(Integer_new(i), Integer_new(i), Integer_delete, Integer_delete);
+        btree_map_put(map, pair);
+    }
+    for (i = 0; i < N; i++) {
+        key = Integer_new(i);
+        btree_map_remove(map, key);
+        Integer_delete(key);
+    }
+    assert(btree_map_is_empty(map) == true);
+    btree_map_delete(map);
+
+    map = btree_map_new(Integer_compare);
+    pair = pair_new(Integer_new(0), "hello", Integer_delete, NULL);
+    btree_map_put(map, pair);
+    pair = pair_new(Integer_new(1), "world", Integer_delete, NULL);
+    btree_map_put(map, pair);
+    pair = pair_new(Integer_new(2), "test", Integer_delete, NULL);
+    btree_map_put(map, pair);
+
+    key = Integer_new(0);
+    btree_map_remove(map, key);
+    Integer_delete(key);
+
+    key = Integer_new(1);
+    btree_map_remove(map, key);
+    Integer_delete(key);
+
+    key = Integer_new(0);
+    btree_map_remove(map, key);
+    Integer_delete(key);
+
+    key = Integer_new(3);
+    btree_map_remove(map, key);
+    Integer_delete(key);
+
+    assert(btree_map_size(map) == 1);
+
+    key = Integer_new(2);
+    string = (char *)btree_map_get(map, key);
+    assert(string != NULL);
+    assert(strcmp(string, "test") == 0);
+    Integer_delete(key);
+
+    btree_map_delete(map);
+
+    map = btree_map_new(Point_compare);
+    pair = pair_new(Point_new(1, 1), Character_new('A'), Point_delete, Character_delete);
+    btree_map_put(map, pair);
+    pair = pair_new(Point_new(1, 2), Character_new('B'), Point_delete, Character_delete);
+    btree_map_put(map, pair);
+    pair = pair_new(Point_new(2, 1), Character_new('C'), Point_delete, Character_delete);
+    btree_map_put(map, pair);
+    pair = pair_new(Point_new(2, 2), Character_new('D'), Point_delete, Character_delete);
+    btree_map_put(map, pair);
+
+    point = Point_new(1, 1);
+    btree_map_remove(map, point);
+    Point_delete(point);
+
+    point = Point_new(1, 2);
+    btree_map_remove(map, point);
+    Point_delete(point);
+
+    point = Point_new(3, 1);
+    btree_map_remove(map, point);
+    Point_delete(point);
+
+    point = Point_new(3, 2);
+    btree_map_remove(map, point);
+    Point_delete(point);
+
+    assert(btree_map_size(map) == 2);
+
+    point = Point_new(2, 1);
+    character = (Character *)btree_map_get(map, point);
+    assert(character != NULL);
+    assert(Character_get(character) == 'C');
+    Point_delete(point);
+
+    point = Point_new(2, 2);
+    character = (Character *)btree_map_get(map, point);
+    assert(character != NULL);
+    assert(Character_get(character) == 'D');
+    Point_delete(point);
+
+    btree_map_delete(map);
+}
+
+void test_btree_map_get() {
+    int i = 0;
+    btree_map_t *map = NULL;
+    pair_t *pair;
+    Integer *key;
+    Integer *integer;
+    char *string;
+    Character *character;
+    Point *point;
+
+    map = btree_map_new(Integer_compare);
+    for (i = 0; i < N; i++) {
+        pair = pair_new(Integer_new(i), Integer_new(i), Integer_delete, Integer_delete);
+        btree_map_put(map, pair);
+    }
+    for (i = 0; i < N; i++) {
+        key = Integer_new(i);
+        integer = (Integer *)btree_map_get(map, key);
+        assert(integer != NULL);
+        assert(Integer_get(integer) == i);
+        Integer_delete(key);
+    }
+    btree_map_delete(map);
+
+    map = btree_map_new(Integer_compare);
+    pair = pair_new(Integer_new(0), "hello", Integer_delete, NULL);
+    btree_map_put(map, pair);
+    pair = pair_new(Integer_new(1), "world", Integer_delete, NULL);
+    btree_map_put(map, pair);
+    pair = pair_new(Integer_new(2), "test", Integer_delete, NULL);
+    btree_map_put(map, pair);
+    pair = pair_new(Integer_new(0), "HELLO", Integer_delete, NULL);
+    btree_map_put(map, pair);
+    pair = pair_new(Integer_new(1), "WORLD", Integer_delete, NULL);
+    btree_map_put(map, pair);
+
+    key = Integer_new(0);
+    string = (char *)btree_map_get(map, key);
+    assert(string != NULL);
+    assert(strcmp(string, "HELLO") == 0);
+    Integer_delete(key);
+
+    key = Integer_new(1);
+    string = (char *)btree_map_get(map, key);
+    assert(string != NULL);
+    assert(strcmp(string, "WORLD") == 0);
+    Integer_delete(key);
+
+    key = Integer_new(2);
+    string = (char *)btree_map_get(map, key);
+    assert(string != NULL);
+    assert(strcmp(string, "test") == 0);
+    Integer_delete(key);
+
+    btree_map_delete(map);
+
+    map = btree_map_new(Point_compare);
+    pair = pair_new(Point_new(1, 1), Character_new('A'), Point_delete, Character_delete);
+    btree_map_put(map, pair);
+    pair = pair_new(Point_new(1, 2), Character_new('B'), Point_delete, Character_delete);
+    btree_map_put(map, pair);
+    pair = pair_new(Point_new(2, 1), Character_new('C'), Point_delete, Character_delete);
+    btree_map_put(map, pair);
+    pair = pair_new(Point_new(2, 2), Character_new('D'), Point_delete, Character_delete);
+    btree_map_put(map, pair);
+    pair = pair_new(Point_new(1, 1), Character_new('a'), Point_delete, Character_delete);
+    btree_map_put(map, pair);
+    pair = pair_new(Point_new(2, 1), Character_new('c'), Point_delete, Character_delete);
+    btree_map_put(map, pair);
+    pair = pair_new(Point_new(3, 3), Character_new('E'), Point_delete, Character_delete);
+    btree_map_put(map, pair);
+
+    point = Point_new(1, 1);
+    character = (Character *)btree_map_get(map, point);
+    assert(character != NULL);
+    assert(Character_get(character) == 'a');
+    Point_delete(point);
+
+    point = Point_new(1, 1);
+    character = (Character *)btree_map_get(map, point);
+    assert(character != NULL);
+    assert(Character_get(character) == 'a');
+    Point_delete(point);
+
+    point = Point_new(1, 2);
+    character = (Character *)btree_map_get(map, point);
+    assert(character != NULL);
+    assert(Character_get(character) == 'B');
+    Point_delete(point);
+
+    point = Point_new(2, 1);
+    character = (Character *)btree_map_get(map, point);
+    assert(character != NULL);
+    assert(Character_get(character) == 'c');
+    Point_delete(point);
+
+    point = Point_new(2, 2);
+    character = (Character *)btree_map_get(map, point);
+    assert(character != NULL);
+    assert(Character_get(character) == 'D');
+    Point_delete(point);
+
+    point = Point_new(3, 3);
+    character = (Character *)btree_map_get(map, point);
+    assert(character != NULL);
+    assert(Character_get(character) == 'E');
+    Point_delete(point);
+
+    btree_map_delete(map);
+}
+
+void test_btree_map_floor() {
+    int i = 0;
+    btree_map_t *map = NULL;
+    pair_t *pair;
+    Integer *key;
+
+    map = btree_map_new(Integer_compare);
+    for (i = 0; i < N; i++) {
+        pair = pair_new(Integer_new(i * 2), Integer_new(i), Integer_delete, Integer_delete);
+        btree_map_put(map, pair);
+    }
+
+    for (i = 0; i < N; i++) {
+        key = Integer_new(i * 2 + 1);
+        pair = btree_map_floor(map, key);
+        assert(pair != NULL);
+        assert(Integer_get(pair_get_key(pair)) == i * 2);
+        assert(Integer_get(pair_get_value(pair)) == i);
+        Integer_delete(key);
+    }
+
+    key = Integer_new(-1);
+    assert(btree_map_floor(map, key) == NULL);
+    Integer_delete(key);
+
+    btree_map_delete(map);
+}
+
+void test_btree_map_ceiling() {
+    int i = 0;
+    btree_map_t *map = NULL;
+    pair_t *pair;
+    Integer *key;
+
+    map = btree_map_new(Integer_compare);
+    for (i = 0; i < N; i++) {
+        pair = pair_new(Integer_new(i * 2), Integer_new(i), Integer_delete, Integer_delete);
+        btree_map_put(map, pair);
+    }
+
+    for (i = 0; i < N; i++) {
+        key = Integer_new(i * 2 - 1);
+        pair = btree_map_ceiling(map, key);
+        assert(pair != NULL);
+        assert(Integer_get(pair_get_key(pair)) == i * 2);
+        assert(Integer_get(pair_get_value(pair)) == i);
+        Integer_delete(key);
+    }
+
+    key = Integer_new(N * 2 - 1);
+    assert(btree_map_ceiling(map, key) == NULL);
+    Integer_delete(key);
+
+    btree_map_delete(map);
+}
+
+void test_btree_map_lower() {
+    int i = 0;
+    btree_map_t *map = NULL;
+    pair_t *pair;
+    Integer *key;
+
+    map = btree_map_new(Integer_compare);
+    for (i = 0; i < N; i++) {
+        pair = pair_new(Integer_new(i * 2), Integer_new(i), Integer_delete, Integer_delete);
+        btree_map_put(map, pair);
+    }
+
+    for (i = 0; i < N; i++) {
+        key = Integer_new(i * 2 + 2);
+        pair = btree_map_lower(map, key);
+        assert(pair != NULL);
+        assert(Integer_get(pair_get_key(pair)) == i * 2);
+        assert(Integer_get(pair_get_value(pair)) == i);
+        Integer_delete(key);
+    }
+
+    key = Integer_new(0);
+    assert(btree_map_lower(map, key) == NULL);
+    Integer_delete(key);
+
+    btree_map_delete(map);
+}
+
+void test_btree_map_higher() {
+    int i = 0;
+    btree_map_t *map = NULL;
+    pair_t *pair;
+    Integer *key;
+
+    map = btree_map_new(Integer_compare);
+    for (i = 0; i < N; i++) {
+        pair = pair_new(Integer_new(i * 2), Integer_new(i), Integer_delete, Integer_delete);
+        btree_map_put(map, pair);
+    }
+
+    for (i = 0; i < N; i++) {
+        key = Integer_new(i * 2 - 2);
+        pair = btree_map_higher(map, key);
+        assert(pair != NULL);
+        assert(Integer_get(pair_get_key(pair)) == i * 2);
+        assert(Integer_get(pair_get_value(pair)) == i);
+        Integer_delete(key);
+    }
+
+    key = Integer_new(N * 2 - 2);
+    assert(btree_map_higher(map, key) == NULL);
+    Integer_delete(key);
+
+    btree_map_delete(map);
+}
+
+void test_btree_map_first() {
+    int i = 0;
+    btree_map_t *map = NULL;
+    pair_t *pair;
+
+    map = btree_map_new(Integer_compare);
+    assert(btree_map_first(map) == NULL);
+    for (i = 0; i < N; i++) {
+        pair = pair_new(Integer_new((i * 7) % N), Integer_new(i), Integer_delete, Integer_delete);
+        btree_map_put(map, pair);
+        assert(Integer_get(pair_get_key(btree_map_first(map))) == 0);
+    }
+    btree_map_delete(map);
+}
+
+void test_btree_map_last() {
+    int i = 0;
+    int maximum = 0;
+    btree_map_t *map = NULL;
+    pair_t *pair;
+
+    map = btree_map_new(Integer_compare);
+    assert(btree_map_last(map) == NULL);
+    for (i = 0; i < N; i++) {
+        pair = pair_new(Integer_new((i * 7) % N), Integer_new(i), Integer_delete, Integer_delete);
+        btree_map_put(map, pair);
+        maximum = max(maximum, (i * 7) % N);
+        assert(Integer_get(pair_get_key(btree_map_last(map))) == maximum);
+    }
+    btree_map_delete(map);
+}
+
+void test_btree_map_select() {
+    int i = 0;
+    Integer *key = NULL;
+    btree_map_t *map = btree_map_new(Integer_compare);
+    for (i = 0; i < N; i++) {
+        btree_map_put(map, pair_new(Integer_new((i * 7) % N * 2), Integer_new(i), Integer_delete, Integer_delete));
+    }
+
+    for (i = 0; i < N; i++) {
+        assert(Integer_get(pair_get_key(btree_map_select(map, i))) == i * 2);
+    }
+    assert(btree_map_select(map, N) == NULL);
+
+    /* Ranks shift after removing the smaller half */
+    for (i = 0; i < N / 2; i++) {
+        key = Integer_new(i * 2);
+        btree_map_remove(map, key);
+        Integer_delete(key);
+    }
+    for (i = 0; i < N - N / 2; i++) {
+        assert(Integer_get(pair_get_key(btree_map_select(map, i))) == (N / 2 + i) * 2);
+    }
+
+    btree_map_delete(map);
+}
+
+void test_btree_map_rank() {
+    int i = 0;
+    Integer *key = NULL;
+    btree_map_t *map = btree_map_new(Integer_compare);
+    for (i = 0; i < N; i++) {
+        btree_map_put(map, pair_new(Integer_new((i * 7) % N * 2), Integer_new(i), Integer_delete, Integer_delete));
+    }
+
+    for (i = 0; i < N; i++) {
+        key = Integer_new(i * 2);
+        assert(btree_map_rank(map, key) == (size_t)i);
+        Integer_set(key, i * 2 + 1);
+        assert(btree_map_rank(map, key) == (size_t)i + 1);
+        Integer_delete(key);
+    }
+
+    key = Integer_new(-1);
+    assert(btree_map_rank(map, key) == 0);
+    Integer_delete(key);
+
+    btree_map_delete(map);
+}
+
+void test_btree_map_iterator() {
+    int i = 0;
+    btree_map_t *map = NULL;
+    pair_t *pair;
+    iterator_t *iterator = NULL;
+    Integer *key;
+    Integer *value;
+
+    map = btree_map_new(Integer_compare);
+
+    for (i = 0; i < N; i++) {
+        pair = pair_new(Integer_new(i), Integer_new(i * i), Integer_delete, Integer_delete);
+        btree_map_put(map, pair);
+    }
+
+    iterator = btree_map_iterator_new(map);
+    while (btree_map_iterator_has_next(iterator)) {
+        pair = btree_map_iterator_next(iterator);
+        assert(pair != NULL);
+        key = (Integer *)pair_get_key(pair);
+        value = (Integer *)pair_get_value(pair);
+        assert(Integer_get(value) == Integer_get(key) * Integer_get(key));
+    }
+    btree_map_iterator_delete(iterator);
+
+    btree_map_delete(map);
+}
+
+void test_btree_map_iterator_range() {
+    int i = 0;
+    btree_map_t *map = NULL;
+    pair_t *pair;
+    iterator_t *iterator = NULL;
+    Integer *lo = NULL;
+    Integer *hi = NULL;
+
+    map = btree_map_new(Integer_compare);
+
+    for (i = 0; i < N; i++) {
+        pair = pair_new(Integer_new(i), Integer_new(i * i), Integer_delete, Integer_delete);
+        btree_map_put(map, pair);
+    }
+
+    lo = Integer_new(N / 4);
+    hi = Integer_new(N / 2);
+    iterator = btree_map_iterator_range(map, lo, hi);
+
+    i = N / 4;
+    while (btree_map_iterator_has_next(iterator)) {
+        pair = btree_map_iterator_next(iterator);
+        assert(Integer_get(pair_get_key(pair)) == i);
+        assert(Integer_get(pair_get_value(pair)) == i * i);
+        i++;
+    }
+    assert(i == N / 2);
+
+    btree_map_iterator_delete(iterator);
+    Integer_delete(lo);
+    Integer_delete(hi);
+    btree_map_delete(map);
+}
+
+void test_btree_map_iterator_reverse() {
+    int i = 0;
+    btree_map_t *map = NULL;
+    pair_t *pair;
+    iterator_t *iterator = NULL;
+
+    map = btree_map_new(Integer_compare);
+
+    for (i = 0; i < N; i++) {
+        pair = pair_new(Integer_new(i), Integer_new(i * i), Integer_delete, Integer_delete);
+        btree_map_put(map, pair);
+    }
+
+    iterator = btree_map_iterator_reverse(map);
+
+    i = N - 1;
+    while (btree_map_iterator_has_next(iterator)) {
+        pair = btree_map_iterator_next(iterator);
+        assert(Integer_get(pair_get_key(pair)) == i);
+        i--;
+    }
+    assert(i == -1);
+
+    btree_map_iterator_delete(iterator);
+    btree_map_delete(map);
+}
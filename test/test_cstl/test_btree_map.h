@@ -0,0 +1,27 @@
+#ifndef _TEST_BTREE_MAP_H_
+#define _TEST_BTREE_MAP_H_
+
+void test_btree_map_new();
+void test_btree_map_new_independent();
+void test_btree_map_delete();
+void test_btree_map_is_empty();
+void test_btree_map_size();
+void test_btree_map_foreach();
+void test_btree_map_clear();
+void test_btree_map_contains();
+void test_btree_map_put();
+void test_btree_map_remove();
+void test_btree_map_get();
+void test_btree_map_floor();
+void test_btree_map_ceiling();
+void test_btree_map_lower();
+void test_btree_map_higher();
+void test_btree_map_first();
+void test_btree_map_last();
+void test_btree_map_select();
+void test_btree_map_rank();
+void test_btree_map_iterator();
+void test_btree_map_iterator_range();
+void test_btree_map_iterator_reverse();
+
+#endif
@@ -0,0 +1,1074 @@
+#include "test_btree_set.h"
+#include "cstl.h"
+#include <assert.h>
+
+#define N 1000
+
+void test_btree_set_new() {
+    btree_set_t *set = btree_set_new(UnsignedCharacter_compare, UnsignedCharacter_delete);
+    assert(set != NULL);
+    assert(btree_set_is_empty(set) == true);
+    assert(btree_set_size(set) == 0);
+    btree_set_delete(set);
+}
+
+void test_btree_set_delete() {
+    btree_set_t *set = btree_set_new(UnsignedShort_compare, UnsignedShort_delete);
+    assert(set != NULL);
+    btree_set_delete(set);
+}
+
+void test_btree_set_is_empty() {
+    btree_set_t *set = btree_set_new(UnsignedInteger_compare, UnsignedInteger_delete);
+    assert(btree_set_is_empty(set) == true);
+    btree_set_add(set, UnsignedInteger_new(0));
+    assert(btree_set_is_empty(set) == false);
+    btree_set_delete(set);
+}
+
+void test_btree_set_size() {
+    int i = 0;
+    btree_set_t *set = NULL;
+
+    set = btree_set_new(UnsignedLong_compare, UnsignedLong_delete);
+    assert(btree_set_size(set) == 0);
+    for (i = 0; i < N; i++) {
+        btree_set_add(set, UnsignedLong_new(i));
+    }
+    assert(btree_set_size(set) == N);
+    btree_set_delete(set);
+
+    set = btree_set_new(Integer_compare, Integer_delete);
+    assert(btree_set_size(set) == 0);
+    for (i = 0; i < N; i++) {
+        btree_set_add(set, Integer_new(i));
+        btree_set_add(set, Integer_new(i));
+    }
+    assert(btree_set_size(set) == N);
+    btree_set_delete(set);
+}
+
+static int buffer[N] = {0};
+static int n = 0;
+
+static void Integer_store(T elem) {
+    Integer *integer = (Integer *)elem;
+    buffer[n] = Integer_get(integer);
+    n++;
+}
+
+static void Integer_triple(T elem) {
+    Integer *integer = (Integer *)elem;
+    Integer_set(integer, Integer_get(integer) * 3);
+}
+
+void test_btree_set_foreach() {
+    int i = 0;
+    btree_set_t *set = NULL;
+
+    set = btree_set_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_set_add(set, Integer_new(i));
+    }
+
+    n = 0;
+    btree_set_foreach(set, Integer_store);
+
+    assert(n == N);
+    for (i = 0; i < N; i++) {
+        assert(buffer[i] == i);
+    }
+
+    n = 0;
+    btree_set_foreach(set, Integer_triple);
+    btree_set_foreach(set, Integer_store);
+
+    assert(n == N);
+    for (i = 0; i < N; i++) {
+        assert(buffer[i] == 3 * i);
+    }
+
+    btree_set_delete(set);
+}
+
+void test_btree_set_clear() {
+    int i = 0;
+    btree_set_t *set = btree_set_new(Short_compare, Short_delete);
+    for (i = 0; i < N; i++) {
+        btree_set_add(set, Short_new(i));
+    }
+    assert(btree_set_size(set) == N);
+    btree_set_clear(set);
+    assert(btree_set_is_empty(set) == true);
+    btree_set_delete(set);
+}
+
+void test_btree_set_contains() {
+    int i = 0;
+    btree_set_t *set = NULL;
+    Integer *integer;
+
+    set = btree_set_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_set_add(set, Integer_new(i));
+    }
+
+    for (i = 0; i < N; i++) {
+        integer = Integer_new(randint(0, 3 * N));
+        if (Integer_get(integer) < N) {
+            assert(btree_set_contains(set, integer) == true);
+        } else {
+            assert(btree_set_contains(set, integer) == false);
+        }
+        Integer_delete(integer);
+    }
+
+    btree_set_delete(set);
+}
+
+void test_btree_set_add() {
+    int i = 0;
+    btree_set_t *set = NULL;
+
+    set = btree_set_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_set_add(set, Integer_new(i));
+    }
+    assert(btree_set_size(set) == N);
+    btree_set_delete(set);
+
+    set = btree_set_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_set_add(set, Integer_new(i));
+        btree_set_add(set, Integer_new(i));
+    }
+    assert(btree_set_size(set) == N);
+    btree_set_delete(set);
+
+    set = btree_set_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i += 2) {
+        btree_set_add(set, Integer_new(i));
+    }
+    for (i = 1; i < N; i += 2) {
+        btree_set_add(set, Integer_new(i));
+    }
+    assert(btree_set_size(set) == N);
+    btree_set_delete(set);
+}
+
+void test_btree_set_remove() {
+    int i = 0;
+    btree_set_t *set = NULL;
+    Integer *integer;
+
+    set = btree_set_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_set_add(set, Integer_new(i));
+    }
+    for (i = 0; i < N; i++) {
+        integer = Integer_new(i);
+        btree_set_remove(set, integer);
+        Integer_delete(integer);
+    }
+    assert(btree_set_is_empty(set) == true);
+    btree_set_delete(set);
+
+    set = btree_set_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_set_add(set, Integer_new(i));
+    }
+    for (i = 0; i < N; i++) {
+        integer = Integer_new(i);
+        btree_set_remove(set, integer);
+        btree_set_remove(set, integer);
+        Integer_delete(integer);
+    }
+    assert(btree_set_is_empty(set) == true);
+    btree_set_delete(set);
+
+    set = btree_set_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_set_add(set, Integer_new(i));
+    }
+    for (i = 0; i < N / 2; i++) {
+        integer = Integer_new(N - 1 - i);
+        btree_set_remove(set, integer);
+        Integer_delete(integer);
+    }
+    assert(btree_set_size(set) == N / 2);
+    btree_set_delete(set);
+
+    set = btree_set_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_set_add(set, Integer_new(i));
+    }
+    for (i = 0; i < N; i++) {
+        integer = Integer_new(-1 * i);
+        btree_set_remove(set, integer);
+        Integer_delete(integer);
+    }
+    assert(btree_set_size(set) == N - 1);
+    btree_set_delete(set);
+}
+
+void test_btree_set_select() {
+    int i = 0;
+    Integer *key = NULL;
+    btree_set_t *set = btree_set_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_set_add(set, Integer_new((i * 7) % N * 2));
+    }
+
+    for (i = 0; i < N; i++) {
+        assert(Integer_get(btree_set_select(set, i)) == i * 2);
+    }
+    assert(btree_set_select(set, N) == NULL);
+
+    /* Ranks shift after removing the smaller half */
+    for (i = 0; i < N / 2; i++) {
+        key = Integer_new(i * 2);
+        btree_set_remove(set, key);
+        Integer_delete(key);
+    }
+    for (i = 0; i < N - N / 2; i++) {
+        assert(Integer_get(btree_set_select(set, i)) == (N / 2 + i) * 2);
+    }
+
+    btree_set_delete(set);
+}
+
+void test_btree_set_rank() {
+    int i = 0;
+    Integer *key = NULL;
+    btree_set_t *set = btree_set_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_set_add(set, Integer_new((i * 7) % N * 2));
+    }
+
+    for (i = 0; i < N; i++) {
+        key = Integer_new(i * 2);
+        assert(btree_set_rank(set, key) == (size_t)i);
+        Integer_set(key, i * 2 + 1);
+        assert(btree_set_rank(set, key) == (size_t)i + 1);
+        Integer_delete(key);
+    }
+
+    key = Integer_new(-1);
+    assert(btree_set_rank(set, key) == 0);
+    Integer_delete(key);
+
+    btree_set_delete(set);
+}
+
+void test_btree_set_union() {
+    btree_set_t *set1 = NULL;
+    btree_set_t *set2 = NULL;
+    btree_set_t *set3 = NULL;
+    iterator_t *iterator = NULL;
+    Integer *integer;
+    int i = 0;
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+
+    for (i = 0; i < N / 2; i++) {
+        btree_set_add(set1, Integer_new(i));
+    }
+    for (i = N / 2; i < N; i++) {
+        btree_set_add(set2, Integer_new(i));
+    }
+
+    set3 = btree_set_union(set1, set2);
+    assert(btree_set_size(set3) == N);
+
+    iterator = btree_set_iterator_new(set3);
+    while (btree_set_iterator_has_next(iterator)) {
+        integer = (Integer *)btree_set_iterator_next(iterator);
+        assert(Integer_get(integer) >= 0 && Integer_get(integer) < N);
+    }
+
+    btree_set_iterator_delete(iterator);
+    btree_set_delete(set1);
+    btree_set_delete(set2);
+    btree_set_delete(set3);
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+
+    for (i = 0; i < N; i++) {
+        btree_set_add(set1, Integer_new(i));
+    }
+    for (i = 0; i < N; i++) {
+        btree_set_add(set2, Integer_new(i + 1));
+    }
+
+    set3 = btree_set_union(set1, set2);
+    assert(btree_set_size(set3) == N + 1);
+
+    iterator = btree_set_iterator_new(set3);
+    while (btree_set_iterator_has_next(iterator)) {
+        integer = (Integer *)btree_set_iterator_next(iterator);
+        assert(Integer_get(integer) >= 0 && Integer_get(integer) <= N);
+    }
+
+    btree_set_iterator_delete(iterator);
+    btree_set_delete(set1);
+    btree_set_delete(set2);
+    btree_set_delete(set3);
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+
+    for (i = 0; i < N; i++) {
+        btree_set_add(set1, Integer_new(i));
+    }
+
+    set3 = btree_set_union(set1, set2);
+    assert(btree_set_size(set3) == N);
+
+    iterator = btree_set_iterator_new(set3);
+    while (btree_set_iterator_has_next(iterator)) {
+        integer = (Integer *)btree_set_iterator_next(iterator);
+        assert(Integer_get(integer) >= 0 && Integer_get(integer) < N);
+    }
+
+    btree_set_iterator_delete(iterator);
+    btree_set_delete(set1);
+    btree_set_delete(set2);
+    btree_set_delete(set3);
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+
+    for (i = 0; i < N; i++) {
+        btree_set_add(set2, Integer_new(i));
+    }
+
+    set3 = btree_set_union(set1, set2);
+    assert(btree_set_size(set3) == N);
+
+    iterator = btree_set_iterator_new(set3);
+    while (btree_set_iterator_has_next(iterator)) {
+        integer = (Integer *)btree_set_iterator_next(iterator);
+        assert(Integer_get(integer) >= 0 && Integer_get(integer) < N);
+    }
+
+    btree_set_iterator_delete(iterator);
+    btree_set_delete(set1);
+    btree_set_delete(set2);
+    btree_set_delete(set3);
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+
+    set3 = btree_set_union(set1, set2);
+    assert(btree_set_is_empty(set3) == true);
+    btree_set_delete(set1);
+    btree_set_delete(set2);
+    btree_set_delete(set3);
+
+    set3 = btree_set_union(NULL, NULL);
+    assert(set3 == NULL);
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_set_add(set1, Integer_new(i));
+    }
+    set3 = btree_set_union(set1, NULL);
+    assert(set3 != NULL);
+    assert(btree_set_size(set3) == N);
+    btree_set_delete(set1);
+    btree_set_delete(set3);
+
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_set_add(set2, Integer_new(i));
+    }
+    set3 = btree_set_union(NULL, set2);
+    assert(set3 != NULL);
+    assert(btree_set_size(set3) == N);
+    btree_set_delete(set2);
+    btree_set_delete(set3);
+}
+
+void test_btree_set_intersection() {
+    btree_set_t *set1 = NULL;
+    btree_set_t *set2 = NULL;
+    btree_set_t *set3 = NULL;
+    iterator_t *iterator = NULL;
+    Integer *integer;
+    int i = 0;
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+
+    for (i = 0; i < N; i++) {
+        btree_set_add(set1, Integer_new(i));
+    }
+    for (i = 0; i < N; i++) {
+        btree_set_add(set2, Integer_new(i));
+    }
+
+    set3 = btree_set_intersection(set1, set2);
+    assert(btree_set_size(set3) == N);
+
+    iterator = btree_set_iterator_new(set3);
+    while (btree_set_iterator_has_next(iterator)) {
+        integer = (Integer *)btree_set_iterator_next(iterator);
+        assert(Integer_get(integer) >= 0 && Integer_get(integer) <= N);
+    }
+
+    btree_set_iterator_delete(iterator);
+    btree_set_delete(set1);
+    btree_set_delete(set2);
+    btree_set_delete(set3);
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+
+    for (i = 0; i < N / 2; i++) {
+        btree_set_add(set1, Integer_new(i));
+    }
+    for (i = N / 2; i < N; i++) {
+        btree_set_add(set2, Integer_new(i));
+    }
+
+    set3 = btree_set_intersection(set1, set2);
+    assert(btree_set_is_empty(set3) == true);
+
+    btree_set_delete(set1);
+    btree_set_delete(set2);
+    btree_set_delete(set3);
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+
+    for (i = 0; i < N; i++) {
+        btree_set_add(set1, Integer_new(i));
+    }
+    for (i = 0; i < N; i++) {
+        btree_set_add(set2, Integer_new(i + 1));
+    }
+
+    set3 = btree_set_intersection(set1, set2);
+    assert(btree_set_size(set3) == N - 1);
+
+    iterator = btree_set_iterator_new(set3);
+    while (btree_set_iterator_has_next(iterator)) {
+        integer = (Integer *)btree_set_iterator_next(iterator);
+        assert(Integer_get(integer) >= 1 && Integer_get(integer) < N);
+    }
+
+    btree_set_iterator_delete(iterator);
+    btree_set_delete(set1);
+    btree_set_delete(set2);
+    btree_set_delete(set3);
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+
+    for (i = 0; i < N; i++) {
+        btree_set_add(set1, Integer_new(i));
+    }
+
+    set3 = btree_set_intersection(set1, set2);
+    assert(btree_set_is_empty(set3) == true);
+
+    btree_set_delete(set1);
+    btree_set_delete(set2);
+    btree_set_delete(set3);
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+
+    for (i = 0; i < N; i++) {
+        btree_set_add(set2, Integer_new(i));
+    }
+
+    set3 = btree_set_intersection(set1, set2);
+    assert(btree_set_is_empty(set3) == true);
+
+    btree_set_delete(set1);
+    btree_set_delete(set2);
+    btree_set_delete(set3);
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+    set3 = btree_set_intersection(set1, set2);
+    assert(btree_set_is_empty(set3) == true);
+    btree_set_delete(set1);
+    btree_set_delete(set2);
+    btree_set_delete(set3);
+
+    set3 = btree_set_intersection(NULL, NULL);
+    assert(set3 == NULL);
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_set_add(set1, Integer_new(i));
+    }
+    set3 = btree_set_intersection(set1, NULL);
+    assert(set3 != NULL);
+    assert(btree_set_is_empty(set3) == true);
+    btree_set_delete(set1);
+    btree_set_delete(set3);
+
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_set_add(set2, Integer_new(i));
+    }
+    set3 = btree_set_intersection(NULL, set2);
+    assert(set3 != NULL);
+    assert(btree_set_is_empty(set3) == true);
+    btree_set_delete(set2);
+    btree_set_delete(set3);
+}
+
+void test_btree_set_difference() {
+    btree_set_t *set1 = NULL;
+    btree_set_t *set2 = NULL;
+    btree_set_t *set3 = NULL;
+    iterator_t *iterator = NULL;
+    Integer *integer;
+    int i = 0;
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+
+    for (i = 0; i < N; i++) {
+        btree_set_add(set1, Integer_new(i));
+    }
+    for (i = 0; i < N; i++) {
+        btree_set_add(set2, Integer_new(i));
+    }
+
+    set3 = btree_set_difference(set1, set2);
+    assert(btree_set_is_empty(set3) == true);
+
+    btree_set_delete(set1);
+    btree_set_delete(set2);
+    btree_set_delete(set3);
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+
+    for (i = 0; i < N / 2; i++) {
+        btree_set_add(set1, Integer_new(i));
+    }
+    for (i = N / 2; i < N; i++) {
+        btree_set_add(set2, Integer_new(i));
+    }
+
+    set3 = btree_set_difference(set1, set2);
+    assert(btree_set_size(set3) == N / 2);
+
+    iterator = btree_set_iterator_new(set3);
+    while (btree_set_iterator_has_next(iterator)) {
+        integer = (Integer *)btree_set_iterator_next(iterator);
+        assert(Integer_get(integer) >= 0 && Integer_get(integer) < N / 2);
+    }
+
+    btree_set_iterator_delete(iterator);
+    btree_set_delete(set1);
+    btree_set_delete(set2);
+    btree_set_delete(set3);
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+
+    for (i = 0; i < N; i++) {
+        btree_set_add(set1, Integer_new(i));
+    }
+    for (i = 0; i < N; i++) {
+        btree_set_add(set2, Integer_new(i + 1));
+    }
+
+    set3 = btree_set_difference(set1, set2);
+    assert(btree_set_size(set3) == 1);
+
+    iterator = btree_set_iterator_new(set3);
+    while (btree_set_iterator_has_next(iterator)) {
+        integer = (Integer *)btree_set_iterator_next(iterator);
+        assert(Integer_get(integer) == 0);
+    }
+
+    btree_set_iterator_delete(iterator);
+    btree_set_delete(set1);
+    btree_set_delete(set2);
+    btree_set_delete(set3);
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+
+    for (i = 0; i < N; i++) {
+        btree_set_add(set1, Integer_new(i));
+    }
+
+    set3 = btree_set_difference(set1, set2);
+    assert(btree_set_size(set3) == N);
+
+    iterator = btree_set_iterator_new(set3);
+    while (btree_set_iterator_has_next(iterator)) {
+        integer = (Integer *)btree_set_iterator_next(iterator);
+        assert(Integer_get(integer) >= 0 && Integer_get(integer) < N);
+    }
+
+    btree_set_iterator_delete(iterator);
+    btree_set_delete(set1);
+    btree_set_delete(set2);
+    btree_set_delete(set3);
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+
+    for (i = 0; i < N; i++) {
+        btree_set_add(set2, Integer_new(i));
+    }
+
+    set3 = btree_set_difference(set1, set2);
+    assert(btree_set_is_empty(set3) == true);
+
+    btree_set_delete(set1);
+    btree_set_delete(set2);
+    btree_set_delete(set3);
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+    set3 = btree_set_difference(set1, set2);
+    assert(btree_set_is_empty(set3) == true);
+    btree_set_delete(set1);
+    btree_set_delete(set2);
+    btree_set_delete(set3);
+
+    set3 = btree_set_difference(NULL, NULL);
+    assert(set3 == NULL);
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_set_add(set1, Integer_new(i));
+    }
+
+    set3 = btree_set_difference(set1, NULL);
+    assert(set3 != NULL);
+    assert(btree_set_size(set3) == N);
+
+    iterator = btree_set_iterator_new(set3);
+    while (btree_set_iterator_has_next(iterator)) {
+        integer = (Integer *)btree_set_iterator_next(iterator);
+        assert(Integer_get(integer) >= 0 && Integer_get(integer) < N);
+    }
+
+    btree_set_iterator_delete(iterator);
+    btree_set_delete(set1);
+    btree_set_delete(set3);
+
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_set_add(set2, Integer_new(i));
+    }
+    set3 = btree_set_difference(NULL, set2);
+    assert(set3 == NULL);
+    btree_set_delete(set2);
+}
+
+void test_btree_set_symmetric_difference() {
+    btree_set_t *set1 = NULL;
+    btree_set_t *set2 = NULL;
+    btree_set_t *set3 = NULL;
+    iterator_t *iterator = NULL;
+    Integer *integer;
+    int i = 0;
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+
+    for (i = 0; i < N; i++) {
+        btree_set_add(set1, Integer_new(i));
+    }
+    for (i = 0; i < N; i++) {
+        btree_set_add(set2, Integer_new(i));
+    }
+
+    set3 = btree_set_symmetric_difference(set1, set2);
+    assert(btree_set_is_empty(set3) == true);
+
+    btree_set_delete(set1);
+    btree_set_delete(set2);
+    btree_set_delete(set3);
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+
+    for (i = 0; i < N / 2; i++) {
+        btree_set_add(set1, Integer_new(i));
+    }
+    for (i = N / 2; i < N; i++) {
+        btree_set_add(set2, Integer_new(i));
+    }
+
+    set3 = btree_set_symmetric_difference(set1, set2);
+    assert(btree_set_size(set3) == N);
+
+    iterator = btree_set_iterator_new(set3);
+    while (btree_set_iterator_has_next(iterator)) {
+        integer = (Integer *)btree_set_iterator_next(iterator);
+        assert(Integer_get(integer) >= 0 && Integer_get(integer) < N);
+    }
+
+    btree_set_iterator_delete(iterator);
+    btree_set_delete(set1);
+    btree_set_delete(set2);
+    btree_set_delete(set3);
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+
+    for (i = 0; i < N; i++) {
+        btree_set_add(set1, Integer_new(i));
+    }
+    for (i = 0; i < N; i++) {
+        btree_set_add(set2, Integer_new(i + 1));
+    }
+
+    set3 = btree_set_symmetric_difference(set1, set2);
+    assert(btree_set_size(set3) == 2);
+
+    iterator = btree_set_iterator_new(set3);
+    while (btree_set_iterator_has_next(iterator)) {
+        integer = (Integer *)btree_set_iterator_next(iterator);
+        assert(Integer_get(integer) == 0 || Integer_get(integer) == N);
+    }
+
+    btree_set_iterator_delete(iterator);
+    btree_set_delete(set1);
+    btree_set_delete(set2);
+    btree_set_delete(set3);
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+
+    for (i = 0; i < N; i++) {
+        btree_set_add(set1, Integer_new(i));
+    }
+
+    set3 = btree_set_symmetric_difference(set1, set2);
+    assert(btree_set_size(set3) == N);
+
+    iterator = btree_set_iterator_new(set3);
+    while (btree_set_iterator_has_next(iterator)) {
+        integer = (Integer *)btree_set_iterator_next(iterator);
+        assert(Integer_get(integer) >= 0 && Integer_get(integer) < N);
+    }
+
+    btree_set_iterator_delete(iterator);
+    btree_set_delete(set1);
+    btree_set_delete(set2);
+    btree_set_delete(set3);
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+
+    for (i = 0; i < N; i++) {
+        btree_set_add(set2, Integer_new(i));
+    }
+
+    set3 = btree_set_symmetric_difference(set1, set2);
+    assert(btree_set_size(set3) == N);
+
+    iterator = btree_set_iterator_new(set3);
+    while (btree_set_iterator_has_next(iterator)) {
+        integer = (Integer *)btree_set_iterator_next(iterator);
+        assert(Integer_get(integer) >= 0 && Integer_get(integer) < N);
+    }
+
+    btree_set_iterator_delete(iterator);
+    btree_set_delete(set1);
+    btree_set_delete(set2);
+    btree_set_delete(set3);
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+    set3 = btree_set_symmetric_difference(set1, set2);
+    assert(btree_set_is_empty(set3) == true);
+    btree_set_delete(set1);
+    btree_set_delete(set2);
+    btree_set_delete(set3);
+
+    set3 = btree_set_symmetric_difference(NULL, NULL);
+    assert(set3 == NULL);
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_set_add(set1, Integer_new(i));
+    }
+
+    set3 = btree_set_symmetric_difference(set1, NULL);
+    assert(set3 != NULL);
+    assert(btree_set_size(set3) == N);
+
+    iterator = btree_set_iterator_new(set3);
+    while (btree_set_iterator_has_next(iterator)) {
+        integer = (Integer *)btree_set_iterator_next(iterator);
+        assert(Integer_get(integer) >= 0 && Integer_get(integer) < N);
+    }
+
+    btree_set_iterator_delete(iterator);
+    btree_set_delete(set1);
+    btree_set_delete(set3);
+
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_set_add(set2, Integer_new(i));
+    }
+    set3 = btree_set_symmetric_difference(NULL, set2);
+    assert(set3 != NULL);
+    assert(btree_set_size(set3) == N);
+
+    iterator = btree_set_iterator_new(set3);
+    while (btree_set_iterator_has_next(iterator)) {
+        integer = (Integer *)btree_set_iterator_next(iterator);
+        assert(Integer_get(integer) >= 0 && Integer_get(integer) < N);
+    }
+
+    btree_set_iterator_delete(iterator);
+    btree_set_delete(set2);
+    btree_set_delete(set3);
+}
+
+void test_btree_set_is_disjoint() {
+    btree_set_t *set1 = NULL;
+    btree_set_t *set2 = NULL;
+    int i = 0;
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+
+    for (i = 0; i < N; i++) {
+        btree_set_add(set1, Integer_new(i));
+    }
+    for (i = 0; i < N; i++) {
+        btree_set_add(set2, Integer_new(i));
+    }
+
+    assert(btree_set_is_disjoint(set1, set2) == false);
+    btree_set_delete(set1);
+    btree_set_delete(set2);
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+
+    for (i = 0; i < N / 2; i++) {
+        btree_set_add(set1, Integer_new(i));
+    }
+    for (i = N / 2; i < N; i++) {
+        btree_set_add(set2, Integer_new(i));
+    }
+
+    assert(btree_set_is_disjoint(set1, set2) == true);
+    btree_set_delete(set1);
+    btree_set_delete(set2);
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+
+    for (i = 0; i < N; i++) {
+        btree_set_add(set1, Integer_new(i));
+    }
+    for (i = 0; i < N; i++) {
+        btree_set_add(set2, Integer_new(i + 1));
+    }
+
+    assert(btree_set_is_disjoint(set1, set2) == false);
+    btree_set_delete(set1);
+    btree_set_delete(set2);
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_set_add(set1, Integer_new(i));
+    }
+    assert(btree_set_is_disjoint(set1, set2) == true);
+    btree_set_delete(set1);
+    btree_set_delete(set2);
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_set_add(set2, Integer_new(i));
+    }
+    assert(btree_set_is_disjoint(set1, set2) == true);
+    btree_set_delete(set1);
+    btree_set_delete(set2);
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+    assert(btree_set_is_disjoint(set1, set2) == true);
+    btree_set_delete(set1);
+    btree_set_delete(set2);
+}
+
+void test_btree_set_is_subset() {
+    btree_set_t *set1 = NULL;
+    btree_set_t *set2 = NULL;
+    int i = 0;
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+
+    for (i = 0; i < N / 2; i++) {
+        btree_set_add(set1, Integer_new(i));
+    }
+    for (i = 0; i < N; i++) {
+        btree_set_add(set2, Integer_new(i));
+    }
+
+    assert(btree_set_is_subset(set1, set2) == true);
+    btree_set_delete(set1);
+    btree_set_delete(set2);
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+
+    for (i = 0; i < N; i++) {
+        btree_set_add(set1, Integer_new(i));
+    }
+    for (i = 0; i < N; i++) {
+        btree_set_add(set2, Integer_new(i));
+    }
+
+    assert(btree_set_is_subset(set1, set2) == true);
+    btree_set_delete(set1);
+    btree_set_delete(set2);
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+
+    for (i = 0; i < N / 2; i++) {
+        btree_set_add(set1, Integer_new(i));
+    }
+    for (i = N / 2; i < N; i++) {
+        btree_set_add(set2, Integer_new(i));
+    }
+
+    assert(btree_set_is_subset(set1, set2) == false);
+    btree_set_delete(set1);
+    btree_set_delete(set2);
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+
+    for (i = 0; i < N; i++) {
+        btree_set_add(set1, Integer_new(i));
+    }
+    for (i = 0; i < N; i++) {
+        btree_set_add(set2, Integer_new(i + 1));
+    }
+
+    assert(btree_set_is_subset(set1, set2) == false);
+    btree_set_delete(set1);
+    btree_set_delete(set2);
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_set_add(set1, Integer_new(i));
+    }
+    assert(btree_set_is_subset(set1, set2) == false);
+    btree_set_delete(set1);
+    btree_set_delete(set2);
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_set_add(set2, Integer_new(i));
+    }
+    assert(btree_set_is_subset(set1, set2) == true);
+    btree_set_delete(set1);
+    btree_set_delete(set2);
+
+    set1 = btree_set_new(Integer_compare, Integer_delete);
+    set2 = btree_set_new(Integer_compare, Integer_delete);
+    assert(btree_set_is_subset(set1, set2) == true);
+    btree_set_delete(set1);
+    btree_set_delete(set2);
+}
+
+void test_btree_set_iterator() {
+    int i = 0;
+    btree_set_t *set = NULL;
+    iterator_t *iterator = NULL;
+    Integer *integer;
+
+    set = btree_set_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_set_add(set, Integer_new(i));
+    }
+
+    iterator = btree_set_iterator_new(set);
+
+    i = 0;
+    while (btree_set_iterator_has_next(iterator)) {
+        integer = (Integer *)btree_set_iterator_next(iterator);
+        assert(Integer_get(integer) == i);
+        i++;
+    }
+
+    btree_set_iterator_delete(iterator);
+    btree_set_delete(set);
+}
+
+void test_btree_set_iterator_range() {
+    int i = 0;
+    btree_set_t *set = NULL;
+    iterator_t *iterator = NULL;
+    Integer *lo = NULL;
+    Integer *hi = NULL;
+    Integer *integer;
+
+    set = btree_set_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_set_add(set, Integer_new(i));
+    }
+
+    lo = Integer_new(N / 4);
+    hi = Integer_new(N / 2);
+    iterator = btree_set_iterator_range(set, lo, hi);
+
+    i = N / 4;
+    while (btree_set_iterator_has_next(iterator)) {
+        integer = (Integer *)btree_set_iterator_next(iterator);
+        assert(Integer_get(integer) == i);
+        i++;
+    }
+    assert(i == N / 2);
+
+    btree_set_iterator_delete(iterator);
+    Integer_delete(lo);
+    Integer_delete(hi);
+    btree_set_delete(set);
+}
+
+void test_btree_set_iterator_reverse() {
+    int i = 0;
+    btree_set_t *set = NULL;
+    iterator_t *iterator = NULL;
+    Integer *integer;
+
+    set = btree_set_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        btree_set_add(set, Integer_new(i));
+    }
+
+    iterator = btree_set_iterator_reverse(set);
+
+    i = N - 1;
+    while (btree_set_iterator_has_next(iterator)) {
+        integer = (Integer *)btree_set_iterator_next(iterator);
+        assert(Integer_get(integer) == i);
+        i--;
+    }
+    assert(i == -1);
+
+    btree_set_iterator_delete(iterator);
+    btree_set_delete(set);
+}
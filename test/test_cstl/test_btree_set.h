@@ -0,0 +1,25 @@
+#ifndef _TEST_BTREE_SET_H_
+#define _TEST_BTREE_SET_H_
+
+void test_btree_set_new();
+void test_btree_set_delete();
+void test_btree_set_is_empty();
+void test_btree_set_size();
+void test_btree_set_foreach();
+void test_btree_set_clear();
+void test_btree_set_contains();
+void test_btree_set_add();
+void test_btree_set_remove();
+void test_btree_set_select();
+void test_btree_set_rank();
+void test_btree_set_union();
+void test_btree_set_intersection();
+void test_btree_set_difference();
+void test_btree_set_symmetric_difference();
+void test_btree_set_is_disjoint();
+void test_btree_set_is_subset();
+void test_btree_set_iterator();
+void test_btree_set_iterator_range();
+void test_btree_set_iterator_reverse();
+
+#endif
@@ -944,6 +944,146 @@ void test_hash_set_is_subset() {
     hash_set_delete(set2);
 }
 
+void test_hash_set_union_into() {
+    hash_set_t *set1 = NULL;
+    hash_set_t *set2 = NULL;
+    Integer *elem = NULL;
+    int i = 0;
+
+    set1 = hash_set_new(Integer_compare, NULL, Integer_hash);
+    set2 = hash_set_new(Integer_compare, Integer_delete, Integer_hash);
+    for (i = 0; i < N; i += 2) {
+        hash_set_add(set2, Integer_new(i));
+    }
+    for (i = 0; i < N; i += 3) {
+        elem = Integer_new(i);
+        if (hash_set_contains(set2, elem)) {
+            Integer_delete(elem);
+        } else {
+            hash_set_add(set2, elem);
+        }
+    }
+
+    assert(hash_set_union_into(set1, NULL) == set1);
+    assert(hash_set_union_into(set1, set2) == set1);
+    assert(hash_set_size(set1) == hash_set_size(set2));
+    assert(hash_set_union_into(set1, set2) == set1);
+    assert(hash_set_union_into(set1, set1) == set1);
+    assert(hash_set_size(set1) == hash_set_size(set2));
+
+    elem = Integer_new(0);
+    for (i = 0; i < N; i++) {
+        Integer_set(elem, i);
+        assert(hash_set_contains(set1, elem) == (i % 2 == 0 || i % 3 == 0));
+    }
+    Integer_delete(elem);
+
+    assert(hash_set_union_into(NULL, set2) == NULL);
+    hash_set_delete(set1);
+
+    /* Refuse to share elements between two sets that both destroy them */
+    set1 = hash_set_new(Integer_compare, Integer_delete, Integer_hash);
+    hash_set_add(set1, Integer_new(N));
+    assert(hash_set_union_into(set1, set2) == NULL);
+    assert(hash_set_size(set1) == 1);
+    hash_set_delete(set1);
+    hash_set_delete(set2);
+}
+
+void test_hash_set_retain_all() {
+    hash_set_t *set1 = NULL;
+    hash_set_t *set2 = NULL;
+    Integer *elem = NULL;
+    int i = 0;
+
+    set1 = hash_set_new(Integer_compare, Integer_delete, Integer_hash);
+    set2 = hash_set_new(Integer_compare, Integer_delete, Integer_hash);
+    for (i = 0; i < N; i += 2) {
+        hash_set_add(set1, Integer_new(i));
+    }
+    for (i = 0; i < N; i += 3) {
+        hash_set_add(set2, Integer_new(i));
+    }
+
+    assert(hash_set_retain_all(set1, set1) == set1);
+    assert(hash_set_size(set1) == (N + 1) / 2);
+    assert(hash_set_retain_all(set1, set2) == set1);
+    assert(hash_set_size(set1) == (N + 5) / 6);
+
+    elem = Integer_new(0);
+    for (i = 0; i < N; i++) {
+        Integer_set(elem, i);
+        assert(hash_set_contains(set1, elem) == (i % 6 == 0));
+    }
+    Integer_delete(elem);
+
+    assert(hash_set_retain_all(set1, NULL) == set1);
+    assert(hash_set_is_empty(set1) == true);
+
+    assert(hash_set_retain_all(NULL, set2) == NULL);
+    hash_set_delete(set1);
+    hash_set_delete(set2);
+}
+
+void test_hash_set_remove_all() {
+    hash_set_t *set1 = NULL;
+    hash_set_t *set2 = NULL;
+    Integer *elem = NULL;
+    int i = 0;
+
+    /* A small `other` is removed key by key */
+    set1 = hash_set_new(Integer_compare, Integer_delete, Integer_hash);
+    set2 = hash_set_new(Integer_compare, Integer_delete, Integer_hash);
+    for (i = 0; i < N; i++) {
+        hash_set_add(set1, Integer_new(i));
+    }
+    for (i = 0; i < N; i += 10) {
+        hash_set_add(set2, Integer_new(i));
+    }
+
+    assert(hash_set_remove_all(set1, NULL) == set1);
+    assert(hash_set_remove_all(set1, set2) == set1);
+    assert(hash_set_size(set1) == N - N / 10);
+
+    elem = Integer_new(0);
+    for (i = 0; i < N; i++) {
+        Integer_set(elem, i);
+        assert(hash_set_contains(set1, elem) == (i % 10 != 0));
+    }
+    Integer_delete(elem);
+    hash_set_delete(set1);
+    hash_set_delete(set2);
+
+    /* A large `other` filters the receiver in place */
+    set1 = hash_set_new(Integer_compare, Integer_delete, Integer_hash);
+    set2 = hash_set_new(Integer_compare, Integer_delete, Integer_hash);
+    for (i = 0; i < N; i += 10) {
+        hash_set_add(set1, Integer_new(i));
+    }
+    for (i = 0; i < N; i += 2) {
+        if (i % 20 != 0) {
+            hash_set_add(set2, Integer_new(i));
+        }
+    }
+
+    assert(hash_set_remove_all(set1, set2) == set1);
+    assert(hash_set_size(set1) == N / 20);
+
+    elem = Integer_new(0);
+    for (i = 0; i < N; i++) {
+        Integer_set(elem, i);
+        assert(hash_set_contains(set1, elem) == (i % 20 == 0));
+    }
+    Integer_delete(elem);
+
+    assert(hash_set_remove_all(set1, set1) == set1);
+    assert(hash_set_is_empty(set1) == true);
+
+    assert(hash_set_remove_all(NULL, set2) == NULL);
+    hash_set_delete(set1);
+    hash_set_delete(set2);
+}
+
 void test_hash_set_iterator() {
     int i = 0;
     hash_set_t *set = NULL;
@@ -16,6 +16,9 @@ void test_hash_set_difference();
 void test_hash_set_symmetric_difference();
 void test_hash_set_is_disjoint();
 void test_hash_set_is_subset();
+void test_hash_set_union_into();
+void test_hash_set_retain_all();
+void test_hash_set_remove_all();
 void test_hash_set_iterator();
 
 #endif
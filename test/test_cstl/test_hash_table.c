@@ -569,3 +569,80 @@ void test_hash_table_iterator() {
 
     hash_table_delete(hash_table);
 }
+
+void test_hash_table_reserve() {
+    int i = 0;
+    hash_table_t *hash_table = NULL;
+    Integer *key = NULL;
+
+    hash_table = hash_table_new(Integer_compare, Integer_hash);
+    assert(hash_table_reserve(hash_table, 0) == hash_table);
+    assert(hash_table_reserve(hash_table, N) == hash_table);
+    assert(hash_table_is_empty(hash_table) == true);
+
+    for (i = 0; i < N; i++) {
+        hash_table_put(hash_table, pair_new(Integer_new(i), Integer_new(-i), Integer_delete, Integer_delete));
+    }
+    assert(hash_table_size(hash_table) == N);
+
+    /* Reserving less than the current size keeps every pair reachable */
+    assert(hash_table_reserve(hash_table, N / 2) == hash_table);
+    assert(hash_table_reserve(hash_table, 4 * N) == hash_table);
+    key = Integer_new(0);
+    for (i = 0; i < N; i++) {
+        Integer_set(key, i);
+        assert(Integer_get(hash_table_get(hash_table, key)) == -i);
+    }
+    Integer_delete(key);
+
+    hash_table_delete(hash_table);
+}
+
+void test_hash_table_iterator_remove() {
+    int i = 0;
+    hash_table_t *hash_table = NULL;
+    pair_t *pair;
+    iterator_t *iterator = NULL;
+    Integer *key = NULL;
+
+    hash_table = hash_table_new(Integer_compare, Integer_hash);
+    for (i = 0; i < N; i++) {
+        hash_table_put(hash_table, pair_new(Integer_new(i), Integer_new(i), Integer_delete, Integer_delete));
+    }
+
+    iterator = hash_table_iterator_new(hash_table);
+    assert(hash_table_iterator_remove(iterator) == NULL);
+
+    /* Remove the odd keys while iterating */
+    i = 0;
+    while (hash_table_iterator_has_next(iterator)) {
+        pair = hash_table_iterator_next(iterator);
+        i++;
+        if (Integer_get(pair_get_key(pair)) % 2 == 1) {
+            assert(hash_table_iterator_remove(iterator) == pair);
+            assert(hash_table_iterator_remove(iterator) == NULL);
+            pair_delete(pair);
+        }
+    }
+    hash_table_iterator_delete(iterator);
+    assert(i == N);
+    assert(hash_table_size(hash_table) == N / 2);
+
+    key = Integer_new(0);
+    for (i = 0; i < N; i++) {
+        Integer_set(key, i);
+        assert(hash_table_contains(hash_table, key) == (i % 2 == 0));
+    }
+    Integer_delete(key);
+
+    /* Remove everything that is left */
+    iterator = hash_table_iterator_new(hash_table);
+    while (hash_table_iterator_has_next(iterator)) {
+        hash_table_iterator_next(iterator);
+        pair_delete(hash_table_iterator_remove(iterator));
+    }
+    hash_table_iterator_delete(iterator);
+    assert(hash_table_is_empty(hash_table) == true);
+
+    hash_table_delete(hash_table);
+}
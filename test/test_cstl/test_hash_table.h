@@ -12,5 +12,7 @@ void test_hash_table_put();
 void test_hash_table_remove();
 void test_hash_table_get();
 void test_hash_table_iterator();
+void test_hash_table_reserve();
+void test_hash_table_iterator_remove();
 
 #endif
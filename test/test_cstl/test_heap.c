@@ -20,6 +20,149 @@ void test_heap_new() {
     heap_delete(heap);
 }
 
+void test_heap_new_with_arity() {
+    heap_t *heap = NULL;
+    array_t *array = NULL;
+    Integer *integer;
+    size_t arity = 0;
+    int order[N];
+    int i = 0;
+    int last = 0;
+
+    assert(heap_new_with_arity(MIN_HEAP, Integer_compare, Integer_delete, 0) == NULL);
+    assert(heap_new_with_arity(MIN_HEAP, Integer_compare, Integer_delete, 3) == NULL);
+    assert(heap_new_with_arity(MIN_HEAP, Integer_compare, Integer_delete, 16) == NULL);
+
+    for (i = 0; i < N; i++) {
+        order[i] = i;
+    }
+
+    for (arity = 2; arity <= 8; arity *= 2) {
+        shuffle(order, N, int);
+
+        /* Interleave pushes and pops, then drain in order */
+        heap = heap_new_with_arity(MIN_HEAP, Integer_compare, Integer_delete, arity);
+        for (i = 0; i < N; i++) {
+            heap_push(heap, Integer_new(order[i]));
+            if (i % 3 == 2) {
+                Integer_delete(heap_pop(heap));
+            }
+        }
+        assert(heap_size(heap) == N - N / 3);
+        last = -1;
+        while (!heap_is_empty(heap)) {
+            integer = (Integer *)heap_pop(heap);
+            assert(Integer_get(integer) > last);
+            last = Integer_get(integer);
+            Integer_delete(integer);
+        }
+        heap_delete(heap);
+
+        /* Bulk build of a max heap */
+        heap = heap_new_with_arity(MAX_HEAP, Integer_compare, Integer_delete, arity);
+        array = array_new(NULL, NULL);
+        for (i = 0; i < N; i++) {
+            array_append(array, Integer_new(order[i]));
+        }
+        heap_push_many(heap, array);
+        array_delete(array);
+        for (i = N - 1; i >= 0; i--) {
+            integer = (Integer *)heap_pop(heap);
+            assert(Integer_get(integer) == i);
+            Integer_delete(integer);
+        }
+        heap_delete(heap);
+    }
+}
+
+void test_heap_new_from_array() {
+    heap_t *heap = NULL;
+    array_t *array = NULL;
+    Integer *integer;
+    int order[N];
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        order[i] = i;
+    }
+    shuffle(order, N, int);
+
+    array = array_new(NULL, NULL);
+    for (i = 0; i < N; i++) {
+        array_append(array, Integer_new(order[i]));
+    }
+    heap = heap_new_from_array(MIN_HEAP, Integer_compare, Integer_delete, array);
+    array_delete(array);
+    assert(heap_size(heap) == N);
+    for (i = 0; i < N; i++) {
+        integer = (Integer *)heap_pop(heap);
+        assert(Integer_get(integer) == i);
+        Integer_delete(integer);
+    }
+    heap_delete(heap);
+
+    array = array_new(NULL, NULL);
+    for (i = 0; i < N; i++) {
+        array_append(array, Integer_new(order[i] / 2));
+    }
+    heap = heap_new_from_array(MAX_HEAP, Integer_compare, Integer_delete, array);
+    array_delete(array);
+    for (i = N - 1; i >= 0; i--) {
+        integer = (Integer *)heap_pop(heap);
+        assert(Integer_get(integer) == i / 2);
+        Integer_delete(integer);
+    }
+    heap_delete(heap);
+
+    array = array_new(NULL, NULL);
+    heap = heap_new_from_array(MIN_HEAP, Integer_compare, Integer_delete, array);
+    assert(heap_is_empty(heap) == true);
+    heap_delete(heap);
+    array_delete(array);
+
+    assert(heap_new_from_array(MIN_HEAP, Integer_compare, Integer_delete, NULL) == NULL);
+}
+
+static int destroyed[N] = {0};
+
+static int int_compare(const T elem1, const T elem2) {
+    return *(int *)elem1 - *(int *)elem2;
+}
+
+static void destroy_count(T elem) {
+    destroyed[*(int *)elem]++;
+}
+
+void test_heap_new_from_array_ownership() {
+    heap_t *heap = NULL;
+    array_t *array = NULL;
+    int values[N];
+    int i = 0;
+
+    /* The heap takes over every element, the array created with a NULL destroy releases none */
+    array = array_new(NULL, NULL);
+    for (i = 0; i < N; i++) {
+        values[i] = i;
+        destroyed[i] = 0;
+        array_append(array, &values[i]);
+    }
+    heap = heap_new_from_array(MIN_HEAP, int_compare, destroy_count, array);
+    assert(heap != NULL);
+    array_delete(array);
+    for (i = 0; i < N; i++) {
+        assert(destroyed[i] == 0);
+    }
+
+    /* Popped elements go back to the caller, the rest are destroyed exactly once with the heap */
+    for (i = 0; i < N / 2; i++) {
+        assert(*(int *)heap_pop(heap) == i);
+    }
+    heap_delete(heap);
+    for (i = 0; i < N; i++) {
+        assert(destroyed[i] == (i < N / 2 ? 0 : 1));
+    }
+}
+
 void test_heap_delete() {
     heap_t *heap = NULL;
 
@@ -198,3 +341,104 @@ void test_heap_peek() {
     assert(heap_is_empty(heap) == true);
     heap_delete(heap);
 }
+
+void test_heap_push_many() {
+    heap_t *heap = NULL;
+    array_t *array = NULL;
+    Integer *integer;
+    int i = 0;
+    int j = 0;
+
+    /* Batches of every size, so that both the push path and the rebuild path are taken */
+    heap = heap_new(MIN_HEAP, Integer_compare, Integer_delete);
+    for (i = 1; i <= 64; i *= 2) {
+        array = array_new(NULL, NULL);
+        for (j = 0; j < i * 10; j++) {
+            array_append(array, Integer_new((j * 7919 + i) % N));
+        }
+        assert(heap_push_many(heap, array) == heap);
+        array_delete(array);
+    }
+    assert(heap_size(heap) == 1270);
+
+    j = -1;
+    while (!heap_is_empty(heap)) {
+        integer = (Integer *)heap_pop(heap);
+        assert(Integer_get(integer) >= j);
+        j = Integer_get(integer);
+        Integer_delete(integer);
+    }
+
+    assert(heap_push_many(heap, NULL) == heap);
+    assert(heap_push_many(NULL, NULL) == NULL);
+    heap_delete(heap);
+}
+
+void test_heap_pushpop() {
+    heap_t *heap = NULL;
+    Integer *integer;
+    int i = 0;
+
+    heap = heap_new(MIN_HEAP, Integer_compare, Integer_delete);
+    integer = Integer_new(1);
+    assert(heap_pushpop(heap, integer) == integer);
+    Integer_delete(integer);
+
+    /* Keep the N / 2 largest of 0..N-1 */
+    for (i = 0; i < N / 2; i++) {
+        heap_push(heap, Integer_new(i));
+    }
+    for (i = N / 2; i < N; i++) {
+        integer = (Integer *)heap_pushpop(heap, Integer_new(i));
+        assert(Integer_get(integer) == i - N / 2);
+        Integer_delete(integer);
+    }
+
+    /* A smaller element comes straight back */
+    integer = Integer_new(-1);
+    assert(heap_pushpop(heap, integer) == integer);
+    Integer_delete(integer);
+
+    /* A NULL element is rejected instead of popping the root */
+    assert(heap_pushpop(heap, NULL) == NULL);
+    assert(heap_size(heap) == N / 2);
+    for (i = N / 2; i < N; i++) {
+        integer = (Integer *)heap_pop(heap);
+        assert(Integer_get(integer) == i);
+        Integer_delete(integer);
+    }
+    heap_delete(heap);
+}
+
+void test_heap_replace() {
+    heap_t *heap = NULL;
+    Integer *integer;
+    int i = 0;
+
+    heap = heap_new(MAX_HEAP, Integer_compare, Integer_delete);
+    assert(heap_replace(heap, Integer_new(N)) == NULL);
+    assert(heap_size(heap) == 1);
+    assert(heap_replace(heap, NULL) == NULL);
+    assert(heap_size(heap) == 1);
+
+    /* The old root is returned even if the new element is larger */
+    for (i = 0; i < N; i++) {
+        integer = (Integer *)heap_replace(heap, Integer_new(N + 1 + i));
+        assert(Integer_get(integer) == N + i);
+        Integer_delete(integer);
+    }
+    for (i = 0; i < N; i++) {
+        heap_push(heap, Integer_new(i));
+    }
+    integer = (Integer *)heap_replace(heap, Integer_new(-1));
+    assert(Integer_get(integer) == 2 * N);
+    Integer_delete(integer);
+
+    for (i = N - 1; i >= -1; i--) {
+        integer = (Integer *)heap_pop(heap);
+        assert(Integer_get(integer) == i);
+        Integer_delete(integer);
+    }
+    assert(heap_is_empty(heap) == true);
+    heap_delete(heap);
+}
@@ -2,6 +2,9 @@
 #define _TEST_HEAP_H_
 
 void test_heap_new();
+void test_heap_new_with_arity();
+void test_heap_new_from_array();
+void test_heap_new_from_array_ownership();
 void test_heap_delete();
 void test_heap_is_empty();
 void test_heap_size();
@@ -9,5 +12,8 @@ void test_heap_clear();
 void test_heap_push();
 void test_heap_pop();
 void test_heap_peek();
+void test_heap_push_many();
+void test_heap_pushpop();
+void test_heap_replace();
 
 #endif
@@ -0,0 +1,260 @@
+#include "test_indexed_heap.h"
+#include "cstl.h"
+#include <assert.h>
+
+#define N 1000
+
+void test_indexed_heap_new() {
+    indexed_heap_t *heap = indexed_heap_new(MIN_HEAP, Integer_compare, Integer_delete);
+    assert(heap != NULL);
+    assert(indexed_heap_is_empty(heap) == true);
+    assert(indexed_heap_size(heap) == 0);
+    indexed_heap_delete(heap);
+
+    assert(indexed_heap_new(MIN_HEAP, NULL, Integer_delete) == NULL);
+}
+
+void test_indexed_heap_delete() {
+    indexed_heap_t *heap = indexed_heap_new(MAX_HEAP, Integer_compare, Integer_delete);
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        indexed_heap_push(heap, Integer_new(i));
+    }
+    indexed_heap_delete(heap);
+    indexed_heap_delete(NULL);
+}
+
+void test_indexed_heap_is_empty() {
+    indexed_heap_t *heap = indexed_heap_new(MIN_HEAP, Integer_compare, Integer_delete);
+    assert(indexed_heap_is_empty(heap) == true);
+    indexed_heap_push(heap, Integer_new(1));
+    assert(indexed_heap_is_empty(heap) == false);
+    Integer_delete(indexed_heap_pop(heap));
+    assert(indexed_heap_is_empty(heap) == true);
+    indexed_heap_delete(heap);
+}
+
+void test_indexed_heap_size() {
+    indexed_heap_t *heap = indexed_heap_new(MIN_HEAP, Integer_compare, Integer_delete);
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        indexed_heap_push(heap, Integer_new(i));
+        assert(indexed_heap_size(heap) == (size_t)i + 1);
+    }
+    for (i = N; i > 0; i--) {
+        Integer_delete(indexed_heap_pop(heap));
+        assert(indexed_heap_size(heap) == (size_t)i - 1);
+    }
+    indexed_heap_delete(heap);
+}
+
+void test_indexed_heap_clear() {
+    indexed_heap_t *heap = indexed_heap_new(MIN_HEAP, Integer_compare, Integer_delete);
+    size_t handle = 0;
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        handle = indexed_heap_push(heap, Integer_new(i));
+    }
+    assert(indexed_heap_clear(heap) == heap);
+    assert(indexed_heap_is_empty(heap) == true);
+    assert(indexed_heap_contains(heap, handle) == false);
+
+    indexed_heap_push(heap, Integer_new(1));
+    assert(indexed_heap_size(heap) == 1);
+    indexed_heap_delete(heap);
+}
+
+void test_indexed_heap_push() {
+    indexed_heap_t *heap = indexed_heap_new(MIN_HEAP, Integer_compare, Integer_delete);
+    size_t handles[N];
+    int i = 0;
+    int j = 0;
+
+    /* Handles are distinct while their elements are in the heap */
+    for (i = 0; i < N; i++) {
+        handles[i] = indexed_heap_push(heap, Integer_new(N - i));
+        assert(handles[i] != INDEXED_HEAP_INVALID_HANDLE);
+        for (j = 0; j < i; j += 97) {
+            assert(handles[j] != handles[i]);
+        }
+    }
+    for (i = 0; i < N; i++) {
+        assert(Integer_get(indexed_heap_get(heap, handles[i])) == N - i);
+    }
+
+    assert(indexed_heap_push(heap, NULL) == INDEXED_HEAP_INVALID_HANDLE);
+    assert(indexed_heap_push(NULL, NULL) == INDEXED_HEAP_INVALID_HANDLE);
+    indexed_heap_delete(heap);
+}
+
+void test_indexed_heap_pop() {
+    indexed_heap_t *heap = NULL;
+    Integer *integer;
+    int order[N];
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        order[i] = i;
+    }
+    shuffle(order, N, int);
+
+    heap = indexed_heap_new(MIN_HEAP, Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        indexed_heap_push(heap, Integer_new(order[i]));
+    }
+    for (i = 0; i < N; i++) {
+        integer = indexed_heap_pop(heap);
+        assert(Integer_get(integer) == i);
+        Integer_delete(integer);
+    }
+    assert(indexed_heap_pop(heap) == NULL);
+    indexed_heap_delete(heap);
+
+    heap = indexed_heap_new(MAX_HEAP, Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        indexed_heap_push(heap, Integer_new(order[i]));
+    }
+    for (i = N - 1; i >= 0; i--) {
+        integer = indexed_heap_pop(heap);
+        assert(Integer_get(integer) == i);
+        Integer_delete(integer);
+    }
+    indexed_heap_delete(heap);
+}
+
+void test_indexed_heap_peek() {
+    indexed_heap_t *heap = indexed_heap_new(MIN_HEAP, Integer_compare, Integer_delete);
+    size_t handle = 0;
+    int i = 0;
+
+    assert(indexed_heap_peek(heap) == NULL);
+    assert(indexed_heap_peek_handle(heap) == INDEXED_HEAP_INVALID_HANDLE);
+
+    for (i = N; i > 0; i--) {
+        handle = indexed_heap_push(heap, Integer_new(i));
+        assert(Integer_get(indexed_heap_peek(heap)) == i);
+        assert(indexed_heap_peek_handle(heap) == handle);
+    }
+    indexed_heap_delete(heap);
+}
+
+void test_indexed_heap_get() {
+    indexed_heap_t *heap = indexed_heap_new(MIN_HEAP, Integer_compare, Integer_delete);
+    size_t handle1 = 0;
+    size_t handle2 = 0;
+
+    handle1 = indexed_heap_push(heap, Integer_new(1));
+    handle2 = indexed_heap_push(heap, Integer_new(2));
+    assert(indexed_heap_contains(heap, handle1) == true);
+    assert(Integer_get(indexed_heap_get(heap, handle2)) == 2);
+
+    Integer_delete(indexed_heap_pop(heap));
+    assert(indexed_heap_contains(heap, handle1) == false);
+    assert(indexed_heap_get(heap, handle1) == NULL);
+    assert(indexed_heap_get(heap, 12345) == NULL);
+    assert(Integer_get(indexed_heap_get(heap, handle2)) == 2);
+
+    indexed_heap_delete(heap);
+}
+
+void test_indexed_heap_update() {
+    indexed_heap_t *heap = indexed_heap_new(MIN_HEAP, Integer_compare, Integer_delete);
+    size_t handles[N];
+    Integer *integer;
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        handles[i] = indexed_heap_push(heap, Integer_new(i));
+    }
+
+    /* Reverse the order by changing every key in place, half of them moving down */
+    for (i = 0; i < N; i++) {
+        Integer_set(indexed_heap_get(heap, handles[i]), N - 1 - i);
+        indexed_heap_update(heap, handles[i]);
+    }
+    for (i = 0; i < N; i++) {
+        assert(indexed_heap_peek_handle(heap) == handles[N - 1 - i]);
+        integer = indexed_heap_pop(heap);
+        assert(Integer_get(integer) == i);
+        Integer_delete(integer);
+    }
+
+    assert(indexed_heap_update(heap, 0) == heap);
+    assert(indexed_heap_update(NULL, 0) == NULL);
+    indexed_heap_delete(heap);
+}
+
+void test_indexed_heap_decrease_key() {
+    indexed_heap_t *heap = indexed_heap_new(MIN_HEAP, Integer_compare, Integer_delete);
+    size_t handles[N];
+    Integer *integer;
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        handles[i] = indexed_heap_push(heap, Integer_new(N + i));
+    }
+    for (i = N - 1; i >= 0; i -= 2) {
+        Integer_set(indexed_heap_get(heap, handles[i]), i - N);
+        indexed_heap_decrease_key(heap, handles[i]);
+        assert(indexed_heap_peek_handle(heap) == handles[i]);
+    }
+
+    for (i = 1; i < N; i += 2) {
+        integer = indexed_heap_pop(heap);
+        assert(Integer_get(integer) == i - N);
+        Integer_delete(integer);
+    }
+    for (i = 0; i < N; i += 2) {
+        integer = indexed_heap_pop(heap);
+        assert(Integer_get(integer) == N + i);
+        Integer_delete(integer);
+    }
+    indexed_heap_delete(heap);
+}
+
+void test_indexed_heap_remove() {
+    indexed_heap_t *heap = indexed_heap_new(MAX_HEAP, Integer_compare, Integer_delete);
+    size_t handles[N];
+    Integer *integer;
+    int order[N];
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        order[i] = i;
+    }
+    shuffle(order, N, int);
+    for (i = 0; i < N; i++) {
+        handles[order[i]] = indexed_heap_push(heap, Integer_new(order[i]));
+    }
+
+    /* Remove the multiples of 3 from anywhere in the heap */
+    for (i = 0; i < N; i += 3) {
+        integer = indexed_heap_remove(heap, handles[i]);
+        assert(Integer_get(integer) == i);
+        Integer_delete(integer);
+        assert(indexed_heap_remove(heap, handles[i]) == NULL);
+    }
+    assert(indexed_heap_size(heap) == N - (N + 2) / 3);
+
+    /* Freed handles are reused */
+    for (i = 0; i < N; i += 3) {
+        handles[i] = indexed_heap_push(heap, Integer_new(-i));
+    }
+    for (i = N - 1; i >= 0; i--) {
+        if (i % 3 != 0) {
+            integer = indexed_heap_pop(heap);
+            assert(Integer_get(integer) == i);
+            Integer_delete(integer);
+        }
+    }
+    for (i = 0; i < N; i += 3) {
+        integer = indexed_heap_pop(heap);
+        assert(Integer_get(integer) == -i);
+        Integer_delete(integer);
+    }
+    assert(indexed_heap_is_empty(heap) == true);
+    indexed_heap_delete(heap);
+}
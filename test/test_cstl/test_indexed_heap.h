@@ -0,0 +1,17 @@
+#ifndef _TEST_INDEXED_HEAP_H_
+#define _TEST_INDEXED_HEAP_H_
+
+void test_indexed_heap_new();
+void test_indexed_heap_delete();
+void test_indexed_heap_is_empty();
+void test_indexed_heap_size();
+void test_indexed_heap_clear();
+void test_indexed_heap_push();
+void test_indexed_heap_pop();
+void test_indexed_heap_peek();
+void test_indexed_heap_get();
+void test_indexed_heap_update();
+void test_indexed_heap_decrease_key();
+void test_indexed_heap_remove();
+
+#endif
@@ -12,6 +12,41 @@ void test_list_new() {
     list_delete(list);
 }
 
+void test_list_new_with_pool() {
+    int i = 0;
+    pool_t *pool = list_pool_new();
+    list_t *list1 = list_new_with_pool(Integer_compare, Integer_delete, pool);
+    list_t *list2 = list_new_with_pool(Integer_compare, Integer_delete, pool);
+    assert(list1 != NULL && list2 != NULL);
+
+    for (i = 0; i < N; i++) {
+        list_push_back(list1, Integer_new(i));
+        list_push_front(list2, Integer_new(i));
+    }
+    for (i = 0; i < N / 2; i++) {
+        Integer_delete(list_pop_front(list1));
+        list_push_back(list2, Integer_new(i));
+    }
+
+    assert(list_size(list1) == N - N / 2);
+    assert(list_size(list2) == N + N / 2);
+    for (i = 0; i < N - N / 2; i++) {
+        assert(Integer_get(list_get(list1, i)) == N / 2 + i);
+    }
+    for (i = 0; i < N; i++) {
+        assert(Integer_get(list_get(list2, i)) == N - i - 1);
+    }
+
+    list_delete(list1);
+    list_clear(list2);
+    assert(list_is_empty(list2) == true);
+    list_push_back(list2, Integer_new(0));
+    list_delete(list2);
+    pool_delete(pool);
+
+    assert(list_new_with_pool(Integer_compare, Integer_delete, NULL) == NULL);
+}
+
 void test_list_delete() {
     list_t *list = list_new(UnsignedShort_compare, UnsignedShort_delete);
     assert(list != NULL);
@@ -419,3 +454,304 @@ void test_list_iterator() {
     list_iterator_delete(iterator);
     list_delete(list);
 }
+
+void test_list_iterator_remove() {
+    int i = 0;
+    list_t *list = NULL;
+    iterator_t *iterator = NULL;
+    Integer *integer;
+
+    list = list_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        list_push_back(list, Integer_new(i));
+    }
+
+    /* Remove all odd elements while iterating */
+    iterator = list_iterator_new(list);
+    assert(list_iterator_remove(iterator) == NULL);
+    while (list_iterator_has_next(iterator)) {
+        integer = (Integer *)list_iterator_next(iterator);
+        if (Integer_get(integer) % 2 == 1) {
+            integer = (Integer *)list_iterator_remove(iterator);
+            Integer_delete(integer);
+        }
+    }
+    list_iterator_delete(iterator);
+
+    assert(list_size(list) == N / 2);
+    for (i = 0; i < N / 2; i++) {
+        assert(Integer_get(list_get(list, i)) == i * 2);
+    }
+
+    /* Remove everything, including head and tail */
+    iterator = list_iterator_new(list);
+    while (list_iterator_has_next(iterator)) {
+        list_iterator_next(iterator);
+        Integer_delete(list_iterator_remove(iterator));
+    }
+    list_iterator_delete(iterator);
+
+    assert(list_is_empty(list));
+    list_push_back(list, Integer_new(N));
+    assert(Integer_get(list_get_front(list)) == N);
+    assert(Integer_get(list_get_back(list)) == N);
+
+    list_delete(list);
+
+    /* After a removal there is nothing to remove, replace or insert before until next() */
+    list = list_new(Integer_compare, Integer_delete);
+    for (i = 0; i < 5; i++) {
+        list_push_back(list, Integer_new(i));
+    }
+    iterator = list_iterator_new(list);
+    for (i = 0; i < 3; i++) {
+        list_iterator_next(iterator);
+    }
+    integer = (Integer *)list_iterator_remove(iterator);
+    assert(Integer_get(integer) == 2);
+    Integer_delete(integer);
+    assert(list_iterator_remove(iterator) == NULL);
+    integer = Integer_new(99);
+    list_iterator_set(iterator, integer);
+    list_iterator_insert_before(iterator, integer);
+    Integer_delete(integer);
+    assert(list_size(list) == 4);
+    assert(Integer_get(list_get(list, 0)) == 0);
+    assert(Integer_get(list_get(list, 1)) == 1);
+    assert(Integer_get(list_get(list, 2)) == 3);
+
+    assert(Integer_get(list_iterator_next(iterator)) == 3);
+    Integer_delete(list_iterator_remove(iterator));
+    assert(Integer_get(list_iterator_next(iterator)) == 4);
+    list_iterator_delete(iterator);
+    assert(list_size(list) == 3);
+    assert(Integer_get(list_get_back(list)) == 4);
+    list_delete(list);
+}
+
+void test_list_iterator_set() {
+    int i = 0;
+    list_t *list = NULL;
+    iterator_t *iterator = NULL;
+    Integer *integer;
+
+    list = list_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        list_push_back(list, Integer_new(i));
+    }
+
+    iterator = list_iterator_new(list);
+    while (list_iterator_has_next(iterator)) {
+        integer = (Integer *)list_iterator_next(iterator);
+        list_iterator_set(iterator, Integer_new(Integer_get(integer) * 2));
+    }
+    list_iterator_delete(iterator);
+
+    assert(list_size(list) == N);
+    for (i = 0; i < N; i++) {
+        assert(Integer_get(list_get(list, i)) == i * 2);
+    }
+
+    list_delete(list);
+}
+
+void test_list_iterator_insert() {
+    int i = 0;
+    int count = 0;
+    list_t *list = NULL;
+    iterator_t *iterator = NULL;
+    Integer *integer;
+
+    list = list_new(Integer_compare, Integer_delete);
+
+    /* Inserting after a fresh iterator inserts at the beginning */
+    iterator = list_iterator_new(list);
+    list_iterator_insert_before(iterator, NULL);
+    assert(list_is_empty(list));
+    list_iterator_insert_after(iterator, Integer_new(1));
+    list_iterator_delete(iterator);
+    assert(list_size(list) == 1);
+
+    /* Expand 1 into 0, 1, 2 */
+    iterator = list_iterator_new(list);
+    integer = (Integer *)list_iterator_next(iterator);
+    list_iterator_insert_before(iterator, Integer_new(0));
+    list_iterator_insert_after(iterator, Integer_new(2));
+    assert(Integer_get(list_iterator_next(iterator)) == 2);
+    assert(!list_iterator_has_next(iterator));
+    list_iterator_delete(iterator);
+
+    for (i = 0; i < 3; i++) {
+        assert(Integer_get(list_get(list, i)) == i);
+    }
+
+    /* Insert before every element, the inserted ones are not visited */
+    iterator = list_iterator_new(list);
+    while (list_iterator_has_next(iterator)) {
+        integer = (Integer *)list_iterator_next(iterator);
+        list_iterator_insert_before(iterator, Integer_new(-Integer_get(integer)));
+        count++;
+    }
+    list_iterator_delete(iterator);
+
+    assert(count == 3);
+    assert(list_size(list) == 6);
+    for (i = 0; i < 3; i++) {
+        assert(Integer_get(list_get(list, i * 2)) == -i);
+        assert(Integer_get(list_get(list, i * 2 + 1)) == i);
+    }
+
+    /* Insert after every element, the inserted ones are visited next */
+    list_clear(list);
+    list_push_back(list, Integer_new(0));
+    iterator = list_iterator_new(list);
+    while (list_iterator_has_next(iterator)) {
+        integer = (Integer *)list_iterator_next(iterator);
+        if (Integer_get(integer) < N - 1) {
+            list_iterator_insert_after(iterator, Integer_new(Integer_get(integer) + 1));
+        }
+    }
+    list_iterator_delete(iterator);
+
+    assert(list_size(list) == N);
+    for (i = 0; i < N; i++) {
+        assert(Integer_get(list_get(list, i)) == i);
+    }
+
+    list_delete(list);
+}
+
+static int Integer_compare_hundreds(const void *ptr1, const void *ptr2) {
+    return Integer_get((Integer *)ptr1) / 100 - Integer_get((Integer *)ptr2) / 100;
+}
+
+void test_list_sort() {
+    int i = 0;
+    int prev = 0;
+    int value = 0;
+    list_t *list = NULL;
+    iterator_t *iterator = NULL;
+
+    list = list_new(Integer_compare, Integer_delete);
+    list_sort(list);
+    assert(list_is_empty(list) == true);
+    for (i = 0; i < N; i++) {
+        list_push_back(list, Integer_new(randint(-N, N)));
+    }
+    list_sort(list);
+    assert(list_size(list) == N);
+    for (i = 1; i < N; i++) {
+        assert(Integer_get(list_get(list, i - 1)) <= Integer_get(list_get(list, i)));
+    }
+    for (i = N - 1; i > 0; i--) {
+        assert(Integer_get(list_get(list, i - 1)) <= Integer_get(list_get(list, i)));
+    }
+    assert(Integer_get(list_get_back(list)) == Integer_get(list_get(list, N - 1)));
+    list_delete(list);
+
+    /* Elements with equal keys keep their original order */
+    list = list_new(Integer_compare_hundreds, Integer_delete);
+    for (i = 0; i < N; i++) {
+        list_push_back(list, Integer_new((N - i - 1) % 10 * 100 + i / 10));
+    }
+    list_sort(list);
+    iterator = list_iterator_new(list);
+    i = 0;
+    while (list_iterator_has_next(iterator)) {
+        value = Integer_get(list_iterator_next(iterator));
+        assert(value / 100 == i / (N / 10));
+        if (i % (N / 10) != 0) {
+            assert(value > prev);
+        }
+        prev = value;
+        i++;
+    }
+    list_iterator_delete(iterator);
+    list_delete(list);
+}
+
+void test_list_splice() {
+    int i = 0;
+    pool_t *pool = NULL;
+    list_t *list = NULL;
+    list_t *other = NULL;
+
+    list = list_new(Integer_compare, Integer_delete);
+    other = list_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        list_push_back(i < N / 2 ? list : other, Integer_new(i));
+    }
+    list_splice(list, list_size(list), other);
+    assert(list_is_empty(other) == true);
+    assert(list_size(list) == N);
+    for (i = 0; i < N; i++) {
+        assert(Integer_get(list_get(list, i)) == i);
+    }
+    list_delete(other);
+
+    /* Nodes of a shared pool are copied into the private pool */
+    pool = list_pool_new();
+    other = list_new_with_pool(Integer_compare, Integer_delete, pool);
+    list_push_back(other, Integer_new(-2));
+    list_push_back(other, Integer_new(-1));
+    list_splice(list, 0, other);
+    list_push_back(other, Integer_new(N));
+    list_push_back(other, Integer_new(N));
+    list_splice(list, 10, other);
+    list_delete(other);
+    pool_delete(pool);
+
+    assert(list_size(list) == N + 4);
+    assert(Integer_get(list_get(list, 0)) == -2);
+    assert(Integer_get(list_get(list, 1)) == -1);
+    assert(Integer_get(list_get(list, 10)) == N);
+    assert(Integer_get(list_get(list, 11)) == N);
+    assert(Integer_get(list_get(list, 12)) == 8);
+    assert(Integer_get(list_get_back(list)) == N - 1);
+    list_delete(list);
+
+    /* A private pool cannot be merged into a pool of a different block size */
+    pool = pool_new(64);
+    list = list_new_with_pool(Integer_compare, Integer_delete, pool);
+    other = list_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        list_push_back(i < N / 2 ? list : other, Integer_new(i));
+    }
+    list_splice(list, list_size(list), other);
+    list_delete(other);
+    assert(list_size(list) == N);
+    for (i = 0; i < N; i++) {
+        assert(Integer_get(list_get(list, i)) == i);
+    }
+    list_delete(list);
+    pool_delete(pool);
+}
+
+void test_list_merge() {
+    int i = 0;
+    list_t *list = NULL;
+    list_t *other = NULL;
+
+    list = list_new(Integer_compare, Integer_delete);
+    other = list_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        list_push_back(i % 3 == 0 ? list : other, Integer_new(i));
+    }
+    list_merge(list, other);
+    assert(list_is_empty(other) == true);
+    assert(list_size(list) == N);
+    for (i = 0; i < N; i++) {
+        assert(Integer_get(list_get(list, i)) == i);
+    }
+    assert(Integer_get(list_get_back(list)) == N - 1);
+
+    list_push_back(other, Integer_new(-1));
+    list_push_back(other, Integer_new(N));
+    list_merge(other, list);
+    assert(list_size(other) == N + 2);
+    assert(Integer_get(list_get_front(other)) == -1);
+    assert(Integer_get(list_get_back(other)) == N);
+
+    list_delete(list);
+    list_delete(other);
+}
@@ -2,6 +2,7 @@
 #define _TEST_LIST_H_
 
 void test_list_new();
+void test_list_new_with_pool();
 void test_list_delete();
 void test_list_is_empty();
 void test_list_size();
@@ -21,6 +22,12 @@ void test_list_insert();
 void test_list_remove();
 void test_list_count();
 void test_list_reverse();
+void test_list_sort();
+void test_list_splice();
+void test_list_merge();
 void test_list_iterator();
+void test_list_iterator_remove();
+void test_list_iterator_set();
+void test_list_iterator_insert();
 
 #endif
@@ -0,0 +1,248 @@
+#include "test_pairing_heap.h"
+#include "cstl.h"
+#include <assert.h>
+
+#define N 1000
+
+void test_pairing_heap_new() {
+    pairing_heap_t *heap = pairing_heap_new(MIN_HEAP, Integer_compare, Integer_delete);
+    assert(heap != NULL);
+    assert(pairing_heap_is_empty(heap) == true);
+    assert(pairing_heap_size(heap) == 0);
+    pairing_heap_delete(heap);
+
+    assert(pairing_heap_new(MIN_HEAP, NULL, Integer_delete) == NULL);
+}
+
+void test_pairing_heap_delete() {
+    pairing_heap_t *heap = pairing_heap_new(MAX_HEAP, Integer_compare, Integer_delete);
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        pairing_heap_push(heap, Integer_new(i));
+    }
+    /* Leave a multi-level tree behind */
+    Integer_delete(pairing_heap_pop(heap));
+    pairing_heap_delete(heap);
+    pairing_heap_delete(NULL);
+}
+
+void test_pairing_heap_is_empty() {
+    pairing_heap_t *heap = pairing_heap_new(MIN_HEAP, Integer_compare, Integer_delete);
+    assert(pairing_heap_is_empty(heap) == true);
+    pairing_heap_push(heap, Integer_new(1));
+    assert(pairing_heap_is_empty(heap) == false);
+    Integer_delete(pairing_heap_pop(heap));
+    assert(pairing_heap_is_empty(heap) == true);
+    pairing_heap_delete(heap);
+}
+
+void test_pairing_heap_size() {
+    pairing_heap_t *heap = pairing_heap_new(MIN_HEAP, Integer_compare, Integer_delete);
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        pairing_heap_push(heap, Integer_new(i));
+        assert(pairing_heap_size(heap) == (size_t)i + 1);
+    }
+    for (i = N; i > 0; i--) {
+        Integer_delete(pairing_heap_pop(heap));
+        assert(pairing_heap_size(heap) == (size_t)i - 1);
+    }
+    pairing_heap_delete(heap);
+}
+
+void test_pairing_heap_clear() {
+    pairing_heap_t *heap = pairing_heap_new(MIN_HEAP, Integer_compare, Integer_delete);
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        pairing_heap_push(heap, Integer_new(N - i));
+    }
+    Integer_delete(pairing_heap_pop(heap));
+    assert(pairing_heap_clear(heap) == heap);
+    assert(pairing_heap_is_empty(heap) == true);
+    assert(pairing_heap_peek(heap) == NULL);
+
+    pairing_heap_push(heap, Integer_new(1));
+    assert(pairing_heap_size(heap) == 1);
+    pairing_heap_delete(heap);
+}
+
+void test_pairing_heap_push() {
+    pairing_heap_t *heap = pairing_heap_new(MIN_HEAP, Integer_compare, Integer_delete);
+    pairing_heap_node_t *nodes[N];
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        nodes[i] = pairing_heap_push(heap, Integer_new(i));
+        assert(nodes[i] != NULL);
+    }
+    for (i = 0; i < N; i++) {
+        assert(Integer_get(pairing_heap_node_get(nodes[i])) == i);
+    }
+
+    assert(pairing_heap_push(heap, NULL) == NULL);
+    assert(pairing_heap_push(NULL, NULL) == NULL);
+    pairing_heap_delete(heap);
+}
+
+void test_pairing_heap_pop() {
+    pairing_heap_t *heap = NULL;
+    Integer *integer;
+    int order[N];
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        order[i] = i;
+    }
+    shuffle(order, N, int);
+
+    heap = pairing_heap_new(MIN_HEAP, Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        pairing_heap_push(heap, Integer_new(order[i]));
+    }
+    for (i = 0; i < N; i++) {
+        integer = pairing_heap_pop(heap);
+        assert(Integer_get(integer) == i);
+        Integer_delete(integer);
+    }
+    assert(pairing_heap_pop(heap) == NULL);
+    pairing_heap_delete(heap);
+
+    heap = pairing_heap_new(MAX_HEAP, Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        pairing_heap_push(heap, Integer_new(order[i]));
+    }
+    for (i = N - 1; i >= 0; i--) {
+        integer = pairing_heap_pop(heap);
+        assert(Integer_get(integer) == i);
+        Integer_delete(integer);
+    }
+    pairing_heap_delete(heap);
+}
+
+void test_pairing_heap_peek() {
+    pairing_heap_t *heap = pairing_heap_new(MAX_HEAP, Integer_compare, Integer_delete);
+    int i = 0;
+
+    assert(pairing_heap_peek(heap) == NULL);
+    for (i = 0; i < N; i++) {
+        pairing_heap_push(heap, Integer_new(i));
+        assert(Integer_get(pairing_heap_peek(heap)) == i);
+    }
+    pairing_heap_delete(heap);
+}
+
+void test_pairing_heap_meld() {
+    pairing_heap_t *heap1 = pairing_heap_new(MIN_HEAP, Integer_compare, Integer_delete);
+    pairing_heap_t *heap2 = pairing_heap_new(MIN_HEAP, Integer_compare, Integer_delete);
+    pairing_heap_t *heap3 = pairing_heap_new(MAX_HEAP, Integer_compare, Integer_delete);
+    pairing_heap_node_t *node = NULL;
+    Integer *integer;
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        if (i % 2 == 0) {
+            pairing_heap_push(heap1, Integer_new(i));
+        } else {
+            pairing_heap_push(heap2, Integer_new(i));
+        }
+    }
+    node = pairing_heap_push(heap2, Integer_new(N));
+
+    assert(pairing_heap_meld(heap1, heap2) == heap1);
+    assert(pairing_heap_size(heap1) == N + 1);
+    assert(pairing_heap_is_empty(heap2) == true);
+
+    /* Nodes of the melded heap belong to the target heap */
+    Integer_set(pairing_heap_node_get(node), -1);
+    pairing_heap_decrease_key(heap1, node);
+    assert(Integer_get(pairing_heap_peek(heap1)) == -1);
+    Integer_delete(pairing_heap_pop(heap1));
+
+    for (i = 0; i < N; i++) {
+        integer = pairing_heap_pop(heap1);
+        assert(Integer_get(integer) == i);
+        Integer_delete(integer);
+    }
+
+    assert(pairing_heap_meld(heap1, heap2) == heap1);
+    assert(pairing_heap_is_empty(heap1) == true);
+    assert(pairing_heap_meld(heap1, heap3) == NULL);
+    assert(pairing_heap_meld(heap1, NULL) == NULL);
+
+    pairing_heap_delete(heap1);
+    pairing_heap_delete(heap2);
+    pairing_heap_delete(heap3);
+}
+
+void test_pairing_heap_decrease_key() {
+    pairing_heap_t *heap = pairing_heap_new(MIN_HEAP, Integer_compare, Integer_delete);
+    pairing_heap_node_t *nodes[N];
+    Integer *integer;
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        nodes[i] = pairing_heap_push(heap, Integer_new(N + i));
+    }
+    /* Give the nodes a multi-level shape before cutting them out */
+    Integer_delete(pairing_heap_pop(heap));
+
+    for (i = N - 1; i >= 1; i -= 2) {
+        Integer_set(pairing_heap_node_get(nodes[i]), i - N);
+        pairing_heap_decrease_key(heap, nodes[i]);
+        assert(pairing_heap_peek(heap) == pairing_heap_node_get(nodes[i]));
+    }
+
+    for (i = 1; i < N; i += 2) {
+        integer = pairing_heap_pop(heap);
+        assert(Integer_get(integer) == i - N);
+        Integer_delete(integer);
+    }
+    for (i = 2; i < N; i += 2) {
+        integer = pairing_heap_pop(heap);
+        assert(Integer_get(integer) == N + i);
+        Integer_delete(integer);
+    }
+    assert(pairing_heap_is_empty(heap) == true);
+    pairing_heap_delete(heap);
+}
+
+void test_pairing_heap_remove() {
+    pairing_heap_t *heap = pairing_heap_new(MAX_HEAP, Integer_compare, Integer_delete);
+    pairing_heap_node_t *nodes[N];
+    Integer *integer;
+    int order[N];
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        order[i] = i;
+    }
+    shuffle(order, N, int);
+    for (i = 0; i < N; i++) {
+        nodes[order[i]] = pairing_heap_push(heap, Integer_new(order[i]));
+    }
+    Integer_delete(pairing_heap_pop(heap));
+
+    /* Remove the multiples of 3 from anywhere in the heap, including the root */
+    for (i = 0; i < N - 1; i += 3) {
+        integer = pairing_heap_remove(heap, nodes[i]);
+        assert(Integer_get(integer) == i);
+        Integer_delete(integer);
+    }
+    integer = pairing_heap_remove(heap, nodes[N - 2]);
+    assert(Integer_get(integer) == N - 2);
+    Integer_delete(integer);
+
+    for (i = N - 3; i >= 0; i--) {
+        if (i % 3 != 0) {
+            integer = pairing_heap_pop(heap);
+            assert(Integer_get(integer) == i);
+            Integer_delete(integer);
+        }
+    }
+    assert(pairing_heap_is_empty(heap) == true);
+    assert(pairing_heap_remove(heap, NULL) == NULL);
+    pairing_heap_delete(heap);
+}
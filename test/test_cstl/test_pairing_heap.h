@@ -0,0 +1,16 @@
+#ifndef _TEST_PAIRING_HEAP_H_
+#define _TEST_PAIRING_HEAP_H_
+
+void test_pairing_heap_new();
+void test_pairing_heap_delete();
+void test_pairing_heap_is_empty();
+void test_pairing_heap_size();
+void test_pairing_heap_clear();
+void test_pairing_heap_push();
+void test_pairing_heap_pop();
+void test_pairing_heap_peek();
+void test_pairing_heap_meld();
+void test_pairing_heap_decrease_key();
+void test_pairing_heap_remove();
+
+#endif
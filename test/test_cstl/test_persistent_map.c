@@ -0,0 +1,280 @@
+#include "test_persistent_map.h"
+#include "cstl.h"
+#include <assert.h>
+
+#define N 1000
+
+static long sum = 0;
+
+static void Pair_sum(T pair) {
+    sum += Integer_get(pair_get_value((pair_t *)pair));
+}
+
+/**
+ * @brief Put a pair into a version and replace the version by the new one.
+ */
+static persistent_map_t *__put(persistent_map_t *map, int key, int value) {
+    persistent_map_t *next = persistent_map_put(map, pair_new(Integer_new(key), Integer_new(value), Integer_delete, Integer_delete));
+    persistent_map_delete(map);
+    return next;
+}
+
+/**
+ * @brief Remove a key from a version and replace the version by the new one.
+ */
+static persistent_map_t *__remove(persistent_map_t *map, int key) {
+    Integer *elem = Integer_new(key);
+    persistent_map_t *next = persistent_map_remove(map, elem);
+    Integer_delete(elem);
+    persistent_map_delete(map);
+    return next;
+}
+
+void test_persistent_map_new() {
+    persistent_map_t *map = persistent_map_new(Integer_compare);
+    assert(map != NULL);
+    assert(persistent_map_is_empty(map) == true);
+    assert(persistent_map_size(map) == 0);
+    persistent_map_delete(map);
+
+    assert(persistent_map_new(NULL) == NULL);
+}
+
+void test_persistent_map_delete() {
+    persistent_map_t *map = persistent_map_new(Integer_compare);
+    assert(map != NULL);
+    persistent_map_delete(map);
+    persistent_map_delete(NULL);
+}
+
+void test_persistent_map_is_empty() {
+    persistent_map_t *map1 = persistent_map_new(Integer_compare);
+    persistent_map_t *map2 = NULL;
+
+    map2 = persistent_map_put(map1, pair_new(Integer_new(1), Integer_new(1), Integer_delete, Integer_delete));
+    assert(persistent_map_is_empty(map1) == true);
+    assert(persistent_map_is_empty(map2) == false);
+    map2 = __remove(map2, 1);
+    assert(persistent_map_is_empty(map2) == true);
+
+    persistent_map_delete(map1);
+    persistent_map_delete(map2);
+    assert(persistent_map_is_empty(NULL) == true);
+}
+
+void test_persistent_map_size() {
+    persistent_map_t *map = persistent_map_new(Integer_compare);
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        map = __put(map, i, i);
+        assert(persistent_map_size(map) == (size_t)i + 1);
+    }
+    for (i = 0; i < N; i++) {
+        map = __put(map, i, -i);
+        assert(persistent_map_size(map) == N);
+    }
+    for (i = 0; i < N; i++) {
+        map = __remove(map, i);
+        assert(persistent_map_size(map) == (size_t)(N - i - 1));
+    }
+
+    persistent_map_delete(map);
+    assert(persistent_map_size(NULL) == 0);
+}
+
+void test_persistent_map_foreach() {
+    persistent_map_t *map = persistent_map_new(Integer_compare);
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        map = __put(map, i, i);
+    }
+
+    sum = 0;
+    persistent_map_foreach(map, Pair_sum);
+    assert(sum == (long)N * (N - 1) / 2);
+
+    persistent_map_delete(map);
+}
+
+void test_persistent_map_contains() {
+    persistent_map_t *map = persistent_map_new(Integer_compare);
+    Integer *key = Integer_new(0);
+    int i = 0;
+
+    for (i = 0; i < N; i += 2) {
+        map = __put(map, i, i);
+    }
+    for (i = 0; i < N; i++) {
+        Integer_set(key, i);
+        assert(persistent_map_contains(map, key) == (i % 2 == 0));
+    }
+
+    Integer_delete(key);
+    persistent_map_delete(map);
+}
+
+void test_persistent_map_put() {
+    persistent_map_t *map = persistent_map_new(Integer_compare);
+    Integer *key = Integer_new(0);
+    int order[N];
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        order[i] = i;
+    }
+    shuffle(order, N, int);
+
+    for (i = 0; i < N; i++) {
+        map = __put(map, order[i], order[i]);
+    }
+
+    /* Overwriting keeps the size and replaces the value */
+    for (i = 0; i < N; i++) {
+        map = __put(map, i, i * 2);
+    }
+    assert(persistent_map_size(map) == N);
+    for (i = 0; i < N; i++) {
+        Integer_set(key, i);
+        assert(Integer_get(persistent_map_get(map, key)) == i * 2);
+    }
+
+    assert(persistent_map_put(map, NULL) == NULL);
+    Integer_delete(key);
+    persistent_map_delete(map);
+}
+
+void test_persistent_map_remove() {
+    persistent_map_t *map = persistent_map_new(Integer_compare);
+    Integer *key = Integer_new(0);
+    int order[N];
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        map = __put(map, i, i);
+        order[i] = i;
+    }
+    shuffle(order, N, int);
+
+    for (i = 0; i < N / 2; i++) {
+        map = __remove(map, order[i]);
+    }
+    assert(persistent_map_size(map) == N / 2);
+    for (i = 0; i < N; i++) {
+        Integer_set(key, order[i]);
+        assert(persistent_map_contains(map, key) == (i >= N / 2));
+    }
+
+    /* Removing a missing key gives an equal version */
+    map = __remove(map, N);
+    assert(persistent_map_size(map) == N / 2);
+
+    Integer_delete(key);
+    persistent_map_delete(map);
+}
+
+void test_persistent_map_get() {
+    persistent_map_t *map = persistent_map_new(Integer_compare);
+    Integer *key = Integer_new(0);
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        map = __put(map, i, i * i);
+    }
+    for (i = 0; i < N; i++) {
+        Integer_set(key, i);
+        assert(Integer_get(persistent_map_get(map, key)) == i * i);
+    }
+    Integer_set(key, N);
+    assert(persistent_map_get(map, key) == NULL);
+
+    Integer_delete(key);
+    persistent_map_delete(map);
+}
+
+void test_persistent_map_snapshot() {
+    persistent_map_t *versions[N / 10];
+    persistent_map_t *map = persistent_map_new(Integer_compare);
+    Integer *key = Integer_new(0);
+    int i = 0;
+    int j = 0;
+
+    /* Version i holds the keys [0, 10 * i) with values equal to the keys */
+    for (i = 0; i < N; i++) {
+        if (i % 10 == 0) {
+            versions[i / 10] = persistent_map_snapshot(map);
+        }
+        map = __put(map, i, i);
+    }
+
+    /* Rewrite and drain the latest version, the snapshots must not change */
+    for (i = 0; i < N; i++) {
+        map = __put(map, i, -i);
+    }
+    for (i = 0; i < N; i += 2) {
+        map = __remove(map, i);
+    }
+    assert(persistent_map_size(map) == N / 2);
+
+    for (i = 0; i < N / 10; i++) {
+        assert(persistent_map_size(versions[i]) == (size_t)i * 10);
+        for (j = 0; j < N; j += 7) {
+            Integer_set(key, j);
+            if (j < i * 10) {
+                assert(Integer_get(persistent_map_get(versions[i], key)) == j);
+            } else {
+                assert(persistent_map_get(versions[i], key) == NULL);
+            }
+        }
+    }
+
+    /* Release the versions out of order */
+    persistent_map_delete(map);
+    for (i = 0; i < N / 10; i += 2) {
+        persistent_map_delete(versions[i]);
+    }
+    for (i = 1; i < N / 10; i += 2) {
+        persistent_map_delete(versions[i]);
+    }
+
+    Integer_delete(key);
+    assert(persistent_map_snapshot(NULL) == NULL);
+}
+
+void test_persistent_map_iterator() {
+    persistent_map_t *map1 = persistent_map_new(Integer_compare);
+    persistent_map_t *map2 = NULL;
+    iterator_t *iterator = NULL;
+    pair_t *pair = NULL;
+    int order[N];
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        order[i] = i;
+    }
+    shuffle(order, N, int);
+    for (i = 0; i < N; i++) {
+        map1 = __put(map1, order[i], order[i]);
+    }
+    map2 = persistent_map_snapshot(map1);
+
+    /* Iterate one version while another one changes */
+    iterator = persistent_map_iterator_new(map2);
+    for (i = 0; i < N; i++) {
+        map1 = __remove(map1, i);
+        assert(persistent_map_iterator_has_next(iterator) == true);
+        pair = persistent_map_iterator_next(iterator);
+        assert(Integer_get(pair_get_key(pair)) == i);
+    }
+    assert(persistent_map_iterator_has_next(iterator) == false);
+    assert(persistent_map_iterator_next(iterator) == NULL);
+    persistent_map_iterator_delete(iterator);
+
+    iterator = persistent_map_iterator_new(map1);
+    assert(persistent_map_iterator_has_next(iterator) == false);
+    persistent_map_iterator_delete(iterator);
+
+    persistent_map_delete(map1);
+    persistent_map_delete(map2);
+}
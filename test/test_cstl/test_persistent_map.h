@@ -0,0 +1,16 @@
+#ifndef _TEST_PERSISTENT_MAP_H_
+#define _TEST_PERSISTENT_MAP_H_
+
+void test_persistent_map_new();
+void test_persistent_map_delete();
+void test_persistent_map_is_empty();
+void test_persistent_map_size();
+void test_persistent_map_foreach();
+void test_persistent_map_contains();
+void test_persistent_map_put();
+void test_persistent_map_remove();
+void test_persistent_map_get();
+void test_persistent_map_snapshot();
+void test_persistent_map_iterator();
+
+#endif
@@ -0,0 +1,198 @@
+#include "test_radix_heap.h"
+#include "cstl.h"
+#include <assert.h>
+#include <limits.h>
+
+#define N 1000
+
+void test_radix_heap_new() {
+    radix_heap_t *heap = radix_heap_new(Integer_delete);
+    assert(heap != NULL);
+    assert(radix_heap_is_empty(heap) == true);
+    assert(radix_heap_size(heap) == 0);
+    assert(radix_heap_last_key(heap) == 0);
+    radix_heap_delete(heap);
+}
+
+void test_radix_heap_delete() {
+    radix_heap_t *heap = radix_heap_new(Integer_delete);
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        radix_heap_push(heap, (unsigned long)i * 7919 % N, Integer_new(i));
+    }
+    /* Leave entries in several buckets behind */
+    Integer_delete(radix_heap_pop(heap));
+    radix_heap_delete(heap);
+    radix_heap_delete(NULL);
+}
+
+void test_radix_heap_is_empty() {
+    radix_heap_t *heap = radix_heap_new(Integer_delete);
+    assert(radix_heap_is_empty(heap) == true);
+    radix_heap_push(heap, 1, Integer_new(1));
+    assert(radix_heap_is_empty(heap) == false);
+    Integer_delete(radix_heap_pop(heap));
+    assert(radix_heap_is_empty(heap) == true);
+    radix_heap_delete(heap);
+}
+
+void test_radix_heap_size() {
+    radix_heap_t *heap = radix_heap_new(Integer_delete);
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        radix_heap_push(heap, (unsigned long)i, Integer_new(i));
+        assert(radix_heap_size(heap) == (size_t)i + 1);
+    }
+    for (i = N; i > 0; i--) {
+        Integer_delete(radix_heap_pop(heap));
+        assert(radix_heap_size(heap) == (size_t)i - 1);
+    }
+    radix_heap_delete(heap);
+}
+
+void test_radix_heap_clear() {
+    radix_heap_t *heap = radix_heap_new(Integer_delete);
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        radix_heap_push(heap, (unsigned long)i + 100, Integer_new(i));
+    }
+    Integer_delete(radix_heap_pop(heap));
+    assert(radix_heap_last_key(heap) == 100);
+
+    assert(radix_heap_clear(heap) == heap);
+    assert(radix_heap_is_empty(heap) == true);
+    assert(radix_heap_last_key(heap) == 0);
+
+    /* Keys below the old last popped key are accepted again */
+    assert(radix_heap_push(heap, 1, Integer_new(1)) == heap);
+    assert(radix_heap_size(heap) == 1);
+    radix_heap_delete(heap);
+}
+
+void test_radix_heap_push() {
+    radix_heap_t *heap = radix_heap_new(NULL);
+    int i = 0;
+
+    /* Payloads are optional, the keys alone carry the order */
+    for (i = 0; i < N; i++) {
+        assert(radix_heap_push(heap, (unsigned long)(N - i), NULL) == heap);
+    }
+    assert(radix_heap_push(heap, ULONG_MAX, NULL) == heap);
+    assert(radix_heap_push(heap, 0, NULL) == heap);
+    assert(radix_heap_size(heap) == N + 2);
+
+    assert(radix_heap_peek_key(heap) == 0);
+    radix_heap_pop(heap);
+    for (i = 1; i <= N; i++) {
+        assert(radix_heap_peek_key(heap) == (unsigned long)i);
+        radix_heap_pop(heap);
+    }
+    assert(radix_heap_peek_key(heap) == ULONG_MAX);
+    radix_heap_pop(heap);
+    assert(radix_heap_is_empty(heap) == true);
+
+    assert(radix_heap_push(NULL, 0, NULL) == NULL);
+    radix_heap_delete(heap);
+}
+
+void test_radix_heap_pop() {
+    radix_heap_t *heap = radix_heap_new(Integer_delete);
+    Integer *integer;
+    int order[N];
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        order[i] = i;
+    }
+    shuffle(order, N, int);
+
+    for (i = 0; i < N; i++) {
+        radix_heap_push(heap, (unsigned long)order[i] * 1000003, Integer_new(order[i]));
+    }
+    for (i = 0; i < N; i++) {
+        integer = radix_heap_pop(heap);
+        assert(Integer_get(integer) == i);
+        assert(radix_heap_last_key(heap) == (unsigned long)i * 1000003);
+        Integer_delete(integer);
+    }
+    assert(radix_heap_pop(heap) == NULL);
+    radix_heap_delete(heap);
+}
+
+void test_radix_heap_pop_key() {
+    radix_heap_t *heap = radix_heap_new(NULL);
+    unsigned long key = 0;
+    T elem = NULL;
+    int order[N];
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        order[i] = i;
+    }
+    shuffle(order, N, int);
+
+    /* Only the keys matter, so a popped NULL element is told apart from an empty heap */
+    for (i = 0; i < N; i++) {
+        radix_heap_push(heap, (unsigned long)order[i] * 1000003, NULL);
+    }
+    for (i = 0; i < N; i++) {
+        elem = &key;
+        assert(radix_heap_pop_key(heap, &key, &elem) == true);
+        assert(key == (unsigned long)i * 1000003);
+        assert(elem == NULL);
+    }
+    key = 42;
+    assert(radix_heap_pop_key(heap, &key, &elem) == false);
+    assert(key == 42);
+
+    radix_heap_push(heap, radix_heap_last_key(heap), NULL);
+    assert(radix_heap_pop_key(heap, NULL, NULL) == true);
+    assert(radix_heap_is_empty(heap) == true);
+    assert(radix_heap_pop_key(NULL, &key, &elem) == false);
+    radix_heap_delete(heap);
+}
+
+void test_radix_heap_peek() {
+    radix_heap_t *heap = radix_heap_new(Integer_delete);
+    int i = 0;
+
+    assert(radix_heap_peek(heap) == NULL);
+    assert(radix_heap_peek_key(heap) == 0);
+
+    for (i = N; i > 0; i--) {
+        radix_heap_push(heap, (unsigned long)i, Integer_new(i));
+        assert(Integer_get(radix_heap_peek(heap)) == i);
+        assert(radix_heap_peek_key(heap) == (unsigned long)i);
+    }
+    radix_heap_delete(heap);
+}
+
+void test_radix_heap_monotone() {
+    radix_heap_t *heap = radix_heap_new(Integer_delete);
+    Integer *integer = Integer_new(0);
+    unsigned long key = 0;
+    int i = 0;
+
+    /* Hold model: every popped event schedules a later one */
+    for (i = 0; i < N; i++) {
+        radix_heap_push(heap, (unsigned long)randint(0, N), Integer_new(i));
+    }
+    for (i = 0; i < 10 * N; i++) {
+        key = radix_heap_peek_key(heap);
+        Integer_delete(radix_heap_pop(heap));
+        assert(radix_heap_last_key(heap) == key);
+        assert(radix_heap_peek_key(heap) >= key);
+        radix_heap_push(heap, key + (unsigned long)randint(0, N), Integer_new(i));
+    }
+
+    /* Keys below the last popped key are rejected */
+    assert(key > 0);
+    assert(radix_heap_push(heap, key - 1, integer) == NULL);
+    assert(radix_heap_size(heap) == N);
+    assert(radix_heap_push(heap, key, integer) == heap);
+
+    radix_heap_delete(heap);
+}
@@ -0,0 +1,15 @@
+#ifndef _TEST_RADIX_HEAP_H_
+#define _TEST_RADIX_HEAP_H_
+
+void test_radix_heap_new();
+void test_radix_heap_delete();
+void test_radix_heap_is_empty();
+void test_radix_heap_size();
+void test_radix_heap_clear();
+void test_radix_heap_push();
+void test_radix_heap_pop();
+void test_radix_heap_pop_key();
+void test_radix_heap_peek();
+void test_radix_heap_monotone();
+
+#endif
@@ -12,6 +12,133 @@ void test_red_black_tree_new() {
     red_black_tree_delete(tree);
 }
 
+static T pair_key(const T data) {
+    return pair_get_key((pair_t *)data);
+}
+
+void test_red_black_tree_new_with_key() {
+    int i = 0;
+    pair_t *pair = NULL;
+    Integer *key = NULL;
+    red_black_tree_t *tree = red_black_tree_new_with_key(Integer_compare, pair_key, (destroy_t)pair_delete);
+    assert(tree != NULL);
+
+    /* Pairs are ordered by their keys only */
+    for (i = 0; i < N; i++) {
+        red_black_tree_insert(tree, pair_new(Integer_new(N - i - 1), Integer_new(i), Integer_delete, Integer_delete));
+    }
+    assert(red_black_tree_size(tree) == N);
+
+    /* Lookups take the raw key */
+    key = Integer_new(N / 2);
+    assert(red_black_tree_contains(tree, key) == true);
+    assert(Integer_get(pair_get_value(red_black_tree_find(tree, key))) == N - N / 2 - 1);
+    red_black_tree_remove(tree, key);
+    assert(red_black_tree_contains(tree, key) == false);
+    Integer_delete(key);
+
+    /* Putting an equal key replaces the data item in place */
+    red_black_tree_put(tree, pair_new(Integer_new(0), Integer_new(-1), Integer_delete, Integer_delete));
+    assert(red_black_tree_size(tree) == N - 1);
+    pair = (pair_t *)red_black_tree_min(tree);
+    assert(Integer_get(pair_get_value(pair)) == -1);
+
+    assert(Integer_get(pair_get_key(red_black_tree_min(tree))) == 0);
+    assert(Integer_get(pair_get_key(red_black_tree_max(tree))) == N - 1);
+
+    red_black_tree_delete(tree);
+}
+
+void test_red_black_tree_new_from_sorted() {
+    int i = 0;
+    array_t *array = NULL;
+    red_black_tree_t *tree = NULL;
+    Integer *integer = NULL;
+
+    array = array_new(Integer_compare, NULL);
+    for (i = 0; i < N; i++) {
+        array_append(array, Integer_new(i));
+    }
+
+    tree = red_black_tree_new_from_sorted(Integer_compare, NULL, Integer_delete, array);
+    assert(tree != NULL);
+    assert(red_black_tree_size(tree) == N);
+    for (i = 0; i < N; i++) {
+        assert(Integer_get(red_black_tree_select(tree, i)) == i);
+    }
+
+    /* The tree stays balanced under further updates */
+    for (i = 0; i < N; i += 2) {
+        integer = Integer_new(i);
+        red_black_tree_remove(tree, integer);
+        Integer_delete(integer);
+    }
+    for (i = N; i < 2 * N; i++) {
+        red_black_tree_insert(tree, Integer_new(i));
+    }
+    assert(red_black_tree_size(tree) == N / 2 + N);
+    assert(Integer_get(red_black_tree_min(tree)) == 1);
+    assert(Integer_get(red_black_tree_max(tree)) == 2 * N - 1);
+    red_black_tree_delete(tree);
+    array_delete(array);
+
+    /* Unsorted input is rejected and left to the caller */
+    array = array_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        array_append(array, Integer_new(i % 10));
+    }
+    assert(red_black_tree_new_from_sorted(Integer_compare, NULL, Integer_delete, array) == NULL);
+    array_delete(array);
+
+    array = array_new(Integer_compare, NULL);
+    tree = red_black_tree_new_from_sorted(Integer_compare, NULL, Integer_delete, array);
+    assert(tree != NULL);
+    assert(red_black_tree_is_empty(tree));
+    red_black_tree_delete(tree);
+    array_delete(array);
+}
+
+void test_red_black_tree_new_from_array() {
+    int i = 0;
+    array_t *array = NULL;
+    red_black_tree_t *tree = NULL;
+    pair_t *pair = NULL;
+    Integer *key = NULL;
+
+    array = array_new(Integer_compare, NULL);
+    for (i = 0; i < N; i++) {
+        array_append(array, Integer_new((N - i) % 100));
+    }
+
+    tree = red_black_tree_new_from_array(Integer_compare, NULL, Integer_delete, array, false);
+    assert(tree != NULL);
+    assert(red_black_tree_size(tree) == 100);
+    for (i = 0; i < 100; i++) {
+        assert(Integer_get(red_black_tree_select(tree, i)) == i);
+    }
+    red_black_tree_delete(tree);
+    array_delete(array);
+
+    /* With replace, the last data item of equal keys wins */
+    array = array_new(NULL, NULL);
+    for (i = 0; i < N; i++) {
+        array_append(array, pair_new(Integer_new(i % 10), Integer_new(i), Integer_delete, Integer_delete));
+    }
+
+    tree = red_black_tree_new_from_array(Integer_compare, pair_key, (destroy_t)pair_delete, array, true);
+    assert(tree != NULL);
+    assert(red_black_tree_size(tree) == 10);
+    key = Integer_new(0);
+    for (i = 0; i < 10; i++) {
+        Integer_set(key, i);
+        pair = red_black_tree_find(tree, key);
+        assert(Integer_get(pair_get_value(pair)) == N - 10 + i);
+    }
+    Integer_delete(key);
+    red_black_tree_delete(tree);
+    array_delete(array);
+}
+
 void test_red_black_tree_delete() {
     red_black_tree_t *tree = red_black_tree_new(UnsignedShort_compare, UnsignedShort_delete);
     assert(tree != NULL);
@@ -58,6 +185,7 @@ void test_red_black_tree_size() {
 
 void test_red_black_tree_clear() {
     int i = 0;
+    Integer *integer = NULL;
     red_black_tree_t *tree = red_black_tree_new(Integer_compare, Integer_delete);
     for (i = 0; i < N; i++) {
         red_black_tree_insert(tree, Integer_new(i));
@@ -65,6 +193,17 @@ void test_red_black_tree_clear() {
     assert(red_black_tree_size(tree) == N);
     red_black_tree_clear(tree);
     assert(red_black_tree_is_empty(tree) == true);
+
+    /* The tree stays usable after its nodes are released */
+    for (i = 0; i < N; i++) {
+        red_black_tree_insert(tree, Integer_new(N - i));
+    }
+    assert(red_black_tree_size(tree) == N);
+    for (i = 1; i <= N; i++) {
+        integer = Integer_new(i);
+        assert(red_black_tree_contains(tree, integer) == true);
+        Integer_delete(integer);
+    }
     red_black_tree_delete(tree);
 }
 
@@ -164,6 +303,30 @@ void test_red_black_tree_insert() {
     red_black_tree_delete(tree);
 }
 
+void test_red_black_tree_put() {
+    int i = 0;
+    red_black_tree_t *tree = NULL;
+    pair_t *pair = NULL;
+    Integer *key = NULL;
+
+    tree = red_black_tree_new_with_key(Integer_compare, pair_key, (destroy_t)pair_delete);
+    for (i = 0; i < N; i++) {
+        red_black_tree_put(tree, pair_new(Integer_new(i), Integer_new(i), Integer_delete, Integer_delete));
+    }
+    for (i = 0; i < N; i++) {
+        red_black_tree_put(tree, pair_new(Integer_new(i), Integer_new(i * 2), Integer_delete, Integer_delete));
+    }
+    assert(red_black_tree_size(tree) == N);
+
+    for (i = 0; i < N; i++) {
+        key = Integer_new(i);
+        pair = (pair_t *)red_black_tree_find(tree, key);
+        assert(Integer_get(pair_get_value(pair)) == i * 2);
+        Integer_delete(key);
+    }
+    red_black_tree_delete(tree);
+}
+
 void test_red_black_tree_remove() {
     int i = 0;
     red_black_tree_t *tree = NULL;
@@ -217,6 +380,292 @@ void test_red_black_tree_remove() {
     }
     assert(red_black_tree_size(tree) == N - 1);
     red_black_tree_delete(tree);
+
+    /* Remove in shuffled order, the tree must stay ordered and searchable */
+    tree = red_black_tree_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        buffer[i] = i;
+        red_black_tree_insert(tree, Integer_new((i * 7) % N));
+    }
+    shuffle(buffer, N, int);
+    for (i = 0; i < N / 2; i++) {
+        integer = Integer_new(buffer[i]);
+        red_black_tree_remove(tree, integer);
+        assert(red_black_tree_contains(tree, integer) == false);
+        assert(red_black_tree_is_valid(tree) == true);
+        Integer_delete(integer);
+    }
+    assert(red_black_tree_size(tree) == N - N / 2);
+    for (i = N / 2; i < N; i++) {
+        integer = Integer_new(buffer[i]);
+        assert(red_black_tree_contains(tree, integer) == true);
+        Integer_delete(integer);
+    }
+    red_black_tree_delete(tree);
+}
+
+void test_red_black_tree_find() {
+    int i = 0;
+    Integer *key = NULL;
+    Integer *found = NULL;
+    red_black_tree_t *tree = red_black_tree_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        red_black_tree_insert(tree, Integer_new(i * 2));
+    }
+
+    for (i = 0; i < N; i++) {
+        key = Integer_new(i * 2);
+        found = (Integer *)red_black_tree_find(tree, key);
+        assert(found != NULL && found != key);
+        assert(Integer_get(found) == i * 2);
+        Integer_delete(key);
+    }
+
+    key = Integer_new(1);
+    assert(red_black_tree_find(tree, key) == NULL);
+    Integer_delete(key);
+
+    key = Integer_new(-1);
+    assert(red_black_tree_find(tree, key) == NULL);
+    Integer_delete(key);
+
+    key = Integer_new(N * 2);
+    assert(red_black_tree_find(tree, key) == NULL);
+    Integer_delete(key);
+
+    red_black_tree_delete(tree);
+}
+
+void test_red_black_tree_floor() {
+    int i = 0;
+    Integer *key = NULL;
+    Integer *found = NULL;
+    red_black_tree_t *tree = red_black_tree_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        red_black_tree_insert(tree, Integer_new(i * 2));
+    }
+
+    for (i = 0; i < N; i++) {
+        key = Integer_new(i * 2 + 1);
+        found = (Integer *)red_black_tree_floor(tree, key);
+        assert(found != NULL && found != key);
+        assert(Integer_get(found) == i * 2);
+        Integer_delete(key);
+    }
+
+    key = Integer_new(0);
+    assert(Integer_get(red_black_tree_floor(tree, key)) == 0);
+    Integer_delete(key);
+
+    key = Integer_new(-1);
+    assert(red_black_tree_floor(tree, key) == NULL);
+    Integer_delete(key);
+
+    red_black_tree_delete(tree);
+}
+
+void test_red_black_tree_ceiling() {
+    int i = 0;
+    Integer *key = NULL;
+    Integer *found = NULL;
+    red_black_tree_t *tree = red_black_tree_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        red_black_tree_insert(tree, Integer_new(i * 2));
+    }
+
+    for (i = 0; i < N; i++) {
+        key = Integer_new(i * 2 - 1);
+        found = (Integer *)red_black_tree_ceiling(tree, key);
+        assert(found != NULL && found != key);
+        assert(Integer_get(found) == i * 2);
+        Integer_delete(key);
+    }
+
+    key = Integer_new(N * 2 - 2);
+    assert(Integer_get(red_black_tree_ceiling(tree, key)) == N * 2 - 2);
+    Integer_delete(key);
+
+    key = Integer_new(N * 2 - 1);
+    assert(red_black_tree_ceiling(tree, key) == NULL);
+    Integer_delete(key);
+
+    red_black_tree_delete(tree);
+}
+
+void test_red_black_tree_lower() {
+    int i = 0;
+    Integer *key = NULL;
+    Integer *found = NULL;
+    red_black_tree_t *tree = red_black_tree_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        red_black_tree_insert(tree, Integer_new(i * 2));
+    }
+
+    for (i = 0; i < N; i++) {
+        key = Integer_new(i * 2 + 2);
+        found = (Integer *)red_black_tree_lower(tree, key);
+        assert(found != NULL && found != key);
+        assert(Integer_get(found) == i * 2);
+        Integer_delete(key);
+    }
+
+    key = Integer_new(1);
+    assert(Integer_get(red_black_tree_lower(tree, key)) == 0);
+    Integer_delete(key);
+
+    key = Integer_new(0);
+    assert(red_black_tree_lower(tree, key) == NULL);
+    Integer_delete(key);
+
+    red_black_tree_delete(tree);
+}
+
+void test_red_black_tree_higher() {
+    int i = 0;
+    Integer *key = NULL;
+    Integer *found = NULL;
+    red_black_tree_t *tree = red_black_tree_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        red_black_tree_insert(tree, Integer_new(i * 2));
+    }
+
+    for (i = 0; i < N; i++) {
+        key = Integer_new(i * 2 - 2);
+        found = (Integer *)red_black_tree_higher(tree, key);
+        assert(found != NULL && found != key);
+        assert(Integer_get(found) == i * 2);
+        Integer_delete(key);
+    }
+
+    key = Integer_new(N * 2 - 3);
+    assert(Integer_get(red_black_tree_higher(tree, key)) == N * 2 - 2);
+    Integer_delete(key);
+
+    key = Integer_new(N * 2 - 2);
+    assert(red_black_tree_higher(tree, key) == NULL);
+    Integer_delete(key);
+
+    red_black_tree_delete(tree);
+}
+
+void test_red_black_tree_min() {
+    int i = 0;
+    red_black_tree_t *tree = red_black_tree_new(Integer_compare, Integer_delete);
+    assert(red_black_tree_min(tree) == NULL);
+    for (i = 0; i < N; i++) {
+        red_black_tree_insert(tree, Integer_new((i * 7) % N));
+        assert(Integer_get(red_black_tree_min(tree)) == 0);
+    }
+    red_black_tree_delete(tree);
+}
+
+void test_red_black_tree_max() {
+    int i = 0;
+    int maximum = 0;
+    red_black_tree_t *tree = red_black_tree_new(Integer_compare, Integer_delete);
+    assert(red_black_tree_max(tree) == NULL);
+    for (i = 0; i < N; i++) {
+        red_black_tree_insert(tree, Integer_new((i * 7) % N));
+        maximum = max(maximum, (i * 7) % N);
+        assert(Integer_get(red_black_tree_max(tree)) == maximum);
+    }
+    red_black_tree_delete(tree);
+}
+
+void test_red_black_tree_select() {
+    int i = 0;
+    Integer *key = NULL;
+    red_black_tree_t *tree = red_black_tree_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        red_black_tree_insert(tree, Integer_new((i * 7) % N * 2));
+    }
+
+    for (i = 0; i < N; i++) {
+        assert(Integer_get(red_black_tree_select(tree, i)) == i * 2);
+    }
+    assert(red_black_tree_select(tree, N) == NULL);
+
+    /* Ranks shift after removing the smaller half */
+    for (i = 0; i < N / 2; i++) {
+        key = Integer_new(i * 2);
+        red_black_tree_remove(tree, key);
+        Integer_delete(key);
+    }
+    for (i = 0; i < N - N / 2; i++) {
+        assert(Integer_get(red_black_tree_select(tree, i)) == (N / 2 + i) * 2);
+    }
+
+    red_black_tree_delete(tree);
+}
+
+void test_red_black_tree_rank() {
+    int i = 0;
+    Integer *key = NULL;
+    red_black_tree_t *tree = red_black_tree_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        red_black_tree_insert(tree, Integer_new((i * 7) % N * 2));
+    }
+
+    for (i = 0; i < N; i++) {
+        key = Integer_new(i * 2);
+        assert(red_black_tree_rank(tree, key) == (size_t)i);
+        Integer_set(key, i * 2 + 1);
+        assert(red_black_tree_rank(tree, key) == (size_t)i + 1);
+        Integer_delete(key);
+    }
+
+    key = Integer_new(-1);
+    assert(red_black_tree_rank(tree, key) == 0);
+    Integer_delete(key);
+
+    red_black_tree_delete(tree);
+}
+
+void test_red_black_tree_is_valid() {
+    int i = 0;
+    red_black_tree_t *tree = NULL;
+    Integer *key = NULL;
+
+    assert(red_black_tree_is_valid(NULL) == false);
+
+    tree = red_black_tree_new_with_key(Integer_compare, pair_key, (destroy_t)pair_delete);
+    assert(red_black_tree_is_valid(tree) == true);
+
+    /* Put, overwrite and remove in random order, checking every invariant after each step */
+    for (i = 0; i < N; i++) {
+        buffer[i] = i;
+    }
+    shuffle(buffer, N, int);
+    for (i = 0; i < N; i++) {
+        red_black_tree_put(tree, pair_new(Integer_new(buffer[i]), Integer_new(i), Integer_delete, Integer_delete));
+        assert(red_black_tree_is_valid(tree) == true);
+    }
+    shuffle(buffer, N, int);
+    for (i = 0; i < N; i++) {
+        red_black_tree_put(tree, pair_new(Integer_new(buffer[i]), Integer_new(-i), Integer_delete, Integer_delete));
+        assert(red_black_tree_is_valid(tree) == true);
+    }
+    assert(red_black_tree_size(tree) == N);
+
+    /* Interleave removing one key with putting back another */
+    shuffle(buffer, N, int);
+    for (i = 0; i < N; i++) {
+        key = Integer_new(buffer[i]);
+        red_black_tree_remove(tree, key);
+        assert(red_black_tree_is_valid(tree) == true);
+        if (i % 3 == 0) {
+            red_black_tree_put(tree, pair_new(Integer_new(buffer[i / 2]), Integer_new(i), Integer_delete, Integer_delete));
+            assert(red_black_tree_is_valid(tree) == true);
+        }
+        Integer_delete(key);
+    }
+    while (!red_black_tree_is_empty(tree)) {
+        key = Integer_new(Integer_get(pair_get_key(red_black_tree_select(tree, red_black_tree_size(tree) / 2))));
+        red_black_tree_remove(tree, key);
+        assert(red_black_tree_is_valid(tree) == true);
+        Integer_delete(key);
+    }
+    red_black_tree_delete(tree);
 }
 
 void test_red_black_tree_iterator() {
@@ -242,3 +691,88 @@ void test_red_black_tree_iterator() {
     red_black_tree_iterator_delete(iterator);
     red_black_tree_delete(tree);
 }
+
+void test_red_black_tree_iterator_range() {
+    int i = 0;
+    red_black_tree_t *tree = NULL;
+    iterator_t *iterator = NULL;
+    Integer *lo = NULL;
+    Integer *hi = NULL;
+    Integer *integer;
+
+    tree = red_black_tree_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        red_black_tree_insert(tree, Integer_new(i * 2));
+    }
+
+    lo = Integer_new(N / 2 - 1);
+    hi = Integer_new(N);
+    iterator = red_black_tree_iterator_range(tree, lo, hi);
+    i = N / 2;
+    while (red_black_tree_iterator_has_next(iterator)) {
+        integer = (Integer *)red_black_tree_iterator_next(iterator);
+        assert(Integer_get(integer) == i);
+        i += 2;
+    }
+    assert(i == N);
+    red_black_tree_iterator_delete(iterator);
+
+    iterator = red_black_tree_iterator_range(tree, NULL, hi);
+    i = 0;
+    while (red_black_tree_iterator_has_next(iterator)) {
+        integer = (Integer *)red_black_tree_iterator_next(iterator);
+        assert(Integer_get(integer) == i);
+        i += 2;
+    }
+    assert(i == N);
+    red_black_tree_iterator_delete(iterator);
+
+    iterator = red_black_tree_iterator_range(tree, lo, NULL);
+    i = N / 2;
+    while (red_black_tree_iterator_has_next(iterator)) {
+        integer = (Integer *)red_black_tree_iterator_next(iterator);
+        assert(Integer_get(integer) == i);
+        i += 2;
+    }
+    assert(i == N * 2);
+    red_black_tree_iterator_delete(iterator);
+
+    iterator = red_black_tree_iterator_range(tree, hi, lo);
+    assert(!red_black_tree_iterator_has_next(iterator));
+    red_black_tree_iterator_delete(iterator);
+
+    Integer_set(lo, 1);
+    Integer_set(hi, 2);
+    iterator = red_black_tree_iterator_range(tree, lo, hi);
+    assert(!red_black_tree_iterator_has_next(iterator));
+    red_black_tree_iterator_delete(iterator);
+
+    Integer_delete(lo);
+    Integer_delete(hi);
+    red_black_tree_delete(tree);
+}
+
+void test_red_black_tree_iterator_reverse() {
+    int i = 0;
+    red_black_tree_t *tree = NULL;
+    iterator_t *iterator = NULL;
+    Integer *integer;
+
+    tree = red_black_tree_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        red_black_tree_insert(tree, Integer_new(i));
+    }
+
+    iterator = red_black_tree_iterator_reverse(tree);
+
+    i = N - 1;
+    while (red_black_tree_iterator_has_next(iterator)) {
+        integer = (Integer *)red_black_tree_iterator_next(iterator);
+        assert(Integer_get(integer) == i);
+        i--;
+    }
+    assert(i == -1);
+
+    red_black_tree_iterator_delete(iterator);
+    red_black_tree_delete(tree);
+}
@@ -2,6 +2,9 @@
 #define _TEST_RED_BLACK_TREE_H_
 
 void test_red_black_tree_new();
+void test_red_black_tree_new_with_key();
+void test_red_black_tree_new_from_sorted();
+void test_red_black_tree_new_from_array();
 void test_red_black_tree_delete();
 void test_red_black_tree_is_empty();
 void test_red_black_tree_size();
@@ -9,7 +12,20 @@ void test_red_black_tree_clear();
 void test_red_black_tree_contains();
 void test_red_black_tree_foreach();
 void test_red_black_tree_insert();
+void test_red_black_tree_put();
 void test_red_black_tree_remove();
+void test_red_black_tree_find();
+void test_red_black_tree_floor();
+void test_red_black_tree_ceiling();
+void test_red_black_tree_lower();
+void test_red_black_tree_higher();
+void test_red_black_tree_min();
+void test_red_black_tree_max();
+void test_red_black_tree_select();
+void test_red_black_tree_rank();
+void test_red_black_tree_is_valid();
 void test_red_black_tree_iterator();
+void test_red_black_tree_iterator_range();
+void test_red_black_tree_iterator_reverse();
 
 #endif
@@ -2,6 +2,8 @@
 #include "cstl.h"
 #include <assert.h>
 
+#define N 1000
+
 void test_string_new() {
     string_t *string = NULL;
 
@@ -16,6 +18,16 @@ void test_string_new() {
     assert(string_length(string) == 0);
     assert(string_is_empty(string) == true);
     string_delete(string);
+
+    string = string_new("abcdefghijklmnopqrstuvw");
+    assert(string_length(string) == 23);
+    assert(strcmp(string_get(string), "abcdefghijklmnopqrstuvw") == 0);
+    string_delete(string);
+
+    string = string_new("abcdefghijklmnopqrstuvwx");
+    assert(string_length(string) == 24);
+    assert(strcmp(string_get(string), "abcdefghijklmnopqrstuvwx") == 0);
+    string_delete(string);
 }
 
 void test_string_delete() {
@@ -63,6 +75,61 @@ void test_string_is_empty() {
     string_delete(string);
 }
 
+void test_string_capacity() {
+    string_t *string = NULL;
+    int i;
+
+    string = string_new("Hello");
+    assert(string_capacity(string) >= string_length(string));
+    string_delete(string);
+
+    string = string_new("");
+    for (i = 0; i < N; i++) {
+        string_append_char(string, 'a');
+        assert(string_capacity(string) >= string_length(string));
+        assert(string_capacity(string) <= 2 * string_length(string) + 23);
+    }
+    string_delete(string);
+}
+
+void test_string_reserve() {
+    string_t *string = string_new("Hello");
+    const char *data = NULL;
+    int i;
+
+    string_reserve(string, N);
+    assert(string_capacity(string) >= N);
+    assert(strcmp(string_get(string), "Hello") == 0);
+
+    data = string_get(string);
+    for (i = 5; i < N; i++) {
+        string_append_char(string, 'a');
+    }
+    assert(string_get(string) == data);
+    assert(string_length(string) == N);
+
+    string_reserve(string, 0);
+    assert(string_capacity(string) >= N);
+    string_delete(string);
+}
+
+void test_string_shrink_to_fit() {
+    string_t *string = string_new("Hello");
+
+    string_reserve(string, N);
+    string_shrink_to_fit(string);
+    assert(string_capacity(string) < N);
+    assert(strcmp(string_get(string), "Hello") == 0);
+    string_delete(string);
+
+    string = string_new("Hello, world! Hello, world! Hello, world!");
+    string_reserve(string, N);
+    string_shrink_to_fit(string);
+    assert(string_capacity(string) == string_length(string));
+    assert(strcmp(string_get(string), "Hello, world! Hello, world! Hello, world!") == 0);
+    string_delete(string);
+}
+
 void test_string_get() {
     string_t *string = NULL;
 
@@ -112,6 +179,14 @@ void test_string_clear() {
     assert(string_length(string) == 0);
     assert(string_is_empty(string) == true);
     string_delete(string);
+
+    string = string_new("Hello, world! Hello, world! Hello, world!");
+    string_clear(string);
+    assert(string_length(string) == 0);
+    assert(strcmp(string_get(string), "") == 0);
+    string_append_char(string, 'A');
+    assert(strcmp(string_get(string), "A") == 0);
+    string_delete(string);
 }
 
 void test_string_equal() {
@@ -510,6 +585,7 @@ void test_string_count_substring() {
 
 void test_string_append_char() {
     string_t *string = NULL;
+    int i;
 
     string = string_new("Hello, world!");
     string_append_char(string, '!');
@@ -530,6 +606,15 @@ void test_string_append_char() {
     string_append_char(string, '\0');
     assert(strcmp(string_get(string), "Hello, world!") == 0);
     string_delete(string);
+
+    string = string_new("");
+    for (i = 0; i < N; i++) {
+        string_append_char(string, (char)('a' + i % 26));
+        assert(string_length(string) == (size_t)i + 1);
+        assert(string_char_at(string, i) == (char)('a' + i % 26));
+        assert(string_get(string)[i + 1] == '\0');
+    }
+    string_delete(string);
 }
 
 void test_string_insert_char() {
@@ -578,6 +663,40 @@ void test_string_concat() {
     string_concat(string, "");
     assert(strcmp(string_get(string), "") == 0);
     string_delete(string);
+
+    string = string_new("Hello, world!");
+    string_concat(string, " Hello, world!");
+    assert(strcmp(string_get(string), "Hello, world! Hello, world!") == 0);
+    string_remove_string(string, " Hello, world!");
+    assert(strcmp(string_get(string), "Hello, world!") == 0);
+    string_concat(string, " Hello!");
+    assert(strcmp(string_get(string), "Hello, world! Hello!") == 0);
+    string_delete(string);
+}
+
+void test_string_append_n() {
+    string_t *string = NULL;
+    int i;
+
+    string = string_new("Hello");
+    string_append_n(string, ", world!!!", 8);
+    assert(strcmp(string_get(string), "Hello, world!") == 0);
+    string_append_n(string, "abc", 0);
+    assert(strcmp(string_get(string), "Hello, world!") == 0);
+    string_append_n(string, "abc", 10);
+    assert(strcmp(string_get(string), "Hello, world!abc") == 0);
+    assert(string_length(string) == 16);
+    string_delete(string);
+
+    string = string_new("");
+    for (i = 0; i < N; i++) {
+        string_append_n(string, "0123456789", 10);
+    }
+    assert(string_length(string) == 10 * N);
+    for (i = 0; i < 10 * N; i++) {
+        assert(string_char_at(string, i) == '0' + i % 10);
+    }
+    string_delete(string);
 }
 
 void test_string_insert_string() {
@@ -6,6 +6,9 @@ void test_string_delete();
 void test_string_clone();
 void test_string_length();
 void test_string_is_empty();
+void test_string_capacity();
+void test_string_reserve();
+void test_string_shrink_to_fit();
 void test_string_get();
 void test_string_char_at();
 void test_string_set_char_at();
@@ -27,6 +30,7 @@ void test_string_count_substring();
 void test_string_append_char();
 void test_string_insert_char();
 void test_string_concat();
+void test_string_append_n();
 void test_string_insert_string();
 void test_string_remove_char();
 void test_string_remove_string();
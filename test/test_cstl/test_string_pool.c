@@ -0,0 +1,183 @@
+#include "test_string_pool.h"
+#include "cstl.h"
+#include <assert.h>
+#include <stdio.h>
+
+#define N 1000
+
+static char buffer[128];
+
+/**
+ * @brief Format the i-th key into a static buffer.
+ * @param i The index of the key.
+ * @return Returns the key.
+ */
+static const char *key(int i) {
+    sprintf(buffer, "host-%d.example.com", i);
+    return buffer;
+}
+
+void test_string_pool_new() {
+    string_pool_t *pool = string_pool_new();
+    assert(pool != NULL);
+    assert(string_pool_is_empty(pool) == true);
+    assert(string_pool_size(pool) == 0);
+    string_pool_delete(pool);
+}
+
+void test_string_pool_delete() {
+    string_pool_t *pool = string_pool_new();
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        string_pool_intern(pool, key(i));
+    }
+    string_pool_delete(pool);
+    string_pool_delete(NULL);
+}
+
+void test_string_pool_is_empty() {
+    string_pool_t *pool = string_pool_new();
+    assert(string_pool_is_empty(pool) == true);
+    string_pool_intern(pool, "");
+    assert(string_pool_is_empty(pool) == false);
+    string_pool_delete(pool);
+}
+
+void test_string_pool_size() {
+    string_pool_t *pool = string_pool_new();
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        string_pool_intern(pool, key(i));
+        assert(string_pool_size(pool) == (size_t)i + 1);
+    }
+    for (i = 0; i < N; i++) {
+        string_pool_intern(pool, key(i));
+        assert(string_pool_size(pool) == N);
+    }
+    string_pool_delete(pool);
+}
+
+void test_string_pool_clear() {
+    string_pool_t *pool = string_pool_new();
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        string_pool_intern(pool, key(i));
+    }
+    string_pool_clear(pool);
+    assert(string_pool_is_empty(pool) == true);
+    assert(string_pool_lookup(pool, key(0)) == NULL);
+
+    for (i = 0; i < N; i++) {
+        assert(strcmp(string_pool_intern(pool, key(i)), key(i)) == 0);
+    }
+    assert(string_pool_size(pool) == N);
+    string_pool_delete(pool);
+}
+
+void test_string_pool_intern() {
+    string_pool_t *pool = string_pool_new();
+    const char *handles[N];
+    char large[100000];
+    const char *handle = NULL;
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        handles[i] = string_pool_intern(pool, key(i));
+        assert(handles[i] != NULL);
+        assert(handles[i] != buffer);
+        assert(strcmp(handles[i], key(i)) == 0);
+    }
+    /* Handles stay valid and canonical while the pool grows */
+    for (i = 0; i < N; i++) {
+        assert(string_pool_intern(pool, key(i)) == handles[i]);
+        assert(strcmp(handles[i], key(i)) == 0);
+    }
+
+    /* A string larger than an arena chunk */
+    memset(large, 'x', sizeof(large) - 1);
+    large[sizeof(large) - 1] = '\0';
+    handle = string_pool_intern(pool, large);
+    assert(strcmp(handle, large) == 0);
+    assert(string_pool_intern(pool, large) == handle);
+    assert(string_pool_intern(pool, key(0)) == handles[0]);
+
+    assert(string_pool_intern(pool, "") == string_pool_intern(pool, ""));
+    assert(string_pool_intern(NULL, "a") == NULL);
+    assert(string_pool_intern(pool, NULL) == NULL);
+    string_pool_delete(pool);
+}
+
+void test_string_pool_lookup() {
+    string_pool_t *pool = string_pool_new();
+    const char *handle = NULL;
+    int i = 0;
+
+    for (i = 0; i < N; i += 2) {
+        string_pool_intern(pool, key(i));
+    }
+    for (i = 0; i < N; i++) {
+        handle = string_pool_lookup(pool, key(i));
+        if (i % 2 == 0) {
+            assert(handle == string_pool_intern(pool, key(i)));
+        } else {
+            assert(handle == NULL);
+        }
+    }
+    assert(string_pool_size(pool) == N / 2);
+    string_pool_delete(pool);
+}
+
+void test_string_pool_length() {
+    string_pool_t *pool = string_pool_new();
+    int i = 0;
+
+    assert(string_pool_length(string_pool_intern(pool, "")) == 0);
+    for (i = 0; i < N; i++) {
+        assert(string_pool_length(string_pool_intern(pool, key(i))) == strlen(key(i)));
+    }
+    string_pool_delete(pool);
+}
+
+void test_string_pool_hash() {
+    string_pool_t *pool = string_pool_new();
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        assert(string_pool_hash((T)string_pool_intern(pool, key(i))) == str_hash(key(i)));
+    }
+    string_pool_delete(pool);
+}
+
+void test_string_pool_compare() {
+    string_pool_t *pool = string_pool_new();
+    const char *a = string_pool_intern(pool, "apple");
+    const char *b = string_pool_intern(pool, "banana");
+
+    assert(string_pool_compare((T)a, (T)string_pool_intern(pool, "apple")) == 0);
+    assert(string_pool_compare((T)a, (T)b) != 0);
+    assert(string_pool_compare((T)a, (T)b) == -string_pool_compare((T)b, (T)a));
+    string_pool_delete(pool);
+}
+
+void test_string_pool_hash_map() {
+    string_pool_t *pool = string_pool_new();
+    hash_map_t *map = hash_map_new(string_pool_compare, string_pool_hash);
+    Integer *value = NULL;
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        hash_map_put(map, pair_new((T)string_pool_intern(pool, key(i)), Integer_new(i), NULL, Integer_delete));
+    }
+    assert(hash_map_size(map) == N);
+    for (i = 0; i < N; i++) {
+        value = (Integer *)hash_map_get(map, (T)string_pool_intern(pool, key(i)));
+        assert(value != NULL && Integer_get(value) == i);
+    }
+    assert(string_pool_size(pool) == N);
+
+    hash_map_delete(map);
+    string_pool_delete(pool);
+}
@@ -0,0 +1,16 @@
+#ifndef _TEST_STRING_POOL_H_
+#define _TEST_STRING_POOL_H_
+
+void test_string_pool_new();
+void test_string_pool_delete();
+void test_string_pool_is_empty();
+void test_string_pool_size();
+void test_string_pool_clear();
+void test_string_pool_intern();
+void test_string_pool_lookup();
+void test_string_pool_length();
+void test_string_pool_hash();
+void test_string_pool_compare();
+void test_string_pool_hash_map();
+
+#endif
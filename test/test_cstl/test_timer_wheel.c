@@ -0,0 +1,229 @@
+#include "test_timer_wheel.h"
+#include "cstl.h"
+#include <assert.h>
+
+#define N 1000
+
+static int buffer[N] = {0};
+static int n = 0;
+
+static void Integer_fire(T elem) {
+    Integer *integer = (Integer *)elem;
+    buffer[n] = Integer_get(integer);
+    n++;
+    Integer_delete(integer);
+}
+
+void test_timer_wheel_new() {
+    timer_wheel_t *wheel = timer_wheel_new(42, Integer_delete);
+    assert(wheel != NULL);
+    assert(timer_wheel_is_empty(wheel) == true);
+    assert(timer_wheel_size(wheel) == 0);
+    assert(timer_wheel_now(wheel) == 42);
+    timer_wheel_delete(wheel);
+}
+
+void test_timer_wheel_delete() {
+    timer_wheel_t *wheel = timer_wheel_new(0, Integer_delete);
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        timer_wheel_arm(wheel, (unsigned long)i * 4099, Integer_new(i));
+    }
+    timer_wheel_delete(wheel);
+    timer_wheel_delete(NULL);
+}
+
+void test_timer_wheel_is_empty() {
+    timer_wheel_t *wheel = timer_wheel_new(0, Integer_delete);
+    assert(timer_wheel_is_empty(wheel) == true);
+    timer_wheel_arm(wheel, 10, Integer_new(1));
+    assert(timer_wheel_is_empty(wheel) == false);
+    n = 0;
+    timer_wheel_advance(wheel, 10, Integer_fire);
+    assert(timer_wheel_is_empty(wheel) == true);
+    timer_wheel_delete(wheel);
+}
+
+void test_timer_wheel_size() {
+    timer_wheel_t *wheel = timer_wheel_new(0, Integer_delete);
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        timer_wheel_arm(wheel, (unsigned long)i, Integer_new(i));
+        assert(timer_wheel_size(wheel) == (size_t)i + 1);
+    }
+    n = 0;
+    assert(timer_wheel_advance(wheel, N / 2 - 1, Integer_fire) == N / 2);
+    assert(timer_wheel_size(wheel) == N / 2);
+    timer_wheel_delete(wheel);
+}
+
+void test_timer_wheel_clear() {
+    timer_wheel_t *wheel = timer_wheel_new(0, Integer_delete);
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        timer_wheel_arm(wheel, (unsigned long)i * 65537, Integer_new(i));
+    }
+    assert(timer_wheel_clear(wheel) == wheel);
+    assert(timer_wheel_is_empty(wheel) == true);
+
+    n = 0;
+    assert(timer_wheel_advance(wheel, (unsigned long)N * 65537, Integer_fire) == 0);
+    assert(timer_wheel_now(wheel) == (unsigned long)N * 65537);
+
+    timer_wheel_arm(wheel, 0, Integer_new(1));
+    assert(timer_wheel_size(wheel) == 1);
+    timer_wheel_delete(wheel);
+}
+
+void test_timer_wheel_arm() {
+    timer_wheel_t *wheel = timer_wheel_new(1000, Integer_delete);
+    timer_wheel_timer_t *timer = NULL;
+
+    timer = timer_wheel_arm(wheel, 2000, Integer_new(7));
+    assert(timer != NULL);
+    assert(Integer_get(timer_wheel_timer_get(timer)) == 7);
+    assert(timer_wheel_timer_expiry(timer) == 2000);
+
+    /* A timer armed in the past fires on the next advance */
+    timer_wheel_arm(wheel, 10, Integer_new(1));
+    n = 0;
+    assert(timer_wheel_advance(wheel, 1001, Integer_fire) == 1);
+    assert(buffer[0] == 1);
+
+    assert(timer_wheel_arm(NULL, 0, NULL) == NULL);
+    timer_wheel_delete(wheel);
+}
+
+void test_timer_wheel_rearm() {
+    timer_wheel_t *wheel = timer_wheel_new(0, Integer_delete);
+    timer_wheel_timer_t *timers[N];
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        timers[i] = timer_wheel_arm(wheel, (unsigned long)i + 1, Integer_new(i));
+    }
+
+    /* Push every even timer far out and pull the odd ones in, across wheels */
+    for (i = 0; i < N; i++) {
+        if (i % 2 == 0) {
+            assert(timer_wheel_rearm(wheel, timers[i], 100000 + (unsigned long)i) == wheel);
+        } else {
+            assert(timer_wheel_rearm(wheel, timers[i], (unsigned long)i / 2 + 1) == wheel);
+        }
+        assert(timer_wheel_size(wheel) == N);
+    }
+
+    n = 0;
+    assert(timer_wheel_advance(wheel, 99999, Integer_fire) == N / 2);
+    for (i = 0; i < N / 2; i++) {
+        assert(buffer[i] == 2 * i + 1);
+    }
+    n = 0;
+    assert(timer_wheel_advance(wheel, 100000 + N, Integer_fire) == N / 2);
+    for (i = 0; i < N / 2; i++) {
+        assert(buffer[i] == 2 * i);
+    }
+    timer_wheel_delete(wheel);
+}
+
+void test_timer_wheel_cancel() {
+    timer_wheel_t *wheel = timer_wheel_new(0, Integer_delete);
+    timer_wheel_timer_t *timers[N];
+    Integer *integer = NULL;
+    int i = 0;
+
+    for (i = 0; i < N; i++) {
+        timers[i] = timer_wheel_arm(wheel, (unsigned long)i * 1021, Integer_new(i));
+    }
+    for (i = 0; i < N; i += 3) {
+        integer = timer_wheel_cancel(wheel, timers[i]);
+        assert(Integer_get(integer) == i);
+        Integer_delete(integer);
+    }
+    assert(timer_wheel_size(wheel) == N - (N + 2) / 3);
+
+    n = 0;
+    timer_wheel_advance(wheel, (unsigned long)N * 1021, Integer_fire);
+    assert(n == N - (N + 2) / 3);
+    for (i = 0; i < n; i++) {
+        assert(buffer[i] % 3 != 0);
+        assert(i == 0 || buffer[i] > buffer[i - 1]);
+    }
+
+    assert(timer_wheel_cancel(wheel, NULL) == NULL);
+    timer_wheel_delete(wheel);
+}
+
+void test_timer_wheel_advance() {
+    timer_wheel_t *wheel = timer_wheel_new(5, Integer_delete);
+    unsigned long expiries[N];
+    int order[N];
+    int i = 0;
+
+    /* Spread the expiries over all four wheels and past the top one */
+    for (i = 0; i < N; i++) {
+        order[i] = i;
+        expiries[i] = 6 + (unsigned long)i * i * i * 4409;
+    }
+    shuffle(order, N, int);
+    for (i = 0; i < N; i++) {
+        timer_wheel_arm(wheel, expiries[order[i]], Integer_new(order[i]));
+    }
+
+    /* Advance in uneven steps and check that each step fires exactly what expired */
+    n = 0;
+    assert(timer_wheel_advance(wheel, 5, Integer_fire) == 0);
+    assert(timer_wheel_advance(wheel, 4, Integer_fire) == 0);
+    for (i = 0; i < N; i += 7) {
+        timer_wheel_advance(wheel, expiries[i] - 1, Integer_fire);
+        assert(n == i);
+        timer_wheel_advance(wheel, expiries[i], Integer_fire);
+        assert(n == i + 1);
+        assert(timer_wheel_now(wheel) == expiries[i]);
+    }
+    timer_wheel_advance(wheel, expiries[N - 1], Integer_fire);
+    assert(n == N);
+    for (i = 0; i < N; i++) {
+        assert(buffer[i] == i);
+    }
+    assert(timer_wheel_is_empty(wheel) == true);
+    assert(timer_wheel_advance(NULL, 0, Integer_fire) == 0);
+    timer_wheel_delete(wheel);
+}
+
+static timer_wheel_t *reentrant_wheel = NULL;
+static timer_wheel_timer_t *reentrant_timers[N];
+
+static void Integer_fire_reentrant(T elem) {
+    int value = Integer_get(elem);
+
+    /* Cancel the partner timer sharing this tick, and schedule a follow-up for even values */
+    if (value % 2 == 0 && value + 1 < N) {
+        Integer_delete(timer_wheel_cancel(reentrant_wheel, reentrant_timers[value + 1]));
+        timer_wheel_arm(reentrant_wheel, timer_wheel_now(reentrant_wheel) + N, Integer_new(value + N));
+    }
+    Integer_fire(elem);
+}
+
+void test_timer_wheel_advance_reentrant() {
+    int i = 0;
+
+    reentrant_wheel = timer_wheel_new(0, Integer_delete);
+    for (i = 0; i < N; i++) {
+        reentrant_timers[i] = timer_wheel_arm(reentrant_wheel, (unsigned long)i / 2 + 1, Integer_new(i));
+    }
+
+    n = 0;
+    assert(timer_wheel_advance(reentrant_wheel, 2 * N, Integer_fire_reentrant) == N);
+    for (i = 0; i < N / 2; i++) {
+        assert(buffer[i] == 2 * i);
+    }
+    for (i = N / 2; i < N; i++) {
+        assert(buffer[i] == N + 2 * (i - N / 2));
+    }
+    assert(timer_wheel_is_empty(reentrant_wheel) == true);
+    timer_wheel_delete(reentrant_wheel);
+}
@@ -0,0 +1,15 @@
+#ifndef _TEST_TIMER_WHEEL_H_
+#define _TEST_TIMER_WHEEL_H_
+
+void test_timer_wheel_new();
+void test_timer_wheel_delete();
+void test_timer_wheel_is_empty();
+void test_timer_wheel_size();
+void test_timer_wheel_clear();
+void test_timer_wheel_arm();
+void test_timer_wheel_rearm();
+void test_timer_wheel_cancel();
+void test_timer_wheel_advance();
+void test_timer_wheel_advance_reentrant();
+
+#endif
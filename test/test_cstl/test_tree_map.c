@@ -12,6 +12,97 @@ void test_tree_map_new() {
     tree_map_delete(map);
 }
 
+static int Integer_compare_reverse(const void *ptr1, const void *ptr2) {
+    return Integer_compare(ptr2, ptr1);
+}
+
+void test_tree_map_new_independent() {
+    int i = 0;
+    tree_map_t *ascending = tree_map_new(Integer_compare);
+    tree_map_t *descending = tree_map_new(Integer_compare_reverse);
+    tree_map_t *more = NULL;
+    pair_t *pair;
+
+    /* Each map keeps its own comparator, no matter how many maps are created */
+    for (i = 0; i < N; i++) {
+        tree_map_put(ascending, pair_new(Integer_new(i), Integer_new(i), Integer_delete, Integer_delete));
+        more = tree_map_new(Integer_compare);
+        tree_map_put(descending, pair_new(Integer_new(i), Integer_new(i), Integer_delete, Integer_delete));
+        tree_map_delete(more);
+    }
+
+    assert(tree_map_size(ascending) == N);
+    assert(tree_map_size(descending) == N);
+    assert(Integer_get(pair_get_key(tree_map_first(ascending))) == 0);
+    assert(Integer_get(pair_get_key(tree_map_first(descending))) == N - 1);
+
+    pair = tree_map_first(descending);
+    for (i = N - 1; i >= 0; i--) {
+        assert(Integer_get(pair_get_key(pair)) == i);
+        pair = tree_map_higher(descending, pair_get_key(pair));
+    }
+    assert(pair == NULL);
+
+    tree_map_delete(ascending);
+    tree_map_delete(descending);
+}
+
+void test_tree_map_from_sorted() {
+    int i = 0;
+    array_t *array = NULL;
+    tree_map_t *map = NULL;
+    Integer *key = NULL;
+
+    array = array_new(NULL, NULL);
+    for (i = 0; i < N; i++) {
+        array_append(array, pair_new(Integer_new(i), Integer_new(i * i), Integer_delete, Integer_delete));
+    }
+
+    map = tree_map_from_sorted(Integer_compare, array);
+    assert(map != NULL);
+    assert(tree_map_size(map) == N);
+    key = Integer_new(0);
+    for (i = 0; i < N; i++) {
+        Integer_set(key, i);
+        assert(Integer_get(tree_map_get(map, key)) == i * i);
+    }
+    Integer_delete(key);
+    tree_map_delete(map);
+    array_delete(array);
+
+    array = array_new(NULL, (destroy_t)pair_delete);
+    array_append(array, pair_new(Integer_new(2), Integer_new(0), Integer_delete, Integer_delete));
+    array_append(array, pair_new(Integer_new(1), Integer_new(0), Integer_delete, Integer_delete));
+    assert(tree_map_from_sorted(Integer_compare, array) == NULL);
+    array_delete(array);
+}
+
+void test_tree_map_from_array() {
+    int i = 0;
+    array_t *array = NULL;
+    tree_map_t *map = NULL;
+    Integer *key = NULL;
+
+    array = array_new(NULL, NULL);
+    for (i = 0; i < N; i++) {
+        array_append(array, pair_new(Integer_new((N - i) % 100), Integer_new(i), Integer_delete, Integer_delete));
+    }
+
+    map = tree_map_from_array(Integer_compare, array);
+    assert(map != NULL);
+    assert(tree_map_size(map) == 100);
+
+    /* The last pair of each key is kept, like repeated tree_map_put */
+    key = Integer_new(0);
+    for (i = 0; i < 100; i++) {
+        Integer_set(key, i);
+        assert(Integer_get(tree_map_get(map, key)) == (i == 0 ? N - 100 : N - i));
+    }
+    Integer_delete(key);
+    tree_map_delete(map);
+    array_delete(array);
+}
+
 void test_tree_map_delete() {
     tree_map_t *map = tree_map_new(UnsignedShort_compare);
     assert(map != NULL);
@@ -543,6 +634,199 @@ void test_tree_map_get() {
     tree_map_delete(map);
 }
 
+void test_tree_map_floor() {
+    int i = 0;
+    tree_map_t *map = NULL;
+    pair_t *pair;
+    Integer *key;
+
+    map = tree_map_new(Integer_compare);
+    for (i = 0; i < N; i++) {
+        pair = pair_new(Integer_new(i * 2), Integer_new(i), Integer_delete, Integer_delete);
+        tree_map_put(map, pair);
+    }
+
+    for (i = 0; i < N; i++) {
+        key = Integer_new(i * 2 + 1);
+        pair = tree_map_floor(map, key);
+        assert(pair != NULL);
+        assert(Integer_get(pair_get_key(pair)) == i * 2);
+        assert(Integer_get(pair_get_value(pair)) == i);
+        Integer_delete(key);
+    }
+
+    key = Integer_new(-1);
+    assert(tree_map_floor(map, key) == NULL);
+    Integer_delete(key);
+
+    tree_map_delete(map);
+}
+
+void test_tree_map_ceiling() {
+    int i = 0;
+    tree_map_t *map = NULL;
+    pair_t *pair;
+    Integer *key;
+
+    map = tree_map_new(Integer_compare);
+    for (i = 0; i < N; i++) {
+        pair = pair_new(Integer_new(i * 2), Integer_new(i), Integer_delete, Integer_delete);
+        tree_map_put(map, pair);
+    }
+
+    for (i = 0; i < N; i++) {
+        key = Integer_new(i * 2 - 1);
+        pair = tree_map_ceiling(map, key);
+        assert(pair != NULL);
+        assert(Integer_get(pair_get_key(pair)) == i * 2);
+        assert(Integer_get(pair_get_value(pair)) == i);
+        Integer_delete(key);
+    }
+
+    key = Integer_new(N * 2 - 1);
+    assert(tree_map_ceiling(map, key) == NULL);
+    Integer_delete(key);
+
+    tree_map_delete(map);
+}
+
+void test_tree_map_lower() {
+    int i = 0;
+    tree_map_t *map = NULL;
+    pair_t *pair;
+    Integer *key;
+
+    map = tree_map_new(Integer_compare);
+    for (i = 0; i < N; i++) {
+        pair = pair_new(Integer_new(i * 2), Integer_new(i), Integer_delete, Integer_delete);
+        tree_map_put(map, pair);
+    }
+
+    for (i = 0; i < N; i++) {
+        key = Integer_new(i * 2 + 2);
+        pair = tree_map_lower(map, key);
+        assert(pair != NULL);
+        assert(Integer_get(pair_get_key(pair)) == i * 2);
+        assert(Integer_get(pair_get_value(pair)) == i);
+        Integer_delete(key);
+    }
+
+    key = Integer_new(0);
+    assert(tree_map_lower(map, key) == NULL);
+    Integer_delete(key);
+
+    tree_map_delete(map);
+}
+
+void test_tree_map_higher() {
+    int i = 0;
+    tree_map_t *map = NULL;
+    pair_t *pair;
+    Integer *key;
+
+    map = tree_map_new(Integer_compare);
+    for (i = 0; i < N; i++) {
+        pair = pair_new(Integer_new(i * 2), Integer_new(i), Integer_delete, Integer_delete);
+        tree_map_put(map, pair);
+    }
+
+    for (i = 0; i < N; i++) {
+        key = Integer_new(i * 2 - 2);
+        pair = tree_map_higher(map, key);
+        assert(pair != NULL);
+        assert(Integer_get(pair_get_key(pair)) == i * 2);
+        assert(Integer_get(pair_get_value(pair)) == i);
+        Integer_delete(key);
+    }
+
+    key = Integer_new(N * 2 - 2);
+    assert(tree_map_higher(map, key) == NULL);
+    Integer_delete(key);
+
+    tree_map_delete(map);
+}
+
+void test_tree_map_first() {
+    int i = 0;
+    tree_map_t *map = NULL;
+    pair_t *pair;
+
+    map = tree_map_new(Integer_compare);
+    assert(tree_map_first(map) == NULL);
+    for (i = 0; i < N; i++) {
+        pair = pair_new(Integer_new((i * 7) % N), Integer_new(i), Integer_delete, Integer_delete);
+        tree_map_put(map, pair);
+        assert(Integer_get(pair_get_key(tree_map_first(map))) == 0);
+    }
+    tree_map_delete(map);
+}
+
+void test_tree_map_last() {
+    int i = 0;
+    int maximum = 0;
+    tree_map_t *map = NULL;
+    pair_t *pair;
+
+    map = tree_map_new(Integer_compare);
+    assert(tree_map_last(map) == NULL);
+    for (i = 0; i < N; i++) {
+        pair = pair_new(Integer_new((i * 7) % N), Integer_new(i), Integer_delete, Integer_delete);
+        tree_map_put(map, pair);
+        maximum = max(maximum, (i * 7) % N);
+        assert(Integer_get(pair_get_key(tree_map_last(map))) == maximum);
+    }
+    tree_map_delete(map);
+}
+
+void test_tree_map_select() {
+    int i = 0;
+    Integer *key = NULL;
+    tree_map_t *map = tree_map_new(Integer_compare);
+    for (i = 0; i < N; i++) {
+        tree_map_put(map, pair_new(Integer_new((i * 7) % N * 2), Integer_new(i), Integer_delete, Integer_delete));
+    }
+
+    for (i = 0; i < N; i++) {
+        assert(Integer_get(pair_get_key(tree_map_select(map, i))) == i * 2);
+    }
+    assert(tree_map_select(map, N) == NULL);
+
+    /* Ranks shift after removing the smaller half */
+    for (i = 0; i < N / 2; i++) {
+        key = Integer_new(i * 2);
+        tree_map_remove(map, key);
+        Integer_delete(key);
+    }
+    for (i = 0; i < N - N / 2; i++) {
+        assert(Integer_get(pair_get_key(tree_map_select(map, i))) == (N / 2 + i) * 2);
+    }
+
+    tree_map_delete(map);
+}
+
+void test_tree_map_rank() {
+    int i = 0;
+    Integer *key = NULL;
+    tree_map_t *map = tree_map_new(Integer_compare);
+    for (i = 0; i < N; i++) {
+        tree_map_put(map, pair_new(Integer_new((i * 7) % N * 2), Integer_new(i), Integer_delete, Integer_delete));
+    }
+
+    for (i = 0; i < N; i++) {
+        key = Integer_new(i * 2);
+        assert(tree_map_rank(map, key) == (size_t)i);
+        Integer_set(key, i * 2 + 1);
+        assert(tree_map_rank(map, key) == (size_t)i + 1);
+        Integer_delete(key);
+    }
+
+    key = Integer_new(-1);
+    assert(tree_map_rank(map, key) == 0);
+    Integer_delete(key);
+
+    tree_map_delete(map);
+}
+
 void test_tree_map_iterator() {
     int i = 0;
     tree_map_t *map = NULL;
@@ -570,3 +854,64 @@ void test_tree_map_iterator() {
 
     tree_map_delete(map);
 }
+
+void test_tree_map_iterator_range() {
+    int i = 0;
+    tree_map_t *map = NULL;
+    pair_t *pair;
+    iterator_t *iterator = NULL;
+    Integer *lo = NULL;
+    Integer *hi = NULL;
+
+    map = tree_map_new(Integer_compare);
+
+    for (i = 0; i < N; i++) {
+        pair = pair_new(Integer_new(i), Integer_new(i * i), Integer_delete, Integer_delete);
+        tree_map_put(map, pair);
+    }
+
+    lo = Integer_new(N / 4);
+    hi = Integer_new(N / 2);
+    iterator = tree_map_iterator_range(map, lo, hi);
+
+    i = N / 4;
+    while (tree_map_iterator_has_next(iterator)) {
+        pair = tree_map_iterator_next(iterator);
+        assert(Integer_get(pair_get_key(pair)) == i);
+        assert(Integer_get(pair_get_value(pair)) == i * i);
+        i++;
+    }
+    assert(i == N / 2);
+
+    tree_map_iterator_delete(iterator);
+    Integer_delete(lo);
+    Integer_delete(hi);
+    tree_map_delete(map);
+}
+
+void test_tree_map_iterator_reverse() {
+    int i = 0;
+    tree_map_t *map = NULL;
+    pair_t *pair;
+    iterator_t *iterator = NULL;
+
+    map = tree_map_new(Integer_compare);
+
+    for (i = 0; i < N; i++) {
+        pair = pair_new(Integer_new(i), Integer_new(i * i), Integer_delete, Integer_delete);
+        tree_map_put(map, pair);
+    }
+
+    iterator = tree_map_iterator_reverse(map);
+
+    i = N - 1;
+    while (tree_map_iterator_has_next(iterator)) {
+        pair = tree_map_iterator_next(iterator);
+        assert(Integer_get(pair_get_key(pair)) == i);
+        i--;
+    }
+    assert(i == -1);
+
+    tree_map_iterator_delete(iterator);
+    tree_map_delete(map);
+}
@@ -2,6 +2,9 @@
 #define _TEST_TREE_MAP_H_
 
 void test_tree_map_new();
+void test_tree_map_new_independent();
+void test_tree_map_from_sorted();
+void test_tree_map_from_array();
 void test_tree_map_delete();
 void test_tree_map_is_empty();
 void test_tree_map_size();
@@ -11,6 +14,16 @@ void test_tree_map_contains();
 void test_tree_map_put();
 void test_tree_map_remove();
 void test_tree_map_get();
+void test_tree_map_floor();
+void test_tree_map_ceiling();
+void test_tree_map_lower();
+void test_tree_map_higher();
+void test_tree_map_first();
+void test_tree_map_last();
+void test_tree_map_select();
+void test_tree_map_rank();
 void test_tree_map_iterator();
+void test_tree_map_iterator_range();
+void test_tree_map_iterator_reverse();
 
 #endif
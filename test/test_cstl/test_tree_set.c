@@ -12,6 +12,55 @@ void test_tree_set_new() {
     tree_set_delete(set);
 }
 
+void test_tree_set_from_sorted() {
+    int i = 0;
+    array_t *array = NULL;
+    tree_set_t *set = NULL;
+
+    array = array_new(Integer_compare, NULL);
+    for (i = 0; i < N; i++) {
+        array_append(array, Integer_new(i * 2));
+    }
+
+    set = tree_set_from_sorted(Integer_compare, Integer_delete, array);
+    assert(set != NULL);
+    assert(tree_set_size(set) == N);
+    for (i = 0; i < N; i++) {
+        assert(Integer_get(tree_set_select(set, i)) == i * 2);
+    }
+    tree_set_add(set, Integer_new(1));
+    assert(Integer_get(tree_set_select(set, 1)) == 1);
+    tree_set_delete(set);
+    array_delete(array);
+
+    array = array_new(Integer_compare, Integer_delete);
+    array_append(array, Integer_new(1));
+    array_append(array, Integer_new(1));
+    assert(tree_set_from_sorted(Integer_compare, Integer_delete, array) == NULL);
+    array_delete(array);
+}
+
+void test_tree_set_from_array() {
+    int i = 0;
+    array_t *array = NULL;
+    tree_set_t *set = NULL;
+
+    array = array_new(Integer_compare, NULL);
+    for (i = 0; i < N; i++) {
+        array_append(array, Integer_new(N - i - 1));
+        array_append(array, Integer_new(i));
+    }
+
+    set = tree_set_from_array(Integer_compare, Integer_delete, array);
+    assert(set != NULL);
+    assert(tree_set_size(set) == N);
+    for (i = 0; i < N; i++) {
+        assert(Integer_get(tree_set_select(set, i)) == i);
+    }
+    tree_set_delete(set);
+    array_delete(array);
+}
+
 void test_tree_set_delete() {
     tree_set_t *set = tree_set_new(UnsignedShort_compare, UnsignedShort_delete);
     assert(set != NULL);
@@ -211,6 +260,55 @@ void test_tree_set_remove() {
     tree_set_delete(set);
 }
 
+void test_tree_set_select() {
+    int i = 0;
+    Integer *key = NULL;
+    tree_set_t *set = tree_set_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        tree_set_add(set, Integer_new((i * 7) % N * 2));
+    }
+
+    for (i = 0; i < N; i++) {
+        assert(Integer_get(tree_set_select(set, i)) == i * 2);
+    }
+    assert(tree_set_select(set, N) == NULL);
+
+    /* Ranks shift after removing the smaller half */
+    for (i = 0; i < N / 2; i++) {
+        key = Integer_new(i * 2);
+        tree_set_remove(set, key);
+        Integer_delete(key);
+    }
+    for (i = 0; i < N - N / 2; i++) {
+        assert(Integer_get(tree_set_select(set, i)) == (N / 2 + i) * 2);
+    }
+
+    tree_set_delete(set);
+}
+
+void test_tree_set_rank() {
+    int i = 0;
+    Integer *key = NULL;
+    tree_set_t *set = tree_set_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        tree_set_add(set, Integer_new((i * 7) % N * 2));
+    }
+
+    for (i = 0; i < N; i++) {
+        key = Integer_new(i * 2);
+        assert(tree_set_rank(set, key) == (size_t)i);
+        Integer_set(key, i * 2 + 1);
+        assert(tree_set_rank(set, key) == (size_t)i + 1);
+        Integer_delete(key);
+    }
+
+    key = Integer_new(-1);
+    assert(tree_set_rank(set, key) == 0);
+    Integer_delete(key);
+
+    tree_set_delete(set);
+}
+
 void test_tree_set_union() {
     tree_set_t *set1 = NULL;
     tree_set_t *set2 = NULL;
@@ -944,6 +1042,80 @@ void test_tree_set_is_subset() {
     tree_set_delete(set2);
 }
 
+void test_tree_set_interleaved() {
+    tree_set_t *set1 = NULL;
+    tree_set_t *set2 = NULL;
+    tree_set_t *set3 = NULL;
+    iterator_t *iterator = NULL;
+    int i = 0;
+    int expected = 0;
+
+    /* Multiples of 2 and multiples of 3 interleave, so every merge branch is taken */
+    set1 = tree_set_new(Integer_compare, Integer_delete);
+    set2 = tree_set_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i += 2) {
+        tree_set_add(set1, Integer_new(i));
+    }
+    for (i = 0; i < N; i += 3) {
+        tree_set_add(set2, Integer_new(i));
+    }
+
+    set3 = tree_set_union(set1, set2);
+    iterator = tree_set_iterator_new(set3);
+    for (i = 0; i < N; i++) {
+        if (i % 2 == 0 || i % 3 == 0) {
+            assert(Integer_get(tree_set_iterator_next(iterator)) == i);
+        }
+    }
+    assert(!tree_set_iterator_has_next(iterator));
+    tree_set_iterator_delete(iterator);
+    tree_set_delete(set3);
+
+    set3 = tree_set_intersection(set1, set2);
+    for (i = 0, expected = 0; i < N; i += 6, expected++) {
+        assert(Integer_get(tree_set_select(set3, expected)) == i);
+    }
+    assert(tree_set_size(set3) == (size_t)expected);
+    tree_set_delete(set3);
+
+    set3 = tree_set_difference(set1, set2);
+    iterator = tree_set_iterator_new(set3);
+    for (i = 0; i < N; i++) {
+        if (i % 2 == 0 && i % 3 != 0) {
+            assert(Integer_get(tree_set_iterator_next(iterator)) == i);
+        }
+    }
+    assert(!tree_set_iterator_has_next(iterator));
+    tree_set_iterator_delete(iterator);
+    tree_set_delete(set3);
+
+    set3 = tree_set_symmetric_difference(set1, set2);
+    iterator = tree_set_iterator_new(set3);
+    for (i = 0; i < N; i++) {
+        if ((i % 2 == 0) != (i % 3 == 0)) {
+            assert(Integer_get(tree_set_iterator_next(iterator)) == i);
+        }
+    }
+    assert(!tree_set_iterator_has_next(iterator));
+    tree_set_iterator_delete(iterator);
+    tree_set_delete(set3);
+
+    assert(tree_set_is_disjoint(set1, set2) == false);
+    assert(tree_set_is_subset(set1, set2) == false);
+
+    set3 = tree_set_intersection(set1, set2);
+    assert(tree_set_is_subset(set3, set1) == true);
+    assert(tree_set_is_subset(set3, set2) == true);
+    tree_set_delete(set3);
+
+    set3 = tree_set_difference(set1, set2);
+    assert(tree_set_is_disjoint(set3, set2) == true);
+    tree_set_delete(set3);
+
+    tree_set_delete(set1);
+    tree_set_delete(set2);
+}
+
 void test_tree_set_iterator() {
     int i = 0;
     tree_set_t *set = NULL;
@@ -967,3 +1139,59 @@ void test_tree_set_iterator() {
     tree_set_iterator_delete(iterator);
     tree_set_delete(set);
 }
+
+void test_tree_set_iterator_range() {
+    int i = 0;
+    tree_set_t *set = NULL;
+    iterator_t *iterator = NULL;
+    Integer *lo = NULL;
+    Integer *hi = NULL;
+    Integer *integer;
+
+    set = tree_set_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        tree_set_add(set, Integer_new(i));
+    }
+
+    lo = Integer_new(N / 4);
+    hi = Integer_new(N / 2);
+    iterator = tree_set_iterator_range(set, lo, hi);
+
+    i = N / 4;
+    while (tree_set_iterator_has_next(iterator)) {
+        integer = (Integer *)tree_set_iterator_next(iterator);
+        assert(Integer_get(integer) == i);
+        i++;
+    }
+    assert(i == N / 2);
+
+    tree_set_iterator_delete(iterator);
+    Integer_delete(lo);
+    Integer_delete(hi);
+    tree_set_delete(set);
+}
+
+void test_tree_set_iterator_reverse() {
+    int i = 0;
+    tree_set_t *set = NULL;
+    iterator_t *iterator = NULL;
+    Integer *integer;
+
+    set = tree_set_new(Integer_compare, Integer_delete);
+    for (i = 0; i < N; i++) {
+        tree_set_add(set, Integer_new(i));
+    }
+
+    iterator = tree_set_iterator_reverse(set);
+
+    i = N - 1;
+    while (tree_set_iterator_has_next(iterator)) {
+        integer = (Integer *)tree_set_iterator_next(iterator);
+        assert(Integer_get(integer) == i);
+        i--;
+    }
+    assert(i == -1);
+
+    tree_set_iterator_delete(iterator);
+    tree_set_delete(set);
+}
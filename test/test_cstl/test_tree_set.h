@@ -2,6 +2,8 @@
 #define _TEST_TREE_SET_H_
 
 void test_tree_set_new();
+void test_tree_set_from_sorted();
+void test_tree_set_from_array();
 void test_tree_set_delete();
 void test_tree_set_is_empty();
 void test_tree_set_size();
@@ -10,12 +12,17 @@ void test_tree_set_clear();
 void test_tree_set_contains();
 void test_tree_set_add();
 void test_tree_set_remove();
+void test_tree_set_select();
+void test_tree_set_rank();
 void test_tree_set_union();
 void test_tree_set_intersection();
 void test_tree_set_difference();
 void test_tree_set_symmetric_difference();
 void test_tree_set_is_disjoint();
 void test_tree_set_is_subset();
+void test_tree_set_interleaved();
 void test_tree_set_iterator();
+void test_tree_set_iterator_range();
+void test_tree_set_iterator_reverse();
 
 #endif
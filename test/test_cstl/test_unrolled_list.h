@@ -0,0 +1,26 @@
+#ifndef _TEST_UNROLLED_LIST_H_
+#define _TEST_UNROLLED_LIST_H_
+
+void test_unrolled_list_new();
+void test_unrolled_list_delete();
+void test_unrolled_list_is_empty();
+void test_unrolled_list_size();
+void test_unrolled_list_foreach();
+void test_unrolled_list_clear();
+void test_unrolled_list_get();
+void test_unrolled_list_set();
+void test_unrolled_list_index_of();
+void test_unrolled_list_contains();
+void test_unrolled_list_count();
+void test_unrolled_list_get_front();
+void test_unrolled_list_get_back();
+void test_unrolled_list_push_front();
+void test_unrolled_list_push_back();
+void test_unrolled_list_pop_front();
+void test_unrolled_list_pop_back();
+void test_unrolled_list_insert();
+void test_unrolled_list_remove();
+void test_unrolled_list_reverse();
+void test_unrolled_list_iterator();
+
+#endif
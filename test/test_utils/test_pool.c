@@ -0,0 +1,109 @@
+#include "test_pool.h"
+#include "cstl.h"
+#include <assert.h>
+
+#define N 1000
+
+void test_pool_new() {
+    pool_t *pool = pool_new(sizeof(int));
+    assert(pool != NULL);
+    assert(pool_block_size(pool) >= sizeof(int));
+    assert(pool_block_size(pool) >= sizeof(void *));
+    pool_delete(pool);
+
+    pool = pool_new(0);
+    assert(pool == NULL);
+}
+
+void test_pool_delete() {
+    int i = 0;
+    pool_t *pool = pool_new(sizeof(double));
+    assert(pool != NULL);
+    for (i = 0; i < N; i++) {
+        assert(pool_alloc(pool) != NULL);
+    }
+    pool_delete(pool);
+}
+
+void test_pool_alloc() {
+    int i = 0;
+    int j = 0;
+    int *blocks[N];
+    pool_t *pool = pool_new(sizeof(int));
+
+    for (i = 0; i < N; i++) {
+        blocks[i] = (int *)pool_alloc(pool);
+        assert(blocks[i] != NULL);
+        *blocks[i] = i;
+    }
+
+    for (i = 0; i < N; i++) {
+        assert(*blocks[i] == i);
+        for (j = i + 1; j < N && j < i + 8; j++) {
+            assert(blocks[i] != blocks[j]);
+        }
+    }
+
+    pool_delete(pool);
+}
+
+void test_pool_free() {
+    int i = 0;
+    void *block = NULL;
+    void *blocks[N];
+    pool_t *pool = pool_new(sizeof(long));
+
+    block = pool_alloc(pool);
+    pool_free(pool, block);
+    assert(pool_alloc(pool) == block);
+
+    for (i = 0; i < N; i++) {
+        blocks[i] = pool_alloc(pool);
+    }
+    for (i = 0; i < N; i++) {
+        pool_free(pool, blocks[i]);
+    }
+    for (i = N - 1; i >= 0; i--) {
+        assert(pool_alloc(pool) == blocks[i]);
+    }
+
+    pool_delete(pool);
+}
+
+void test_pool_clear() {
+    int i = 0;
+    pool_t *pool = pool_new(sizeof(int));
+
+    for (i = 0; i < N; i++) {
+        *(int *)pool_alloc(pool) = i;
+    }
+    assert(pool_clear(pool) == pool);
+    for (i = 0; i < N; i++) {
+        *(int *)pool_alloc(pool) = i;
+    }
+
+    pool_delete(pool);
+}
+
+void test_pool_merge() {
+    int i = 0;
+    int *blocks[N];
+    pool_t *pool1 = pool_new(sizeof(int));
+    pool_t *pool2 = pool_new(sizeof(int));
+
+    for (i = 0; i < N; i++) {
+        blocks[i] = (int *)pool_alloc(i % 2 == 0 ? pool1 : pool2);
+        *blocks[i] = i;
+    }
+    pool_free(pool2, blocks[1]);
+
+    assert(pool_merge(pool1, pool2) == pool1);
+    pool_delete(pool2);
+
+    for (i = 2; i < N; i++) {
+        assert(*blocks[i] == i);
+    }
+    assert(pool_alloc(pool1) == blocks[1]);
+
+    pool_delete(pool1);
+}
@@ -0,0 +1,11 @@
+#ifndef _TEST_POOL_H_
+#define _TEST_POOL_H_
+
+void test_pool_new();
+void test_pool_delete();
+void test_pool_alloc();
+void test_pool_free();
+void test_pool_clear();
+void test_pool_merge();
+
+#endif